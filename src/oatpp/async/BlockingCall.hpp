@@ -0,0 +1,133 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_BlockingCall_hpp
+#define oatpp_async_BlockingCall_hpp
+
+#include "./Coroutine.hpp"
+
+#include <functional>
+
+namespace oatpp { namespace async {
+
+/**
+ * Coroutine which runs a blocking callable on &id:oatpp::async::worker::BlockingWorker;
+ * and returns the callable's result to the caller-coroutine. <br>
+ * The processor thread is not blocked while the callable runs. If the callable throws,
+ * the caller receives &id:oatpp::async::Error; carrying the exception (see `Error::getExceptionPtr()`). <br>
+ * Example:
+ * ```cpp
+ * Action act() override {
+ *   return oatpp::async::BlockingCall<oatpp::String>::startForResult([this]{ return readFileBlocking(m_path); })
+ *          .callbackTo(&MyCoroutine::onFileRead);
+ * }
+ * ```
+ * *Callable must not capture anything what can go away while the caller-coroutine is suspended.*
+ * @tparam T - result type. Must be default-constructible and copy-assignable.
+ */
+template<typename T>
+class BlockingCall : public CoroutineWithResult<BlockingCall<T>, const T&>, public BlockingTask {
+private:
+  std::function<T()> m_function;
+  T m_result;
+  std::exception_ptr m_exception;
+  bool m_done;
+public:
+
+  /**
+   * Constructor.
+   * @param function - blocking callable.
+   */
+  BlockingCall(const std::function<T()>& function)
+    : m_function(function)
+    , m_result()
+    , m_done(false)
+  {}
+
+  void run() override {
+    try {
+      m_result = m_function();
+    } catch (...) {
+      m_exception = std::current_exception();
+    }
+    m_done = true;
+  }
+
+  Action act() override {
+    if(!m_done) {
+      return Action::createBlockingAction(this);
+    }
+    if(m_exception) {
+      return AbstractCoroutine::error(new Error(m_exception));
+    }
+    return this->_return(m_result);
+  }
+
+};
+
+/**
+ * Coroutine which runs a blocking callable without result on &id:oatpp::async::worker::BlockingWorker;.
+ * See &l:BlockingCall;.
+ */
+template<>
+class BlockingCall<void> : public Coroutine<BlockingCall<void>>, public BlockingTask {
+private:
+  std::function<void()> m_function;
+  std::exception_ptr m_exception;
+  bool m_done;
+public:
+
+  /**
+   * Constructor.
+   * @param function - blocking callable.
+   */
+  BlockingCall(const std::function<void()>& function)
+    : m_function(function)
+    , m_done(false)
+  {}
+
+  void run() override {
+    try {
+      m_function();
+    } catch (...) {
+      m_exception = std::current_exception();
+    }
+    m_done = true;
+  }
+
+  Action act() override {
+    if(!m_done) {
+      return Action::createBlockingAction(this);
+    }
+    if(m_exception) {
+      return AbstractCoroutine::error(new Error(m_exception));
+    }
+    return finish();
+  }
+
+};
+
+}}
+
+#endif // oatpp_async_BlockingCall_hpp
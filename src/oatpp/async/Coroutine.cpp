@@ -69,6 +69,12 @@ Action Action::createWaitListAction(CoroutineWaitList* waitList, const std::chro
   return result;
 }
 
+Action Action::createBlockingAction(BlockingTask* task) {
+  Action result(TYPE_BLOCKING);
+  result.m_data.blockingTask = task;
+  return result;
+}
+
 Action::Action()
   : m_type(TYPE_NONE)
 {}
@@ -158,6 +164,10 @@ v_int32 Action::getIOEventCode() const {
   return m_type | m_data.ioData.ioEventType;
 }
 
+BlockingTask* Action::getBlockingTask() const {
+  return m_data.blockingTask;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // CoroutineStarter
 
@@ -234,12 +244,22 @@ void CoroutineStarter::freeCoroutines()
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // CoroutineHandle
 
+void* CoroutineHandle::operator new(std::size_t sz) {
+  return utils::SlabAllocator::allocate(sz);
+}
+
+void CoroutineHandle::operator delete(void* ptr) {
+  utils::SlabAllocator::deallocate(ptr);
+}
+
 CoroutineHandle::CoroutineHandle(Processor* processor, AbstractCoroutine* rootCoroutine)
   : _PP(processor)
   , _CP(rootCoroutine)
   , _FP(&AbstractCoroutine::act)
   , _SCH_A(Action::TYPE_NONE)
   , _ref(nullptr)
+  , _PRI(Priority::NORMAL)
+  , _QT(0)
 {}
 
 CoroutineHandle::~CoroutineHandle() {
@@ -29,6 +29,8 @@
 #include "./Error.hpp"
 
 #include "oatpp/async/utils/FastQueue.hpp"
+#include "oatpp/async/utils/MPSCQueue.hpp"
+#include "oatpp/async/utils/SlabAllocator.hpp"
 
 #include "oatpp/IODefinitions.hpp"
 #include "oatpp/Environment.hpp"
@@ -50,6 +52,25 @@ namespace worker {
   class Worker; // FWD
 }
 
+/**
+ * Task to be run off the processor thread by &id:oatpp::async::worker::BlockingWorker;.
+ * See &id:oatpp::async::BlockingCall;.
+ */
+class BlockingTask {
+public:
+
+  /**
+   * Default virtual destructor.
+   */
+  virtual ~BlockingTask() = default;
+
+  /**
+   * Run the task. Called on a blocking worker thread. Must not throw.
+   */
+  virtual void run() = 0;
+
+};
+
 /**
  * Class Action represents an asynchronous action.
  */
@@ -120,6 +141,11 @@ public:
    */
   static constexpr const v_int32 TYPE_WAIT_LIST_WITH_TIMEOUT = 10;
 
+  /**
+   * Indicate that coroutine should be suspended till its &l:BlockingTask; is run by a blocking worker.
+   */
+  static constexpr const v_int32 TYPE_BLOCKING = 11;
+
 public:
 
   /**
@@ -194,6 +220,7 @@ private:
     IOData ioData;
     v_int64 timePointMicroseconds;
     WaitListData waitListData;
+    BlockingTask* blockingTask;
   };
 private:
   mutable v_int32 m_type;
@@ -256,6 +283,13 @@ public:
    */
   static Action createWaitListAction(CoroutineWaitList* waitList, const std::chrono::system_clock::time_point& timeoutTime = TIME_ZERO);
 
+  /**
+   * Create TYPE_BLOCKING Action.
+   * @param task - &l:BlockingTask; to run. Not owned by the action - must live till the coroutine is resumed.
+   * @return - Action.
+   */
+  static Action createBlockingAction(BlockingTask* task);
+
   /**
    * Constructor. Create start-coroutine Action.
    * @param coroutine - pointer to &l:AbstractCoroutine;.
@@ -344,6 +378,13 @@ public:
    */
   v_int32 getIOEventCode() const;
 
+  /**
+   * Get blocking task of the action.
+   * This method returns meaningful value only if Action is TYPE_BLOCKING.
+   * @return - &l:BlockingTask;.
+   */
+  BlockingTask* getBlockingTask() const;
+
   
 };
 
@@ -409,11 +450,37 @@ public:
 
 };
 
+/**
+ * Priority class of a coroutine. <br>
+ * Coroutines called from a coroutine run within the same &l:CoroutineHandle; and share its priority class.
+ * Coroutines submitted to &id:oatpp::async::Executor; from a running coroutine inherit its priority class
+ * unless the class is specified explicitly.
+ */
+enum class Priority : v_int32 {
+
+  /**
+   * Latency-sensitive work.
+   */
+  HIGH = 0,
+
+  /**
+   * Default priority class.
+   */
+  NORMAL = 1,
+
+  /**
+   * Background work.
+   */
+  LOW = 2
+
+};
+
 /**
  * This class manages coroutines processing state and a chain of coroutine calls.
  */
 class CoroutineHandle : public oatpp::base::Countable {
   friend utils::FastQueue<CoroutineHandle>;
+  friend utils::MPSCQueue<CoroutineHandle>;
   friend Processor;
   friend worker::Worker;
   friend CoroutineWaitList;
@@ -427,6 +494,13 @@ private:
   FunctionPtr _FP; // Function pointer
   oatpp::async::Action _SCH_A; // Scheduled action
   CoroutineHandle* _ref; // pointer to next coroutine handle in list
+  Priority _PRI; // Priority class
+  v_int64 _QT; // Time (steady clock microseconds) the coroutine became runnable. 0 - not measured
+public:
+
+  static void* operator new(std::size_t sz);
+  static void operator delete(void* ptr);
+
 public:
 
   CoroutineHandle(Processor* processor, AbstractCoroutine* rootCoroutine);
@@ -598,12 +672,12 @@ public:
 public:
 
   static void* operator new(std::size_t sz) {
-    return ::operator new(sz);
+    return utils::SlabAllocator::allocate(sz);
   }
 
   static void operator delete(void* ptr, std::size_t sz) {
     (void)sz;
-    ::operator delete(ptr);
+    utils::SlabAllocator::deallocate(ptr);
   }
 
 public:
@@ -662,6 +736,11 @@ public:
    * Class representing Coroutine call for result;
    */
   class StarterForResult {
+  public:
+    /**
+     * Type of the started coroutine.
+     */
+    typedef AbstractCoroutineWithResult CoroutineType;
   private:
     AbstractCoroutineWithResult* m_coroutine;
   public:
@@ -731,6 +810,21 @@ public:
 
     }
 
+    /**
+     * Set custom result receiver and return coroutine starting Action.
+     * @param receiver - &l:AbstractCoroutine::AbstractMemberCaller;. Called with the caller coroutine and the result.
+     * @return - &id:oatpp::async::Action;.
+     */
+    Action callbackTo(std::unique_ptr<AbstractMemberCaller<Args...>>&& receiver) {
+      if(m_coroutine == nullptr) {
+        throw std::runtime_error("[oatpp::async::AbstractCoroutineWithResult::StarterForResult::callbackTo()]: Error. Coroutine is null.");
+      }
+      m_coroutine->m_parentMemberCaller = std::move(receiver);
+      Action result = m_coroutine;
+      m_coroutine = nullptr;
+      return result;
+    }
+
   };
 
 };
@@ -754,12 +848,12 @@ public:
 public:
 
   static void* operator new(std::size_t sz) {
-    return ::operator new(sz);
+    return utils::SlabAllocator::allocate(sz);
   }
 
   static void operator delete(void* ptr, std::size_t sz) {
     (void)sz;
-    ::operator delete(ptr);
+    utils::SlabAllocator::deallocate(ptr);
   }
 public:
 
@@ -76,9 +76,13 @@ void CoroutineWaitList::removeCoroutine(CoroutineHandle* coroutine) {
   coroutine->_PP->wakeCoroutine(coroutine);
 }
 
-void CoroutineWaitList::forgetCoroutine(CoroutineHandle *coroutine) {
-  std::lock_guard<std::mutex> lock(m_lock);
+bool CoroutineWaitList::tryForgetCoroutine(CoroutineHandle *coroutine) {
+  std::unique_lock<std::mutex> lock(m_lock, std::try_to_lock);
+  if(!lock.owns_lock()) {
+    return false;
+  }
   m_coroutines.erase(coroutine);
+  return true;
 }
 
 CoroutineWaitList& CoroutineWaitList::operator=(CoroutineWaitList&& other) {
@@ -61,7 +61,7 @@ private:
   Listener* m_listener = nullptr;
 private:
   void removeCoroutine(CoroutineHandle* coroutine); //<-- Calls Processor
-  void forgetCoroutine(CoroutineHandle* coroutine); //<-- Called From Processor
+  bool tryForgetCoroutine(CoroutineHandle* coroutine); //<-- Called From Processor
 protected:
   /*
    * Put coroutine on wait-list.
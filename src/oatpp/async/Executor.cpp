@@ -25,18 +25,21 @@
 #include "Executor.hpp"
 
 #include "oatpp/async/worker/IOEventWorker.hpp"
+#include "oatpp/async/worker/IOUringWorker.hpp"
 #include "oatpp/async/worker/IOWorker.hpp"
 #include "oatpp/async/worker/TimerWorker.hpp"
 
 #include "oatpp/concurrency/Utils.hpp"
+#include "oatpp/base/Log.hpp"
 
 namespace oatpp { namespace async {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Executor::SubmissionProcessor
 
-Executor::SubmissionProcessor::SubmissionProcessor()
+Executor::SubmissionProcessor::SubmissionProcessor(const Processor::Scheduling& scheduling)
   : worker::Worker(worker::Worker::Type::PROCESSOR)
+  , m_processor(scheduling)
   , m_isRunning(true)
 {
   m_thread = std::thread(&Executor::SubmissionProcessor::run, this);
@@ -47,12 +50,16 @@ oatpp::async::Processor& Executor::SubmissionProcessor::getProcessor() {
 }
 
 void Executor::SubmissionProcessor::run() {
-  
+
+  m_processor.attachAllocator();
+
   while(m_isRunning) {
     m_processor.waitForTasks();
     while (m_processor.iterate(100)) {}
   }
-  
+
+  m_processor.detachAllocator();
+
 }
 
 void Executor::SubmissionProcessor::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
@@ -87,7 +94,13 @@ void Executor::SubmissionProcessor::detach() {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Executor
 
-Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int32 timerWorkersCount, v_int32 ioWorkerType)
+Executor::Executor(v_int32 processorWorkersCount,
+                   v_int32 ioWorkersCount,
+                   v_int32 timerWorkersCount,
+                   v_int32 ioWorkerType,
+                   const worker::Worker::LocalRunBudget& ioLocalRunBudget,
+                   const Processor::Scheduling& scheduling,
+                   const worker::BlockingWorker::Config& blockingConfig)
   : m_balancer(0)
 {
 
@@ -97,7 +110,13 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
   ioWorkerType = chooseIOWorkerType(ioWorkerType);
 
   for(v_int32 i = 0; i < processorWorkersCount; i ++) {
-    m_processorWorkers.push_back(std::make_shared<SubmissionProcessor>());
+    m_processorWorkers.push_back(std::make_shared<SubmissionProcessor>(scheduling));
+  }
+
+  for(auto& p : m_processorWorkers) {
+    for(auto& peer : m_processorWorkers) {
+      p->getProcessor().addPeer(&peer->getProcessor());
+    }
   }
 
   m_allWorkers.insert(m_allWorkers.end(), m_processorWorkers.begin(), m_processorWorkers.end());
@@ -115,7 +134,14 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
 
     case IO_WORKER_TYPE_EVENT: {
       for (v_int32 i = 0; i < ioWorkersCount; i++) {
-        ioWorkers.push_back(std::make_shared<worker::IOEventWorkerForeman>());
+        ioWorkers.push_back(std::make_shared<worker::IOEventWorkerForeman>(ioLocalRunBudget));
+      }
+      break;
+    }
+
+    case IO_WORKER_TYPE_URING: {
+      for (v_int32 i = 0; i < ioWorkersCount; i++) {
+        ioWorkers.push_back(std::make_shared<worker::IOUringWorker>(ioLocalRunBudget));
       }
       break;
     }
@@ -135,6 +161,18 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
 
   linkWorkers(timerWorkers);
 
+  m_blockingWorker = std::make_shared<worker::BlockingWorker>(blockingConfig);
+  linkWorkers({m_blockingWorker});
+
+}
+
+Executor::~Executor() {
+  for(auto& p : m_processorWorkers) {
+    p->stop();
+  }
+  for(auto& p : m_processorWorkers) {
+    p->join();
+  }
 }
 
 v_int32 Executor::chooseProcessorWorkersCount(v_int32 processorWorkersCount) {
@@ -181,6 +219,15 @@ v_int32 Executor::chooseIOWorkerType(v_int32 ioWorkerType) {
 #endif
   }
 
+  if(ioWorkerType == IO_WORKER_TYPE_URING && !worker::IOUringWorker::isSupported()) {
+    OATPP_LOGw("[oatpp::async::Executor::chooseIOWorkerType()]", "io_uring is not available. Falling back to IO_WORKER_TYPE_EVENT.")
+#if defined(OATPP_IO_EVENT_INTERFACE_STUB)
+    return IO_WORKER_TYPE_NAIVE;
+#else
+    return IO_WORKER_TYPE_EVENT;
+#endif
+  }
+
   return ioWorkerType;
 
 }
@@ -254,6 +301,42 @@ v_int32 Executor::getTasksCount() {
 
 }
 
+std::vector<Processor::StealStats> Executor::getStealStats() {
+
+  std::vector<Processor::StealStats> result;
+  result.reserve(m_processorWorkers.size());
+
+  for(const auto& procWorker : m_processorWorkers) {
+    result.push_back(procWorker->getProcessor().getStealStats());
+  }
+
+  return result;
+
+}
+
+std::vector<Processor::QueueLatencyStats> Executor::getQueueLatencyStats() {
+
+  std::vector<Processor::QueueLatencyStats> result(Processor::PRIORITY_CLASSES, {0, 0, 0});
+
+  for(const auto& procWorker : m_processorWorkers) {
+    auto stats = procWorker->getProcessor().getQueueLatencyStats();
+    for(size_t i = 0; i < result.size(); i ++) {
+      result[i].count += stats[i].count;
+      result[i].totalMicroseconds += stats[i].totalMicroseconds;
+      if(stats[i].maxMicroseconds > result[i].maxMicroseconds) {
+        result[i].maxMicroseconds = stats[i].maxMicroseconds;
+      }
+    }
+  }
+
+  return result;
+
+}
+
+worker::BlockingWorker::Stats Executor::getBlockingStats() {
+  return m_blockingWorker->getStats();
+}
+
 void Executor::waitTasksFinished(const std::chrono::duration<v_int64, std::micro>& timeout) {
 
   auto startTime = std::chrono::system_clock::now();
@@ -26,6 +26,7 @@
 #define oatpp_async_Executor_hpp
 
 #include "./Processor.hpp"
+#include "oatpp/async/worker/BlockingWorker.hpp"
 #include "oatpp/async/worker/Worker.hpp"
 #include "oatpp/base/Compiler.hpp"
 
@@ -53,7 +54,7 @@ private:
   private:
     std::thread m_thread;
   public:
-    SubmissionProcessor();
+    SubmissionProcessor(const Processor::Scheduling& scheduling);
     ~SubmissionProcessor() override {
       stop();
       join();
@@ -61,8 +62,8 @@ private:
   public:
 
     template<typename CoroutineType, typename ... Args>
-    void execute(Args... params) {
-      m_processor.execute<CoroutineType, Args...>(params...);
+    void execute(Priority priority, Args... params) {
+      m_processor.execute<CoroutineType, Args...>(priority, params...);
     }
 
     oatpp::async::Processor& getProcessor();
@@ -97,11 +98,18 @@ public:
    * IO Worker type event.
    */
   static constexpr const v_int32 IO_WORKER_TYPE_EVENT = 1;
+
+  /**
+   * IO Worker type io_uring (Linux only). &id:oatpp::async::worker::IOUringWorker;. <br>
+   * Falls back to &l:Executor::IO_WORKER_TYPE_EVENT; if io_uring is not available.
+   */
+  static constexpr const v_int32 IO_WORKER_TYPE_URING = 2;
 private:
   std::atomic<v_uint32> m_balancer;
 private:
   std::vector<std::shared_ptr<SubmissionProcessor>> m_processorWorkers;
   std::vector<std::shared_ptr<worker::Worker>> m_allWorkers;
+  std::shared_ptr<worker::BlockingWorker> m_blockingWorker;
 private:
   static v_int32 chooseProcessorWorkersCount(v_int32 processorWorkersCount);
   static v_int32 chooseIOWorkersCount(v_int32 processorWorkersCount, v_int32 ioWorkersCount);
@@ -116,16 +124,26 @@ public:
    * @param ioWorkersCount - number of I/O processing workers.
    * @param timerWorkersCount - number of timer processing workers.
    * @param IOWorkerType
+   * @param ioLocalRunBudget - run-to-completion budget of I/O workers (disabled by default).
+   * See &id:oatpp::async::worker::Worker::LocalRunBudget;. Not used by &l:Executor::IO_WORKER_TYPE_NAIVE;.
+   * @param scheduling - scheduling of priority classes in processors (weighted-fair by default).
+   * See &id:oatpp::async::Processor::Scheduling;.
+   * @param blockingConfig - thread pool configuration of the blocking worker shared by all processors.
+   * See &id:oatpp::async::worker::BlockingWorker::Config;.
    */
   Executor(v_int32 processorWorkersCount = VALUE_SUGGESTED,
            v_int32 ioWorkersCount = VALUE_SUGGESTED,
            v_int32 timerWorkersCount = VALUE_SUGGESTED,
-           v_int32 ioWorkerType = VALUE_SUGGESTED);
+           v_int32 ioWorkerType = VALUE_SUGGESTED,
+           const worker::Worker::LocalRunBudget& ioLocalRunBudget = worker::Worker::LocalRunBudget(),
+           const Processor::Scheduling& scheduling = Processor::Scheduling(),
+           const worker::BlockingWorker::Config& blockingConfig = worker::BlockingWorker::Config());
 
   /**
-   * Non-virtual Destructor.
+   * Non-virtual Destructor. <br>
+   * Stops processor threads before any of processors is destroyed since processors may steal from each other.
    */
-  ~Executor() = default;
+  ~Executor();
 
   /**
    * Join all worker-threads.
@@ -144,7 +162,9 @@ public:
   void stop();
 
   /**
-   * Execute Coroutine.
+   * Execute Coroutine. <br>
+   * Coroutine inherits priority class of the coroutine calling this method.
+   * If called not from a coroutine then &id:oatpp::async::Priority::NORMAL; is used.
    * @tparam CoroutineType - type of coroutine to execute.
    * @tparam Args - types of arguments to be passed to Coroutine constructor.
    * @param params - actual arguments to be passed to Coroutine constructor.
@@ -152,7 +172,20 @@ public:
   template<typename CoroutineType, typename ... Args>
   void execute(Args... params) {
     auto& processor = m_processorWorkers[(++ m_balancer) % m_processorWorkers.size()];
-    processor->execute<CoroutineType, Args...>(params...);
+    processor->execute<CoroutineType, Args...>(Processor::getCurrentPriority(), params...);
+  }
+
+  /**
+   * Execute Coroutine with specified priority class.
+   * @tparam CoroutineType - type of coroutine to execute.
+   * @tparam Args - types of arguments to be passed to Coroutine constructor.
+   * @param priority - &id:oatpp::async::Priority;.
+   * @param params - actual arguments to be passed to Coroutine constructor.
+   */
+  template<typename CoroutineType, typename ... Args>
+  void execute(Priority priority, Args... params) {
+    auto& processor = m_processorWorkers[(++ m_balancer) % m_processorWorkers.size()];
+    processor->execute<CoroutineType, Args...>(priority, params...);
   }
 
   /**
@@ -161,6 +194,24 @@ public:
    */
   v_int32 getTasksCount();
 
+  /**
+   * Get work-stealing statistics of each processor.
+   * @return - vector of &id:oatpp::async::Processor::StealStats; in order of processors.
+   */
+  std::vector<Processor::StealStats> getStealStats();
+
+  /**
+   * Get queueing latency statistics aggregated over all processors.
+   * @return - vector of &id:oatpp::async::Processor::QueueLatencyStats; indexed by &id:oatpp::async::Priority;.
+   */
+  std::vector<Processor::QueueLatencyStats> getQueueLatencyStats();
+
+  /**
+   * Get statistics of the blocking worker.
+   * @return - &id:oatpp::async::worker::BlockingWorker::Stats;.
+   */
+  worker::BlockingWorker::Stats getBlockingStats();
+
   /**
    * Wait until all tasks are finished.
    * @param timeout
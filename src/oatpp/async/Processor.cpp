@@ -29,6 +29,55 @@
 
 namespace oatpp { namespace async {
 
+namespace {
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+thread_local Priority t_currentPriority = Priority::NORMAL;
+#endif
+
+}
+
+Processor::Processor()
+  : Processor(Scheduling())
+{}
+
+Processor::Processor(const Scheduling& scheduling)
+  : m_scheduling(scheduling)
+{
+
+  if(m_scheduling.policy != SCHEDULING_WEIGHTED_FAIR && m_scheduling.policy != SCHEDULING_STRICT_PRIORITY) {
+    throw std::runtime_error("[oatpp::async::Processor::Processor()]: Error. Unknown scheduling policy.");
+  }
+
+  for(v_int32 i = 0; i < PRIORITY_CLASSES; i ++) {
+    if(m_scheduling.weights[i] == 0) {
+      throw std::runtime_error("[oatpp::async::Processor::Processor()]: Error. Priority class weight must be greater than zero.");
+    }
+    m_strides[i] = STRIDE_BASE / m_scheduling.weights[i];
+    m_passes[i] = 0;
+  }
+
+  m_allocatorPool = utils::SlabAllocator::createPool();
+
+}
+
+Processor::~Processor() {
+  CoroutineHandle* coroutine;
+  while((coroutine = m_stealable.pop()) != nullptr) {
+    delete coroutine;
+  }
+  // pool memory is given back once the remaining coroutines are freed
+  utils::SlabAllocator::releasePool(m_allocatorPool);
+}
+
+void Processor::attachAllocator() {
+  utils::SlabAllocator::setThreadPool(m_allocatorPool);
+}
+
+void Processor::detachAllocator() {
+  utils::SlabAllocator::setThreadPool(nullptr);
+}
+
 void Processor::addWorker(const std::shared_ptr<worker::Worker>& worker) {
 
   switch(worker->getType()) {
@@ -43,6 +92,11 @@ void Processor::addWorker(const std::shared_ptr<worker::Worker>& worker) {
       m_timerPopQueues.push_back(utils::FastQueue<CoroutineHandle>());
     break;
 
+    case worker::Worker::Type::BLOCKING:
+      m_blockingWorkers.push_back(worker);
+      m_blockingPopQueues.push_back(utils::FastQueue<CoroutineHandle>());
+    break;
+
     case worker::Worker::Type::PROCESSOR:
     case worker::Worker::Type::TYPES_COUNT:
     default:
@@ -52,6 +106,12 @@ void Processor::addWorker(const std::shared_ptr<worker::Worker>& worker) {
 
 }
 
+void Processor::addPeer(Processor* peer) {
+  if(peer != this) {
+    m_peers.push_back(peer);
+  }
+}
+
 void Processor::popIOTask(CoroutineHandle* coroutine) {
   if(m_ioPopQueues.size() > 0) {
     auto &queue = m_ioPopQueues[(++m_ioBalancer) % m_ioPopQueues.size()];
@@ -72,6 +132,15 @@ void Processor::popTimerTask(CoroutineHandle* coroutine) {
   }
 }
 
+void Processor::popBlockingTask(CoroutineHandle* coroutine) {
+  if(m_blockingPopQueues.size() > 0) {
+    auto &queue = m_blockingPopQueues[(++m_blockingBalancer) % m_blockingPopQueues.size()];
+    queue.pushBack(coroutine);
+  } else {
+    throw std::runtime_error("[oatpp::async::Processor::popBlockingTask()]: Error. Processor has no Blocking workers.");
+  }
+}
+
 void Processor::addCoroutine(CoroutineHandle* coroutine) {
 
   if(coroutine->_PP == this) {
@@ -95,6 +164,11 @@ void Processor::addCoroutine(CoroutineHandle* coroutine) {
         popTimerTask(coroutine);
         break;
 
+      case Action::TYPE_BLOCKING:
+        coroutine->_SCH_A = Action::clone(action);
+        popBlockingTask(coroutine);
+        break;
+
       case Action::TYPE_WAIT_LIST:
         coroutine->_SCH_A = Action::clone(action);
         putCoroutineToSleep(coroutine);
@@ -102,7 +176,7 @@ void Processor::addCoroutine(CoroutineHandle* coroutine) {
         break;
 
       default:
-        m_queue.pushBack(coroutine);
+        schedule(coroutine);
 
     }
 
@@ -113,27 +187,52 @@ void Processor::addCoroutine(CoroutineHandle* coroutine) {
 }
 
 void Processor::pushOneTask(CoroutineHandle* coroutine) {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    m_pushList.pushBack(coroutine);
-  }
-  m_taskCondition.notify_one();
+  coroutine->_QT = getSteadyMicroseconds();
+  m_pushQueue.push(coroutine);
+  m_parker.unpark();
 }
 
 void Processor::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    utils::FastQueue<CoroutineHandle>::moveAll(tasks, m_pushList);
+  v_int64 now = getSteadyMicroseconds();
+  for(auto coroutine = tasks.first; coroutine != nullptr; coroutine = coroutine->_ref) {
+    coroutine->_QT = now;
   }
-  m_taskCondition.notify_one();
+  m_pushQueue.pushAll(tasks);
+  m_parker.unpark();
+}
+
+bool Processor::hasPendingWork() {
+  return !m_pushQueue.empty() || m_hasSubmissions || !m_running || m_stealRequested;
 }
 
 void Processor::waitForTasks() {
 
-  std::unique_lock<oatpp::concurrency::SpinLock> lock(m_taskLock);
-  while (m_pushList.first == nullptr && m_taskList.empty() && m_running) {
-    m_taskCondition.wait(lock);
+  m_idle = true;
+  while (!hasPendingWork()) {
+
+    v_int64 nextTimeout = m_nextSleepTimeout;
+    v_int64 now = 0;
+    if(nextTimeout != 0) {
+      now = getSteadyMicroseconds();
+      if(now >= nextTimeout) {
+        break;
+      }
+    }
+
+    m_parker.prepare();
+    if(hasPendingWork()) {
+      m_parker.cancel();
+      break;
+    }
+
+    if(nextTimeout == 0) {
+      m_parker.park();
+    } else {
+      m_parker.park(std::chrono::microseconds(nextTimeout - now));
+    }
+
   }
+  m_idle = false;
 
 }
 
@@ -151,148 +250,373 @@ void Processor::popTasks() {
     worker->pushTasks(popQueue);
   }
 
+  for(size_t i = 0; i < m_blockingWorkers.size(); i++) {
+    auto& worker = m_blockingWorkers[i];
+    auto& popQueue = m_blockingPopQueues[i];
+    // blocking worker locks a mutex - don't touch it when there is nothing to push
+    if(popQueue.first != nullptr) {
+      worker->pushTasks(popQueue);
+    }
+  }
+
+}
+
+void Processor::schedule(CoroutineHandle* coroutine) {
+  m_queues[static_cast<v_int32>(coroutine->_PRI)].pushBack(coroutine);
+}
+
+v_int32 Processor::pickQueue() {
+
+  if(m_scheduling.policy == SCHEDULING_STRICT_PRIORITY) {
+    for(v_int32 i = 0; i < PRIORITY_CLASSES; i ++) {
+      if(m_queues[i].first != nullptr) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  v_int32 result = -1;
+  for(v_int32 i = 0; i < PRIORITY_CLASSES; i ++) {
+    if(m_queues[i].first == nullptr) {
+      // idle class doesn't accumulate credit - otherwise it would monopolize the processor once it has work again
+      if(m_passes[i] < m_virtualTime) {
+        m_passes[i] = m_virtualTime;
+      }
+    } else if(result < 0 || m_passes[i] < m_passes[result]) {
+      result = i;
+    }
+  }
+
+  if(result >= 0) {
+    m_virtualTime = m_passes[result];
+    m_passes[result] += m_strides[result];
+  }
+
+  return result;
+
+}
+
+v_int64 Processor::getQueuedCount() {
+  v_int64 result = 0;
+  for(v_int32 i = 0; i < PRIORITY_CLASSES; i ++) {
+    result += m_queues[i].count;
+  }
+  return result;
+}
+
+void Processor::recordQueueLatency(v_int32 priorityClass, v_int64 latency) {
+
+  auto& counters = m_latency[priorityClass];
+  auto value = static_cast<v_uint64>(latency > 0 ? latency : 0);
+
+  // owner is the only writer - no need for atomic read-modify-write
+  counters.count.store(counters.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  counters.totalMicroseconds.store(counters.totalMicroseconds.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+  if(value > counters.maxMicroseconds.load(std::memory_order_relaxed)) {
+    counters.maxMicroseconds.store(value, std::memory_order_relaxed);
+  }
+
 }
 
 void Processor::consumeAllTasks() {
   for(auto& submission : m_taskList) {
-    m_queue.pushBack(submission->createCoroutine(this));
+    auto coroutine = submission->createCoroutine(this);
+    coroutine->_PRI = submission->priority;
+    coroutine->_QT = submission->submitTime;
+    schedule(coroutine);
   }
   m_taskList.clear();
 }
 
 void Processor::pushQueues() {
 
-  utils::FastQueue<CoroutineHandle> tmpList;
-
-  {
+  if(m_hasSubmissions.exchange(false)) {
     std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
     consumeAllTasks();
-    utils::FastQueue<CoroutineHandle>::moveAll(m_pushList, tmpList);
   }
 
+  utils::FastQueue<CoroutineHandle> tmpList;
+  m_pushQueue.popAll(tmpList);
+
   while(tmpList.first != nullptr) {
     addCoroutine(tmpList.popFront());
   }
 
 }
 
+void Processor::reclaimStealable() {
+  CoroutineHandle* coroutine;
+  while((coroutine = m_stealable.pop()) != nullptr) {
+    schedule(coroutine);
+  }
+}
+
+void Processor::stealTasks() {
+
+  for(size_t i = 0; i < m_peers.size(); i ++) {
+
+    auto victim = m_peers[(m_stealBalancer + i) % m_peers.size()];
+
+    v_int32 stolen = 0;
+    CoroutineHandle* coroutine;
+    while((coroutine = victim->m_stealable.steal()) != nullptr) {
+      coroutine->_PP = this;
+      schedule(coroutine);
+      ++ stolen;
+    }
+
+    if(stolen > 0) {
+      // increment first so that the total tasks count never drops below the actual number of tasks
+      m_tasksCounter += stolen;
+      victim->m_tasksCounter -= stolen;
+      m_stolenFromPeers += static_cast<v_uint64>(stolen);
+      victim->m_stolenByPeers += static_cast<v_uint64>(stolen);
+      m_stealBalancer += static_cast<v_uint32>(i + 1);
+      return;
+    }
+
+  }
+
+}
+
+void Processor::shareTasks() {
+
+  v_int64 queuedCount = getQueuedCount();
+  if(queuedCount < 2 || !m_stealable.empty()) {
+    return;
+  }
+
+  Processor* idlePeer = nullptr;
+  for(auto peer : m_peers) {
+    if(peer->m_idle) {
+      idlePeer = peer;
+      break;
+    }
+  }
+
+  if(idlePeer == nullptr) {
+    return;
+  }
+
+  v_int64 capacity = m_stealable.getCapacity();
+
+  // share half of each priority class so that the peer gets the same mix of work
+  for(v_int32 i = 0; i < PRIORITY_CLASSES && capacity > 0; i ++) {
+    auto& queue = m_queues[i];
+    v_int64 count = queue.count / 2;
+    if(count > capacity) {
+      count = capacity;
+    }
+    for(v_int64 j = 0; j < count; j ++) {
+      m_stealable.push(queue.popFront());
+    }
+    capacity -= count;
+  }
+
+  idlePeer->requestSteal();
+
+}
+
+void Processor::requestSteal() {
+  m_stealRequested = true;
+  m_parker.unpark();
+}
+
+v_int64 Processor::getSteadyMicroseconds() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 void Processor::putCoroutineToSleep(CoroutineHandle* ch) {
-  if(ch->_SCH_A.m_data.waitListData.timePointMicroseconds == 0) {
-    std::lock_guard<std::mutex> lock(m_sleepMutex);
-    m_sleepNoTimeSet.insert(ch);
-  } else {
-    std::lock_guard<std::mutex> lock(m_sleepMutex);
-    m_sleepTimeSet.insert(ch);
-    m_sleepCV.notify_one();
+
+  auto& timePoint = ch->_SCH_A.m_data.waitListData.timePointMicroseconds;
+  if(timePoint == 0) {
+    return;
   }
+
+  // wait-list timeout is in system clock - convert it to the steady clock once.
+  v_int64 systemNow = std::chrono::duration_cast<std::chrono::microseconds>
+    (std::chrono::system_clock::now().time_since_epoch()).count();
+  v_int64 deadline = getSteadyMicroseconds() + (timePoint - systemNow);
+  timePoint = deadline > 0 ? deadline : 1;
+
+  std::lock_guard<std::mutex> lock(m_sleepMutex);
+  m_sleepTimeSet.insert({timePoint, ch});
+  m_nextSleepTimeout = m_sleepTimeSet.begin()->first;
+
 }
 
 void Processor::wakeCoroutine(CoroutineHandle* ch) {
-  if(ch->_SCH_A.m_data.waitListData.timePointMicroseconds == 0) {
-    std::lock_guard<std::mutex> lock(m_sleepMutex);
-    m_sleepNoTimeSet.erase(ch);
-  } else {
+  v_int64 timePoint = ch->_SCH_A.m_data.waitListData.timePointMicroseconds;
+  if(timePoint != 0) {
     std::lock_guard<std::mutex> lock(m_sleepMutex);
-    m_sleepTimeSet.erase(ch);
+    m_sleepTimeSet.erase({timePoint, ch});
   }
   ch->_SCH_A = Action::createActionByType(Action::TYPE_NONE);
   pushOneTask(ch);
 }
 
 void Processor::checkCoroutinesSleep() {
-  while (m_running) {
-    {
-      std::unique_lock<std::mutex> lock{m_sleepMutex};
-      while (m_running && m_sleepTimeSet.empty()) {
-        m_sleepCV.wait(lock);
-      }
 
-      auto now = oatpp::Environment::getMicroTickCount();
-      for(auto it = m_sleepTimeSet.begin(); it != m_sleepTimeSet.end();) {
-        auto ch = *it;
-        if(ch->_SCH_A.m_data.waitListData.timePointMicroseconds < now) {
-          it = m_sleepTimeSet.erase(it);
-          ch->_SCH_A.m_data.waitListData.waitList->forgetCoroutine(ch);
-          ch->_SCH_A = Action::createActionByType(Action::TYPE_NONE);
-          pushOneTask(ch);
-        } else {
-          it ++;
-        }
-      }
+  v_int64 nextTimeout = m_nextSleepTimeout;
+  if(nextTimeout == 0) {
+    return;
+  }
 
+  v_int64 now = getSteadyMicroseconds();
+  if(now < nextTimeout) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_sleepMutex);
+
+  while(!m_sleepTimeSet.empty()) {
+
+    auto it = m_sleepTimeSet.begin();
+    if(it->first > now) {
+      break;
     }
 
-    if(m_running) std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    auto ch = it->second;
+
+    // Wait-list is alive while the coroutine is in m_sleepTimeSet - its notifier removes it from here under the wait-list lock.
+    // Lock order is wait-list -> m_sleepMutex. So here only try-lock the wait-list and back off if it's busy.
+    if(!ch->_SCH_A.m_data.waitListData.waitList->tryForgetCoroutine(ch)) {
+      lock.unlock();
+      std::this_thread::yield();
+      lock.lock();
+      continue;
+    }
+
+    m_sleepTimeSet.erase(it);
+    ch->_SCH_A = Action::createActionByType(Action::TYPE_NONE);
+    ch->_QT = now;
+    schedule(ch);
+
   }
+
+  m_nextSleepTimeout = m_sleepTimeSet.empty() ? 0 : m_sleepTimeSet.begin()->first;
+
 }
 
 bool Processor::iterate(v_int32 numIterations) {
 
   pushQueues();
+  checkCoroutinesSleep();
+
+  m_stealRequested = false;
+  if(getQueuedCount() == 0) {
+    reclaimStealable();
+    if(getQueuedCount() == 0) {
+      stealTasks();
+    }
+  }
 
   for(v_int32 i = 0; i < numIterations; i++) {
 
-    auto CP = m_queue.first;
-    if (CP == nullptr) {
+    v_int32 priorityClass = pickQueue();
+    if (priorityClass < 0) {
       break;
     }
+
+    auto& queue = m_queues[priorityClass];
+    auto CP = queue.first;
     if (CP->finished()) {
-      m_queue.popFrontNoData();
+      queue.popFrontNoData();
       -- m_tasksCounter;
     } else {
 
+      if(CP->_QT != 0) {
+        recordQueueLatency(priorityClass, getSteadyMicroseconds() - CP->_QT);
+        CP->_QT = 0;
+      }
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+      t_currentPriority = CP->_PRI;
+#endif
+
       const Action &action = CP->iterateAndTakeAction();
 
       switch (action.m_type) {
 
         case Action::TYPE_IO_WAIT:
           CP->_SCH_A = Action::clone(action);
-          m_queue.popFront();
+          queue.popFront();
           popIOTask(CP);
           break;
 
         case Action::TYPE_WAIT_REPEAT:
           CP->_SCH_A = Action::clone(action);
-          m_queue.popFront();
+          queue.popFront();
           popTimerTask(CP);
           break;
 
+        case Action::TYPE_BLOCKING:
+          CP->_SCH_A = Action::clone(action);
+          queue.popFront();
+          popBlockingTask(CP);
+          break;
+
         case Action::TYPE_WAIT_LIST:
           CP->_SCH_A = Action::clone(action);
-          m_queue.popFront();
+          queue.popFront();
           putCoroutineToSleep(CP);
           action.m_data.waitListData.waitList->add(CP);
           break;
 
         default:
-          m_queue.round();
+          queue.round();
       }
 
     }
 
   }
 
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  t_currentPriority = Priority::NORMAL;
+#endif
+
   popTasks();
 
-  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-  return m_queue.first != nullptr || m_pushList.first != nullptr || !m_taskList.empty();
+  if(!m_peers.empty()) {
+    shareTasks();
+  }
+
+  return getQueuedCount() > 0 || !m_pushQueue.empty() || m_hasSubmissions || !m_stealable.empty();
   
 }
 
 void Processor::stop() {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    m_running = false;
-  }
-  m_taskCondition.notify_one();
-  m_sleepCV.notify_one();
-
-  m_sleepSetTask.join();
-
+  m_running = false;
+  m_parker.unpark();
 }
 
 v_int32 Processor::getTasksCount() {
   return m_tasksCounter.load();
 }
 
+Processor::StealStats Processor::getStealStats() const {
+  return {m_stolenFromPeers.load(), m_stolenByPeers.load()};
+}
+
+std::vector<Processor::QueueLatencyStats> Processor::getQueueLatencyStats() const {
+  std::vector<QueueLatencyStats> result;
+  result.reserve(PRIORITY_CLASSES);
+  for(v_int32 i = 0; i < PRIORITY_CLASSES; i ++) {
+    auto& counters = m_latency[i];
+    result.push_back({counters.count.load(std::memory_order_relaxed),
+                      counters.totalMicroseconds.load(std::memory_order_relaxed),
+                      counters.maxMicroseconds.load(std::memory_order_relaxed)});
+  }
+  return result;
+}
+
+Priority Processor::getCurrentPriority() {
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  return t_currentPriority;
+#else
+  return Priority::NORMAL;
+#endif
+}
+
 }}
@@ -29,6 +29,10 @@
 #include "./Coroutine.hpp"
 #include "./CoroutineWaitList.hpp"
 #include "oatpp/async/utils/FastQueue.hpp"
+#include "oatpp/async/utils/MPSCQueue.hpp"
+#include "oatpp/async/utils/SlabAllocator.hpp"
+#include "oatpp/async/utils/WorkStealingDeque.hpp"
+#include "oatpp/concurrency/Parker.hpp"
 #include "oatpp/concurrency/SpinLock.hpp"
 
 #include <thread>
@@ -47,9 +51,102 @@ namespace oatpp { namespace async {
  */
 class Processor {
     friend class CoroutineWaitList;
+public:
+
+  /**
+   * Work-stealing statistics of the processor.
+   */
+  struct StealStats {
+
+    /**
+     * Number of coroutines this processor has taken from its peers.
+     */
+    v_uint64 stolenFromPeers;
+
+    /**
+     * Number of coroutines peers have taken from this processor.
+     */
+    v_uint64 stolenByPeers;
+
+  };
+
+public:
+
+  /**
+   * Number of priority classes. See &id:oatpp::async::Priority;.
+   */
+  static constexpr const v_int32 PRIORITY_CLASSES = 3;
+
+  /**
+   * Weighted-fair scheduling. Each priority class gets a share of processor steps proportional to its weight.
+   * Lower classes are never starved.
+   */
+  static constexpr const v_int32 SCHEDULING_WEIGHTED_FAIR = 0;
+
+  /**
+   * Strict-priority scheduling. A coroutine is run only when there are no runnable coroutines of higher classes.
+   */
+  static constexpr const v_int32 SCHEDULING_STRICT_PRIORITY = 1;
+
+  /**
+   * Scheduling policy of the processor.
+   */
+  struct Scheduling {
+
+    /**
+     * &l:Processor::SCHEDULING_WEIGHTED_FAIR; or &l:Processor::SCHEDULING_STRICT_PRIORITY;.
+     */
+    v_int32 policy = SCHEDULING_WEIGHTED_FAIR;
+
+    /**
+     * Weights of priority classes indexed by &id:oatpp::async::Priority;. Used by weighted-fair scheduling only.
+     * Must be greater than zero.
+     */
+    v_uint32 weights[PRIORITY_CLASSES] = {16, 4, 1};
+
+  };
+
+  /**
+   * Queueing latency of a priority class - time from a coroutine becoming runnable
+   * (submitted, woken up by I/O, timer or wait-list) till the processor runs it.
+   */
+  struct QueueLatencyStats {
+
+    /**
+     * Number of measured dispatches.
+     */
+    v_uint64 count;
+
+    /**
+     * Sum of measured latencies in microseconds.
+     */
+    v_uint64 totalMicroseconds;
+
+    /**
+     * Max measured latency in microseconds.
+     */
+    v_uint64 maxMicroseconds;
+
+  };
+
+private:
+
+  /**
+   * Max number of coroutines exposed to peers at once.
+   */
+  static constexpr v_int64 STEALABLE_CAPACITY = 1024;
+
+  /**
+   * Stride of a priority class with weight 1 (weighted-fair scheduling).
+   */
+  static constexpr v_uint64 STRIDE_BASE = 1 << 20;
+
 private:
 
   class TaskSubmission {
+  public:
+    Priority priority = Priority::NORMAL;
+    v_int64 submitTime = 0;
   public:
     virtual ~TaskSubmission() = default;
     virtual CoroutineHandle* createCoroutine(Processor* processor) = 0;
@@ -94,53 +191,135 @@ private:
 
   std::vector<std::shared_ptr<worker::Worker>> m_ioWorkers;
   std::vector<std::shared_ptr<worker::Worker>> m_timerWorkers;
+  std::vector<std::shared_ptr<worker::Worker>> m_blockingWorkers;
 
   std::vector<utils::FastQueue<CoroutineHandle>> m_ioPopQueues;
   std::vector<utils::FastQueue<CoroutineHandle>> m_timerPopQueues;
+  std::vector<utils::FastQueue<CoroutineHandle>> m_blockingPopQueues;
 
   v_uint32 m_ioBalancer = 0;
   v_uint32 m_timerBalancer = 0;
+  v_uint32 m_blockingBalancer = 0;
 
 private:
 
-  std::unordered_set<CoroutineHandle*> m_sleepNoTimeSet;
-  std::unordered_set<CoroutineHandle*> m_sleepTimeSet;
+  /*
+   * Coroutines waiting on wait-lists with timeout ordered by deadline (steady clock microseconds).
+   * Timeouts are checked by the processor itself - it parks no longer than till the earliest deadline.
+   */
+  std::set<std::pair<v_int64, CoroutineHandle*>> m_sleepTimeSet;
   std::mutex m_sleepMutex;
-  std::condition_variable m_sleepCV;
+  std::atomic<v_int64> m_nextSleepTimeout{0};
 
 private:
 
   oatpp::concurrency::SpinLock m_taskLock;
-  std::condition_variable_any m_taskCondition;
   std::list<std::shared_ptr<TaskSubmission>> m_taskList;
-  utils::FastQueue<CoroutineHandle> m_pushList;
+  std::atomic_bool m_hasSubmissions{false};
+  utils::MPSCQueue<CoroutineHandle> m_pushQueue;
+  oatpp::concurrency::Parker m_parker;
 
 private:
 
-  utils::FastQueue<CoroutineHandle> m_queue;
+  /*
+   * Run queues - one per priority class.
+   * Weighted-fair scheduling is stride scheduling: the non-empty class with the smallest pass runs next
+   * and its pass advances by its stride (inversely proportional to weight).
+   */
+  utils::FastQueue<CoroutineHandle> m_queues[PRIORITY_CLASSES];
+  Scheduling m_scheduling;
+  v_uint64 m_strides[PRIORITY_CLASSES];
+  v_uint64 m_passes[PRIORITY_CLASSES];
+  v_uint64 m_virtualTime = 0;
+
+private:
+
+  struct LatencyCounters {
+    std::atomic<v_uint64> count{0};
+    std::atomic<v_uint64> totalMicroseconds{0};
+    std::atomic<v_uint64> maxMicroseconds{0};
+  };
+
+  LatencyCounters m_latency[PRIORITY_CLASSES];
+
+private:
+
+  utils::WorkStealingDeque<CoroutineHandle> m_stealable{STEALABLE_CAPACITY};
+  std::vector<Processor*> m_peers;
+  v_uint32 m_stealBalancer = 0;
+  std::atomic_bool m_idle{false};
+  std::atomic_bool m_stealRequested{false};
+  std::atomic<v_uint64> m_stolenFromPeers{0};
+  std::atomic<v_uint64> m_stolenByPeers{0};
+
+private:
+  utils::SlabAllocator::Pool* m_allocatorPool;
 
 private:
   std::atomic_bool m_running{true};
   std::atomic<v_int32> m_tasksCounter{0};
-  std::thread m_sleepSetTask{&Processor::checkCoroutinesSleep, this};
 
 private:
 
   void popIOTask(CoroutineHandle* coroutine);
   void popTimerTask(CoroutineHandle* coroutine);
+  void popBlockingTask(CoroutineHandle* coroutine);
+
+  template<typename CoroutineType, typename ... Args>
+  void submit(Priority priority, Args... params) {
+    if(static_cast<v_int32>(priority) < 0 || static_cast<v_int32>(priority) >= PRIORITY_CLASSES) {
+      throw std::runtime_error("[oatpp::async::Processor::execute()]: Error. Invalid priority class.");
+    }
+    auto submission = std::make_shared<SubmissionTemplate<CoroutineType, Args...>>(params...);
+    submission->priority = priority;
+    submission->submitTime = getSteadyMicroseconds();
+    ++ m_tasksCounter;
+    {
+      std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
+      m_taskList.push_back(submission);
+      m_hasSubmissions = true;
+    }
+    m_parker.unpark();
+  }
+
+  void schedule(CoroutineHandle* coroutine);
+  v_int32 pickQueue();
+  v_int64 getQueuedCount();
+  void recordQueueLatency(v_int32 priorityClass, v_int64 latency);
 
   void consumeAllTasks();
   void addCoroutine(CoroutineHandle* coroutine);
   void popTasks();
   void pushQueues();
+  bool hasPendingWork();
 
+  void reclaimStealable();
+  void stealTasks();
+  void shareTasks();
+  void requestSteal();
+
+  static v_int64 getSteadyMicroseconds();
   void putCoroutineToSleep(CoroutineHandle* ch);
   void wakeCoroutine(CoroutineHandle* ch);
   void checkCoroutinesSleep();
 
 public:
 
-  Processor() = default;
+  /**
+   * Constructor. Weighted-fair scheduling with default weights.
+   */
+  Processor();
+
+  /**
+   * Constructor.
+   * @param scheduling - &l:Processor::Scheduling;.
+   */
+  Processor(const Scheduling& scheduling);
+
+  /**
+   * Non-virtual Destructor.
+   */
+  ~Processor();
 
   /**
    * Add dedicated co-worker to processor.
@@ -148,6 +327,27 @@ public:
    */
   void addWorker(const std::shared_ptr<worker::Worker>& worker);
 
+  /**
+   * Add peer processor to exchange runnable coroutines with. <br>
+   * When this processor is loaded and the peer is idle, the peer steals part of this processor's run queue.
+   * Coroutines waiting for I/O, timers or wait-lists are never migrated. <br>
+   * *Must be called before any tasks are submitted to processors.*
+   * @param peer - &id:oatpp::async::Processor;. Must outlive this processor's iterations.
+   */
+  void addPeer(Processor* peer);
+
+  /**
+   * Bind processor's coroutine allocator pool (&id:oatpp::async::utils::SlabAllocator;) to the calling thread.<br>
+   * Must be called from the thread iterating this processor. Coroutines created on that thread are then allocated
+   * from the processor's pool.
+   */
+  void attachAllocator();
+
+  /**
+   * Unbind coroutine allocator pool from the calling thread.
+   */
+  void detachAllocator();
+
   /**
    * Push one Coroutine back to processor.
    * @param coroutine - &id:oatpp::async::CoroutineHandle; previously popped-out(rescheduled to coworker) from this processor.
@@ -168,13 +368,19 @@ public:
    */
   template<typename CoroutineType, typename ... Args>
   void execute(Args... params) {
-    auto submission = std::make_shared<SubmissionTemplate<CoroutineType, Args...>>(params...);
-    ++ m_tasksCounter;
-    {
-      std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-      m_taskList.push_back(submission);
-    }
-    m_taskCondition.notify_one();
+    submit<CoroutineType, Args...>(getCurrentPriority(), params...);
+  }
+
+  /**
+   * Execute Coroutine with specified priority class.
+   * @tparam CoroutineType - type of coroutine to execute.
+   * @tparam Args - types of arguments to be passed to Coroutine constructor.
+   * @param priority - &id:oatpp::async::Priority;.
+   * @param params - actual arguments to be passed to Coroutine constructor.
+   */
+  template<typename CoroutineType, typename ... Args>
+  void execute(Priority priority, Args... params) {
+    submit<CoroutineType, Args...>(priority, params...);
   }
 
   /**
@@ -200,6 +406,23 @@ public:
    */
   v_int32 getTasksCount();
 
+  /**
+   * Get work-stealing statistics.
+   * @return - &l:Processor::StealStats;.
+   */
+  StealStats getStealStats() const;
+
+  /**
+   * Get queueing latency statistics.
+   * @return - vector of &l:Processor::QueueLatencyStats; indexed by &id:oatpp::async::Priority;.
+   */
+  std::vector<QueueLatencyStats> getQueueLatencyStats() const;
+
+  /**
+   * Get priority class of the coroutine currently running on the calling thread.
+   * @return - &id:oatpp::async::Priority;. &id:oatpp::async::Priority::NORMAL; if called not from a coroutine.
+   */
+  static Priority getCurrentPriority();
   
 };
   
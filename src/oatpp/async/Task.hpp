@@ -0,0 +1,619 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_Task_hpp
+#define oatpp_async_Task_hpp
+
+#include "./Coroutine.hpp"
+
+/*
+ * Opt-in C++20 co_await bridge.
+ * The library itself is built as C++17 - the bridge is header-only and is available to C++20 translation units.
+ */
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+  #if __has_include(<coroutine>)
+    #define OATPP_ASYNC_TASK 1
+  #endif
+#endif
+
+#ifdef OATPP_ASYNC_TASK
+
+#include <coroutine>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+namespace oatpp { namespace async {
+
+template<typename T>
+class Task; // FWD
+
+template<typename T>
+class TaskCoroutine; // FWD
+
+/**
+ * Type traits of &l:Task;.
+ * @tparam T - result type.
+ */
+template<typename T>
+struct TaskTraits {
+
+  /**
+   * Base class of the coroutine running the task.
+   */
+  typedef AbstractCoroutineWithResult<const T&> CoroutineBase;
+
+};
+
+template<>
+struct TaskTraits<void> {
+  typedef AbstractCoroutine CoroutineBase;
+};
+
+/**
+ * Common part of &l:Task; promise.<br>
+ * Defines what can be `co_await`-ed inside a task:
+ * <ul>
+ *   <li>&id:oatpp::async::CoroutineStarter; - runs coroutine(s) and resumes the task when they finish.</li>
+ *   <li>&id:oatpp::async::CoroutineStarterForResult; - same, `co_await` evaluates to the coroutine result.</li>
+ *   <li>&l:Task; - nested task. It runs within the same &l:TaskCoroutine; as the caller - like a function call,
+ *   without extra coroutine and without going through the processor queue. `co_await` evaluates to its result.</li>
+ *   <li>&id:oatpp::async::Action; - any action taken by the processor on the task's behalf.
+ *   Ex.: `AbstractCoroutine::ioWait(...)` for I/O readiness, `AbstractCoroutine::waitRepeat(...)` to sleep,
+ *   `AbstractCoroutine::repeat()` to yield.</li>
+ * </ul>
+ * Errors of awaited coroutines and exceptions of nested tasks are rethrown from `co_await`.<br>
+ * Task frames are allocated by &id:oatpp::async::utils::SlabAllocator; - from the processor's pool when created on a processor thread.
+ */
+class TaskPromiseBase {
+  template<typename T>
+  friend class TaskCoroutine;
+protected:
+
+  /*
+   * State shared by all frames running within one TaskCoroutine.
+   */
+  struct Context {
+    std::coroutine_handle<> current;
+    Action action; // action to be taken by processor on behalf of the suspended frame
+    bool hasAction = false;
+    bool awaitingChild = false;
+    std::exception_ptr childError;
+  };
+
+public:
+
+  /**
+   * Awaiter of &id:oatpp::async::CoroutineStarter;.
+   */
+  class StarterAwaiter {
+  private:
+    CoroutineStarter m_starter;
+    Context* m_context;
+  public:
+
+    StarterAwaiter(CoroutineStarter&& starter)
+      : m_starter(std::move(starter))
+      , m_context(nullptr)
+    {}
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    template<typename P>
+    void await_suspend(std::coroutine_handle<P> handle) {
+      m_context = handle.promise().m_context;
+      m_context->action = m_starter.next(resumeAction());
+      m_context->hasAction = true;
+      m_context->awaitingChild = true;
+    }
+
+    void await_resume() {
+      rethrowChildError(m_context);
+    }
+
+  };
+
+  /**
+   * Awaiter of &id:oatpp::async::CoroutineStarterForResult;.
+   * @tparam Args - result arguments.
+   */
+  template<typename ...Args>
+  class ResultAwaiter {
+  public:
+    typedef std::tuple<typename std::decay<Args>::type...> Result;
+  private:
+
+    class Receiver : public AbstractCoroutine::AbstractMemberCaller<Args...> {
+    private:
+      std::optional<Result>* m_result;
+    public:
+
+      Receiver(std::optional<Result>* result)
+        : m_result(result)
+      {}
+
+      Action call(AbstractCoroutine* coroutine, const Args&... args) override {
+        (void)coroutine;
+        m_result->emplace(args...);
+        return resumeAction();
+      }
+
+    };
+
+  private:
+    CoroutineStarterForResult<Args...> m_starter;
+    std::optional<Result> m_result;
+    Context* m_context;
+  public:
+
+    ResultAwaiter(CoroutineStarterForResult<Args...>&& starter)
+      : m_starter(std::move(starter))
+      , m_context(nullptr)
+    {}
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    template<typename P>
+    void await_suspend(std::coroutine_handle<P> handle) {
+      m_context = handle.promise().m_context;
+      m_context->action = m_starter.callbackTo(std::unique_ptr<AbstractCoroutine::AbstractMemberCaller<Args...>>(new Receiver(&m_result)));
+      m_context->hasAction = true;
+      m_context->awaitingChild = true;
+    }
+
+    auto await_resume() {
+      rethrowChildError(m_context);
+      if constexpr (sizeof...(Args) == 0) {
+        return;
+      } else if constexpr (sizeof...(Args) == 1) {
+        return std::get<0>(std::move(*m_result));
+      } else {
+        return std::move(*m_result);
+      }
+    }
+
+  };
+
+  /**
+   * Awaiter of nested &l:Task;.
+   * @tparam U - result type.
+   */
+  template<typename U>
+  class TaskAwaiter {
+  private:
+    Task<U> m_task;
+  public:
+
+    TaskAwaiter(Task<U>&& task)
+      : m_task(std::move(task))
+    {}
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    template<typename P>
+    void await_suspend(std::coroutine_handle<P> handle) {
+      auto& child = m_task.m_handle.promise();
+      child.m_context = handle.promise().m_context;
+      child.m_continuation = handle;
+      // TaskCoroutine resumes the child as soon as the caller is suspended
+      child.m_context->current = m_task.m_handle;
+    }
+
+    U await_resume() {
+      auto& child = m_task.m_handle.promise();
+      if(child.m_exception) {
+        std::rethrow_exception(child.m_exception);
+      }
+      if constexpr (!std::is_void<U>::value) {
+        return std::move(*child.m_value);
+      }
+    }
+
+  };
+
+  /**
+   * Awaiter of &id:oatpp::async::Action;.
+   */
+  class ActionAwaiter {
+  private:
+    Action m_action;
+  public:
+
+    ActionAwaiter(Action&& action)
+      : m_action(std::move(action))
+    {}
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    template<typename P>
+    void await_suspend(std::coroutine_handle<P> handle) {
+      Context* context = handle.promise().m_context;
+      context->action = std::move(m_action);
+      context->hasAction = true;
+    }
+
+    void await_resume() const noexcept {}
+
+  };
+
+  /**
+   * Final awaiter - hands control back to the awaiting task (if any).
+   */
+  class FinalAwaiter {
+  public:
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    template<typename P>
+    void await_suspend(std::coroutine_handle<P> handle) noexcept {
+      auto& promise = handle.promise();
+      if(promise.m_continuation) {
+        promise.m_context->current = promise.m_continuation;
+      }
+    }
+
+    void await_resume() const noexcept {}
+
+  };
+
+private:
+
+  static Action resumeAction() {
+    return Action(&AbstractCoroutine::act);
+  }
+
+  static void rethrowChildError(Context* context) {
+    context->awaitingChild = false;
+    if(context->childError) {
+      std::exception_ptr error = context->childError;
+      context->childError = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  template<typename ...Args>
+  static ResultAwaiter<Args...> makeResultAwaiter(AbstractCoroutineWithResult<Args...>*, CoroutineStarterForResult<Args...>&& starter) {
+    return ResultAwaiter<Args...>(std::move(starter));
+  }
+
+protected:
+  Context* m_context = nullptr;
+  std::coroutine_handle<> m_continuation;
+  std::exception_ptr m_exception;
+public:
+
+  static void* operator new(std::size_t sz) {
+    return utils::SlabAllocator::allocate(sz);
+  }
+
+  static void operator delete(void* ptr) {
+    utils::SlabAllocator::deallocate(ptr);
+  }
+
+public:
+
+  std::suspend_always initial_suspend() const noexcept {
+    return {};
+  }
+
+  FinalAwaiter final_suspend() const noexcept {
+    return {};
+  }
+
+  void unhandled_exception() {
+    m_exception = std::current_exception();
+  }
+
+  StarterAwaiter await_transform(CoroutineStarter&& starter) {
+    return StarterAwaiter(std::move(starter));
+  }
+
+  template<typename Starter, typename = typename Starter::CoroutineType>
+  auto await_transform(Starter&& starter) {
+    return makeResultAwaiter(static_cast<typename Starter::CoroutineType*>(nullptr), std::move(starter));
+  }
+
+  template<typename U>
+  TaskAwaiter<U> await_transform(Task<U>&& task) {
+    return TaskAwaiter<U>(std::move(task));
+  }
+
+  ActionAwaiter await_transform(Action&& action) {
+    return ActionAwaiter(std::move(action));
+  }
+
+};
+
+/**
+ * Promise of &l:Task; with result.
+ * @tparam T - result type.
+ */
+template<typename T>
+class TaskPromise : public TaskPromiseBase {
+  friend TaskPromiseBase;
+  friend TaskCoroutine<T>;
+private:
+  std::optional<T> m_value;
+public:
+
+  Task<T> get_return_object() {
+    return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+  }
+
+  template<typename V>
+  void return_value(V&& value) {
+    m_value.emplace(std::forward<V>(value));
+  }
+
+};
+
+/**
+ * Promise of &l:Task; without result.
+ */
+template<>
+class TaskPromise<void> : public TaskPromiseBase {
+public:
+
+  Task<void> get_return_object();
+
+  void return_void() const noexcept {}
+
+};
+
+/**
+ * C++20 coroutine running on &id:oatpp::async::Processor;.<br>
+ * Task is lazy - it starts when it is `co_await`-ed by another task, or when it is run by &l:TaskCoroutine;.
+ * Example:
+ * ```
+ * oatpp::async::Task<oatpp::String> readBody(std::shared_ptr<IncomingResponse> response) {
+ *   co_return co_await response->readBodyToStringAsync();
+ * }
+ *
+ * oatpp::async::Task<> getRoot(std::shared_ptr<MyClient> client) {
+ *   auto response = co_await client->getRootAsync();
+ *   auto body = co_await readBody(response);
+ *   OATPP_LOGd("Task", "body={}", body)
+ * }
+ *
+ * executor->execute<oatpp::async::TaskCoroutine<>>([client] { return getRoot(client); });
+ * ```
+ * @tparam T - result type.
+ */
+template<typename T = void>
+class Task {
+  friend TaskPromise<T>;
+  friend TaskPromiseBase;
+public:
+  typedef TaskPromise<T> promise_type;
+private:
+  std::coroutine_handle<promise_type> m_handle;
+private:
+
+  explicit Task(std::coroutine_handle<promise_type> handle)
+    : m_handle(handle)
+  {}
+
+public:
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  Task(Task&& other) noexcept
+    : m_handle(other.m_handle)
+  {
+    other.m_handle = nullptr;
+  }
+
+  Task& operator=(Task&& other) noexcept {
+    if(this != std::addressof(other)) {
+      if(m_handle) {
+        m_handle.destroy();
+      }
+      m_handle = other.m_handle;
+      other.m_handle = nullptr;
+    }
+    return *this;
+  }
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~Task() {
+    if(m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  /**
+   * Release ownership of the coroutine frame.
+   * @return
+   */
+  std::coroutine_handle<promise_type> release() noexcept {
+    auto handle = m_handle;
+    m_handle = nullptr;
+    return handle;
+  }
+
+  /**
+   * Wrap task into coroutine. Result (if any) is discarded.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  CoroutineStarter start() && {
+    return new TaskCoroutine<T>(std::move(*this));
+  }
+
+  /**
+   * Wrap task into coroutine for result.
+   * @return - &id:oatpp::async::CoroutineStarterForResult;.
+   */
+  template<typename U = T>
+  CoroutineStarterForResult<const U&> startForResult() && {
+    return new TaskCoroutine<T>(std::move(*this));
+  }
+
+};
+
+inline Task<void> TaskPromise<void>::get_return_object() {
+  return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+/**
+ * Coroutine running &l:Task; on &id:oatpp::async::Processor;.<br>
+ * Each processor iteration resumes the task till its next `co_await` of coroutine or action,
+ * and the awaited action is handed over to the processor - the same way as for classic coroutines.
+ * To run task on &id:oatpp::async::Executor; pass task factory:<br>
+ * `executor->execute<oatpp::async::TaskCoroutine<>>([]{ return myTask(); });` -
+ * task is then created on the processor thread and its frame comes from the processor's pool.
+ * @tparam T - result type.
+ */
+template<typename T = void>
+class TaskCoroutine : public TaskTraits<T>::CoroutineBase {
+public:
+  typedef TaskPromise<T> Promise;
+private:
+  std::coroutine_handle<Promise> m_handle;
+  TaskPromiseBase::Context m_context;
+private:
+
+  void init() {
+    m_handle.promise().m_context = &m_context;
+    m_context.current = m_handle;
+  }
+
+  Action step() {
+
+    // nested tasks switch frames without returning to processor
+    do {
+      m_context.current.resume();
+    } while(!m_context.hasAction && !m_handle.done());
+
+    if(m_context.hasAction) {
+      m_context.hasAction = false;
+      return std::move(m_context.action);
+    }
+
+    auto& promise = m_handle.promise();
+
+    if(promise.m_exception) {
+      return AbstractCoroutine::error(new Error(promise.m_exception));
+    }
+
+    if constexpr (!std::is_void<T>::value) {
+      if(this->m_parentMemberCaller) {
+        this->m_parentReturnAction = this->m_parentMemberCaller->call(this->getParent(), *promise.m_value);
+      }
+    }
+
+    return Action::createActionByType(Action::TYPE_FINISH);
+
+  }
+
+public:
+
+  static void* operator new(std::size_t sz) {
+    return utils::SlabAllocator::allocate(sz);
+  }
+
+  static void operator delete(void* ptr, std::size_t sz) {
+    (void)sz;
+    utils::SlabAllocator::deallocate(ptr);
+  }
+
+public:
+
+  /**
+   * Constructor.
+   * @param task - &l:Task;.
+   */
+  explicit TaskCoroutine(Task<T>&& task)
+    : m_handle(task.release())
+  {
+    init();
+  }
+
+  /**
+   * Constructor. Create task by calling `factory()`.
+   * @tparam F - factory type.
+   * @param factory - callable returning &l:Task;.
+   */
+  template<typename F, typename = typename std::enable_if<std::is_invocable_r<Task<T>, F&>::value>::type>
+  explicit TaskCoroutine(F factory)
+    : m_handle(factory().release())
+  {
+    init();
+  }
+
+  /**
+   * Virtual destructor. Destroys task frame together with frames of nested tasks.
+   */
+  ~TaskCoroutine() override {
+    if(m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  Action act() override {
+    return step();
+  }
+
+  Action call(const AbstractCoroutine::FunctionPtr& ptr) override {
+    (void)ptr;
+    return step();
+  }
+
+  /**
+   * Errors of awaited coroutines are passed to the task - rethrown from `co_await`.
+   * @param error - &id:oatpp::async::Error;.
+   * @return - &id:oatpp::async::Action;.
+   */
+  Action handleError(Error* error) override {
+    if(m_context.awaitingChild) {
+      if(error->getExceptionPtr()) {
+        m_context.childError = error->getExceptionPtr();
+      } else {
+        m_context.childError = std::make_exception_ptr(std::runtime_error(error->what()));
+      }
+      return TaskPromiseBase::resumeAction();
+    }
+    return AbstractCoroutine::handleError(error);
+  }
+
+};
+
+}}
+
+#endif // OATPP_ASYNC_TASK
+
+#endif /* oatpp_async_Task_hpp */
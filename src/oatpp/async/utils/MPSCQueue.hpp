@@ -0,0 +1,142 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_utils_MPSCQueue_hpp
+#define oatpp_async_utils_MPSCQueue_hpp
+
+#include "./FastQueue.hpp"
+
+#include <atomic>
+
+namespace oatpp { namespace async { namespace utils {
+
+/**
+ * Intrusive lock-free multi-producer single-consumer queue.<br>
+ * Entries are linked through their `_ref` field - same as in &id:oatpp::async::utils::FastQueue;.
+ * Producers push onto an atomic stack, the consumer takes the whole stack at once and restores FIFO order.
+ * @tparam T - entry type.
+ */
+template<typename T>
+class MPSCQueue {
+private:
+  std::atomic<T*> m_head;
+private:
+
+  void pushChain(T* head, T* tail) {
+    T* curr = m_head.load(std::memory_order_relaxed);
+    do {
+      tail->_ref = curr;
+    } while(!m_head.compare_exchange_weak(curr, head, std::memory_order_seq_cst, std::memory_order_relaxed));
+  }
+
+public:
+
+  MPSCQueue()
+    : m_head(nullptr)
+  {}
+
+  ~MPSCQueue() {
+    T* curr = m_head.load(std::memory_order_acquire);
+    while(curr != nullptr) {
+      T* next = curr->_ref;
+      delete curr;
+      curr = next;
+    }
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  /**
+   * Check if queue is empty. Thread-safe.
+   * @return
+   */
+  bool empty() const {
+    return m_head.load(std::memory_order_seq_cst) == nullptr;
+  }
+
+  /**
+   * Push one entry. Thread-safe.
+   * @param entry
+   */
+  void push(T* entry) {
+    pushChain(entry, entry);
+  }
+
+  /**
+   * Move all entries of the queue. Thread-safe.
+   * @param queue - &id:oatpp::async::utils::FastQueue;. Left empty.
+   */
+  void pushAll(FastQueue<T>& queue) {
+
+    if(queue.first == nullptr) {
+      return;
+    }
+
+    // the stack is reversed by the consumer - so link the chain backwards to keep the order.
+    T* tail = queue.first;
+    T* head = nullptr;
+    T* curr = queue.first;
+    while(curr != nullptr) {
+      T* next = curr->_ref;
+      curr->_ref = head;
+      head = curr;
+      curr = next;
+    }
+
+    queue.first = nullptr;
+    queue.last = nullptr;
+    queue.count = 0;
+
+    pushChain(head, tail);
+
+  }
+
+  /**
+   * Move all entries to the back of the queue in order they were pushed. Consumer thread only.
+   * @param queue - &id:oatpp::async::utils::FastQueue;.
+   */
+  void popAll(FastQueue<T>& queue) {
+
+    T* curr = m_head.exchange(nullptr, std::memory_order_acquire);
+    if(curr == nullptr) {
+      return;
+    }
+
+    FastQueue<T> tmp;
+    while(curr != nullptr) {
+      T* next = curr->_ref;
+      tmp.pushFront(curr);
+      curr = next;
+    }
+
+    FastQueue<T>::moveAll(tmp, queue);
+
+  }
+
+};
+
+}}}
+
+#endif /* oatpp_async_utils_MPSCQueue_hpp */
@@ -0,0 +1,267 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "SlabAllocator.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <unordered_set>
+#include <vector>
+
+namespace oatpp { namespace async { namespace utils {
+
+namespace {
+
+/*
+ * Header placed in front of every block.
+ * `pool` is nullptr for heap blocks. While block is in a free list the same word links it to the next free block.
+ */
+struct alignas(16) BlockHeader {
+  union {
+    SlabAllocator::Pool* pool;
+    BlockHeader* next;
+  };
+  v_uint32 sizeClass;
+};
+
+static_assert(sizeof(BlockHeader) == SlabAllocator::SIZE_CLASS_STEP, "BlockHeader must occupy exactly one size-class step");
+
+constexpr v_buff_size HEADER_SIZE = sizeof(BlockHeader);
+constexpr v_buff_size CLASSES_COUNT = SlabAllocator::MAX_BLOCK_SIZE / SlabAllocator::SIZE_CLASS_STEP;
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+thread_local SlabAllocator::Pool* t_currentPool = nullptr;
+#endif
+
+std::atomic<v_int64> g_heapAllocations(0);
+
+}
+
+class SlabAllocator::Pool {
+public:
+
+  /*
+   * Accessed by the owner thread only.
+   */
+  BlockHeader* freeLists[CLASSES_COUNT];
+  std::vector<void*> slabs;
+
+  /*
+   * Blocks freed by non-owner threads.
+   */
+  std::atomic<BlockHeader*> remoteFreeList;
+
+  /*
+   * One reference is held by the owner, plus one per allocated block.
+   */
+  std::atomic<v_int64> refs;
+
+  std::atomic<v_int64> allocations;
+  std::atomic<v_int64> remoteFrees;
+
+public:
+
+  Pool()
+    : remoteFreeList(nullptr)
+    , refs(1)
+    , allocations(0)
+    , remoteFrees(0)
+  {
+    for(v_buff_size i = 0; i < CLASSES_COUNT; i ++) {
+      freeLists[i] = nullptr;
+    }
+  }
+
+  ~Pool() {
+    for(void* slab : slabs) {
+      ::operator delete(slab);
+    }
+  }
+
+  void drainRemoteFrees() {
+    BlockHeader* curr = remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+    while(curr != nullptr) {
+      BlockHeader* next = curr->next;
+      curr->next = freeLists[curr->sizeClass];
+      freeLists[curr->sizeClass] = curr;
+      curr = next;
+    }
+  }
+
+  void addSlab(v_uint32 sizeClass) {
+    v_buff_size blockSize = (static_cast<v_buff_size>(sizeClass) + 1) * SIZE_CLASS_STEP;
+    auto slab = static_cast<v_char8*>(::operator new(static_cast<std::size_t>(SLAB_SIZE)));
+    slabs.push_back(slab);
+    for(v_buff_size offset = SLAB_SIZE - SLAB_SIZE % blockSize - blockSize; offset >= 0; offset -= blockSize) {
+      auto block = reinterpret_cast<BlockHeader*>(slab + offset);
+      block->sizeClass = sizeClass;
+      block->next = freeLists[sizeClass];
+      freeLists[sizeClass] = block;
+    }
+  }
+
+  BlockHeader* take(v_uint32 sizeClass) {
+    if(freeLists[sizeClass] == nullptr) {
+      drainRemoteFrees();
+      if(freeLists[sizeClass] == nullptr) {
+        addSlab(sizeClass);
+      }
+    }
+    BlockHeader* block = freeLists[sizeClass];
+    freeLists[sizeClass] = block->next;
+    return block;
+  }
+
+  void pushRemote(BlockHeader* block) {
+    BlockHeader* curr = remoteFreeList.load(std::memory_order_relaxed);
+    do {
+      block->next = curr;
+    } while(!remoteFreeList.compare_exchange_weak(curr, block, std::memory_order_release, std::memory_order_relaxed));
+    remoteFrees.fetch_add(1, std::memory_order_relaxed);
+  }
+
+};
+
+namespace {
+
+/*
+ * Live pools and stats of already destroyed pools.
+ * Intentionally never destroyed - pools may outlive static destruction order.
+ */
+struct Registry {
+  std::mutex mutex;
+  std::unordered_set<SlabAllocator::Pool*> pools;
+  v_int64 retiredAllocations = 0;
+  v_int64 retiredRemoteFrees = 0;
+};
+
+Registry& getRegistry() {
+  static Registry* registry = new Registry();
+  return *registry;
+}
+
+void unrefPool(SlabAllocator::Pool* pool) {
+  if(pool->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    {
+      auto& registry = getRegistry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      registry.pools.erase(pool);
+      registry.retiredAllocations += pool->allocations.load(std::memory_order_relaxed);
+      registry.retiredRemoteFrees += pool->remoteFrees.load(std::memory_order_relaxed);
+    }
+    delete pool;
+  }
+}
+
+}
+
+SlabAllocator::Pool* SlabAllocator::createPool() {
+  auto pool = new Pool();
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.pools.insert(pool);
+  return pool;
+}
+
+void SlabAllocator::releasePool(Pool* pool) {
+  unrefPool(pool);
+}
+
+void SlabAllocator::setThreadPool(Pool* pool) {
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  t_currentPool = pool;
+#else
+  (void)pool;
+#endif
+}
+
+void* SlabAllocator::allocate(std::size_t size) {
+
+  v_buff_size blockSize = static_cast<v_buff_size>(size) + HEADER_SIZE;
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  Pool* pool = t_currentPool;
+  if(pool != nullptr && blockSize <= MAX_BLOCK_SIZE) {
+    auto sizeClass = static_cast<v_uint32>((blockSize - 1) / SIZE_CLASS_STEP);
+    BlockHeader* block = pool->take(sizeClass);
+    block->pool = pool;
+    pool->refs.fetch_add(1, std::memory_order_relaxed);
+    // owner is the only writer - no need for atomic increment
+    pool->allocations.store(pool->allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return block + 1;
+  }
+#endif
+
+  g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+  auto block = static_cast<BlockHeader*>(::operator new(static_cast<std::size_t>(blockSize)));
+  block->pool = nullptr;
+  return block + 1;
+
+}
+
+void SlabAllocator::deallocate(void* ptr) {
+
+  if(ptr == nullptr) {
+    return;
+  }
+
+  BlockHeader* block = static_cast<BlockHeader*>(ptr) - 1;
+  Pool* pool = block->pool;
+
+  if(pool == nullptr) {
+    ::operator delete(block);
+    return;
+  }
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  if(pool == t_currentPool) {
+    block->next = pool->freeLists[block->sizeClass];
+    pool->freeLists[block->sizeClass] = block;
+  } else {
+    pool->pushRemote(block);
+  }
+#else
+  pool->pushRemote(block);
+#endif
+
+  unrefPool(pool);
+
+}
+
+SlabAllocator::Stats SlabAllocator::getStats() {
+  Stats stats;
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  stats.poolAllocations = registry.retiredAllocations;
+  stats.remoteFrees = registry.retiredRemoteFrees;
+  for(Pool* pool : registry.pools) {
+    stats.poolAllocations += pool->allocations.load(std::memory_order_relaxed);
+    stats.remoteFrees += pool->remoteFrees.load(std::memory_order_relaxed);
+  }
+  stats.heapAllocations = g_heapAllocations.load(std::memory_order_relaxed);
+  return stats;
+}
+
+}}}
@@ -0,0 +1,136 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_utils_SlabAllocator_hpp
+#define oatpp_async_utils_SlabAllocator_hpp
+
+#include "oatpp/Environment.hpp"
+
+#include <cstddef>
+
+namespace oatpp { namespace async { namespace utils {
+
+/**
+ * Per-processor slab allocator for coroutine objects and coroutine handles.<br>
+ * Each &id:oatpp::async::Processor; owns a &l:SlabAllocator::Pool; which is bound to the processor thread.
+ * Blocks are served from size-classed free lists of that pool without any locking.
+ * Blocks freed by another thread (ex.: coroutine stolen by a peer processor) are pushed to the owner's lock-free
+ * remote-free list and are reused by the owner later.<br>
+ * Allocations made on threads without a bound pool, or bigger than &l:SlabAllocator::MAX_BLOCK_SIZE;,
+ * fall back to the global heap.
+ */
+class SlabAllocator {
+public:
+
+  /**
+   * Size-class granularity.
+   */
+  static constexpr v_buff_size SIZE_CLASS_STEP = 16;
+
+  /**
+   * Max block size (including block header) served by pool.
+   */
+  static constexpr v_buff_size MAX_BLOCK_SIZE = 1024;
+
+  /**
+   * Size of one slab (memory chunk cut into blocks of the same size class).
+   */
+  static constexpr v_buff_size SLAB_SIZE = 64 * 1024;
+
+public:
+
+  /**
+   * Allocation statistics.
+   */
+  struct Stats {
+
+    /**
+     * Number of blocks served by processor pools.
+     */
+    v_int64 poolAllocations;
+
+    /**
+     * Number of blocks allocated on the global heap.
+     */
+    v_int64 heapAllocations;
+
+    /**
+     * Number of pool blocks freed by a thread other than the pool owner.
+     */
+    v_int64 remoteFrees;
+
+  };
+
+public:
+
+  /**
+   * Opaque pool of slabs. Pool is destroyed when it is released by the owner and all of its blocks are freed.
+   */
+  class Pool;
+
+public:
+
+  /**
+   * Create new pool.
+   * @return
+   */
+  static Pool* createPool();
+
+  /**
+   * Release pool by the owner. Memory is given back once the last block of the pool is freed.
+   * @param pool
+   */
+  static void releasePool(Pool* pool);
+
+  /**
+   * Bind pool to the calling thread. Pass `nullptr` to unbind.<br>
+   * Does nothing if built with `OATPP_COMPAT_BUILD_NO_THREAD_LOCAL`.
+   * @param pool
+   */
+  static void setThreadPool(Pool* pool);
+
+  /**
+   * Allocate block. Never returns `nullptr`.
+   * @param size - requested size.
+   * @return
+   */
+  static void* allocate(std::size_t size);
+
+  /**
+   * Free block allocated by &l:SlabAllocator::allocate ();. Thread-safe.
+   * @param ptr
+   */
+  static void deallocate(void* ptr);
+
+  /**
+   * Get accumulated allocation statistics.
+   * @return - &l:SlabAllocator::Stats;.
+   */
+  static Stats getStats();
+
+};
+
+}}}
+
+#endif /* oatpp_async_utils_SlabAllocator_hpp */
@@ -0,0 +1,340 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_utils_TimerWheel_hpp
+#define oatpp_async_utils_TimerWheel_hpp
+
+#include "oatpp/Environment.hpp"
+
+namespace oatpp { namespace async { namespace utils {
+
+/**
+ * Hierarchical timing wheel.<br>
+ * Time is measured in abstract ticks - it's up to the owner to map ticks to a (monotonic) clock.
+ * Schedule and cancel are O(1). Advancing costs O(1) per expired or cascaded timer,
+ * ticks at which nothing can expire are skipped.<br>
+ * Not thread-safe.
+ * @tparam T - value type. Values are not owned by the wheel.
+ */
+template<typename T>
+class TimerWheel {
+public:
+
+  /**
+   * Number of bits of tick per wheel level.
+   */
+  static constexpr v_int32 LEVEL_BITS = 6;
+
+  /**
+   * Number of slots per wheel level.
+   */
+  static constexpr v_int64 SLOTS = 1 << LEVEL_BITS;
+
+  /**
+   * Number of wheel levels.
+   */
+  static constexpr v_int32 LEVELS = 6;
+
+  /**
+   * Max distance between current tick and timer's slot.
+   * Timers scheduled further are re-placed when they reach the top-level slot.
+   */
+  static constexpr v_int64 MAX_SPAN = (static_cast<v_int64>(1) << (LEVEL_BITS * LEVELS)) - 1;
+
+public:
+
+  /**
+   * Scheduled timer. Used as a handle to cancel the timer.
+   */
+  class Timer {
+    friend TimerWheel;
+  private:
+    T* m_value;
+    v_int64 m_deadline;
+    v_int32 m_level;
+    Timer* m_prev;
+    Timer* m_next;
+  public:
+
+    Timer()
+      : m_value(nullptr)
+      , m_deadline(0)
+      , m_level(0)
+      , m_prev(this)
+      , m_next(this)
+    {}
+
+    /**
+     * Get value.
+     * @return
+     */
+    T* getValue() const {
+      return m_value;
+    }
+
+    /**
+     * Get deadline tick.
+     * @return
+     */
+    v_int64 getDeadline() const {
+      return m_deadline;
+    }
+
+  };
+
+private:
+
+  static void link(Timer* head, Timer* timer) {
+    timer->m_next = head;
+    timer->m_prev = head->m_prev;
+    head->m_prev->m_next = timer;
+    head->m_prev = timer;
+  }
+
+  static void unlink(Timer* timer) {
+    timer->m_prev->m_next = timer->m_next;
+    timer->m_next->m_prev = timer->m_prev;
+    timer->m_prev = timer;
+    timer->m_next = timer;
+  }
+
+private:
+  Timer m_slots[LEVELS][SLOTS];
+  v_int64 m_levelSizes[LEVELS];
+  Timer* m_freeList;
+  v_int64 m_currentTick;
+  v_int64 m_size;
+private:
+
+  Timer* acquireTimer() {
+    if(m_freeList != nullptr) {
+      Timer* timer = m_freeList;
+      m_freeList = timer->m_next;
+      timer->m_prev = timer;
+      timer->m_next = timer;
+      return timer;
+    }
+    return new Timer();
+  }
+
+  void releaseTimer(Timer* timer) {
+    timer->m_value = nullptr;
+    timer->m_next = m_freeList;
+    m_freeList = timer;
+  }
+
+  void place(Timer* timer, v_int64 minTick) {
+
+    v_int64 tick = timer->m_deadline;
+    if(tick < minTick) {
+      tick = minTick;
+    } else if(tick - m_currentTick > MAX_SPAN) {
+      tick = m_currentTick + MAX_SPAN;
+    }
+
+    v_int32 level = 0;
+    while(level < LEVELS - 1 && (tick >> (LEVEL_BITS * (level + 1))) != (m_currentTick >> (LEVEL_BITS * (level + 1)))) {
+      level ++;
+    }
+
+    timer->m_level = level;
+    ++ m_levelSizes[level];
+    link(&m_slots[level][(tick >> (LEVEL_BITS * level)) & (SLOTS - 1)], timer);
+
+  }
+
+  void remove(Timer* timer) {
+    -- m_levelSizes[timer->m_level];
+    unlink(timer);
+  }
+
+  void cascade(v_int32 level) {
+    Timer* head = &m_slots[level][(m_currentTick >> (LEVEL_BITS * level)) & (SLOTS - 1)];
+    while(head->m_next != head) {
+      Timer* timer = head->m_next;
+      remove(timer);
+      place(timer, m_currentTick);
+    }
+  }
+
+public:
+
+  /**
+   * Constructor.
+   * @param currentTick - initial tick.
+   */
+  explicit TimerWheel(v_int64 currentTick = 0)
+    : m_freeList(nullptr)
+    , m_currentTick(currentTick)
+    , m_size(0)
+  {
+    for(v_int32 level = 0; level < LEVELS; level ++) {
+      m_levelSizes[level] = 0;
+    }
+  }
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  /**
+   * Destructor. Values of timers left in the wheel are not touched.
+   */
+  ~TimerWheel() {
+    clear([](T*){});
+    while(m_freeList != nullptr) {
+      Timer* next = m_freeList->m_next;
+      delete m_freeList;
+      m_freeList = next;
+    }
+  }
+
+  /**
+   * Schedule timer.
+   * @param value - value to pass to the expiry callback.
+   * @param deadline - tick to expire at. Timers with deadline in the past expire on the next tick.
+   * @return - &l:TimerWheel::Timer;. Valid until expired or canceled.
+   */
+  Timer* schedule(T* value, v_int64 deadline) {
+    Timer* timer = acquireTimer();
+    timer->m_value = value;
+    timer->m_deadline = deadline;
+    place(timer, m_currentTick + 1);
+    ++ m_size;
+    return timer;
+  }
+
+  /**
+   * Cancel not yet expired timer.
+   * @param timer - &l:TimerWheel::Timer;.
+   */
+  void cancel(Timer* timer) {
+    remove(timer);
+    releaseTimer(timer);
+    -- m_size;
+  }
+
+  /**
+   * Advance wheel up to the tick expiring timers. <br>
+   * Callback may schedule and cancel other timers.
+   * @tparam F - callback type `void(T*)`.
+   * @param tick - tick to advance to.
+   * @param onExpired - called for each expired timer value.
+   */
+  template<typename F>
+  void advance(v_int64 tick, F&& onExpired) {
+
+    while(m_currentTick < tick) {
+
+      if(m_size == 0) {
+        m_currentTick = tick;
+        break;
+      }
+
+      // skip ticks at which empty lower levels have nothing to expire or cascade
+      v_int32 lowestLevel = 0;
+      while(m_levelSizes[lowestLevel] == 0) {
+        lowestLevel ++;
+      }
+      if(lowestLevel > 0) {
+        v_int64 lastSkipped = m_currentTick | ((static_cast<v_int64>(1) << (LEVEL_BITS * lowestLevel)) - 1);
+        if(lastSkipped >= tick) {
+          m_currentTick = tick;
+          break;
+        }
+        m_currentTick = lastSkipped;
+      }
+
+      ++ m_currentTick;
+
+      for(v_int32 level = LEVELS - 1; level > 0; level --) {
+        if((m_currentTick & ((static_cast<v_int64>(1) << (LEVEL_BITS * level)) - 1)) == 0) {
+          cascade(level);
+        }
+      }
+
+      Timer* head = &m_slots[0][m_currentTick & (SLOTS - 1)];
+      while(head->m_next != head) {
+        Timer* timer = head->m_next;
+        remove(timer);
+        if(timer->m_deadline > m_currentTick) {
+          place(timer, m_currentTick + 1);
+        } else {
+          T* value = timer->m_value;
+          releaseTimer(timer);
+          -- m_size;
+          onExpired(value);
+        }
+      }
+
+    }
+
+  }
+
+  /**
+   * Remove all timers.
+   * @tparam F - callback type `void(T*)`.
+   * @param onValue - called for each removed timer value.
+   */
+  template<typename F>
+  void clear(F&& onValue) {
+    for(v_int32 level = 0; level < LEVELS; level ++) {
+      for(v_int64 slot = 0; slot < SLOTS; slot ++) {
+        Timer* head = &m_slots[level][slot];
+        while(head->m_next != head) {
+          Timer* timer = head->m_next;
+          remove(timer);
+          T* value = timer->m_value;
+          releaseTimer(timer);
+          -- m_size;
+          onValue(value);
+        }
+      }
+    }
+  }
+
+  /**
+   * Get current tick.
+   * @return
+   */
+  v_int64 getCurrentTick() const {
+    return m_currentTick;
+  }
+
+  /**
+   * Get number of scheduled timers.
+   * @return
+   */
+  v_int64 size() const {
+    return m_size;
+  }
+
+  bool empty() const {
+    return m_size == 0;
+  }
+
+};
+
+}}}
+
+#endif /* oatpp_async_utils_TimerWheel_hpp */
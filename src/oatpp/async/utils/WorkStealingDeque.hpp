@@ -0,0 +1,154 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_utils_WorkStealingDeque_hpp
+#define oatpp_async_utils_WorkStealingDeque_hpp
+
+#include "oatpp/Environment.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace oatpp { namespace async { namespace utils {
+
+/**
+ * Bounded lock-free work-stealing deque (Chase-Lev).<br>
+ * Owner thread pushes and pops entries at the bottom,
+ * any other thread may steal entries from the top.
+ * Entries are not owned by the deque.
+ * @tparam T - entry type.
+ */
+template<typename T>
+class WorkStealingDeque {
+private:
+  std::atomic<v_int64> m_top;
+  std::atomic<v_int64> m_bottom;
+  v_int64 m_mask;
+  std::unique_ptr<std::atomic<T*>[]> m_buffer;
+public:
+
+  /**
+   * Constructor.
+   * @param capacity - max number of entries. Rounded up to the power of two.
+   */
+  explicit WorkStealingDeque(v_int64 capacity)
+    : m_top(0)
+    , m_bottom(0)
+  {
+    v_int64 size = 1;
+    while(size < capacity) {
+      size <<= 1;
+    }
+    m_mask = size - 1;
+    m_buffer.reset(new std::atomic<T*>[static_cast<size_t>(size)]);
+  }
+
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  /**
+   * Get max number of entries.
+   * @return
+   */
+  v_int64 getCapacity() const {
+    return m_mask + 1;
+  }
+
+  /**
+   * Approximate number of entries.
+   * @return
+   */
+  v_int64 size() const {
+    v_int64 b = m_bottom.load(std::memory_order_relaxed);
+    v_int64 t = m_top.load(std::memory_order_relaxed);
+    return b > t ? b - t : 0;
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  /**
+   * Push entry to the bottom. Owner thread only.
+   * @param entry
+   * @return - `false` if deque is full.
+   */
+  bool push(T* entry) {
+    v_int64 b = m_bottom.load(std::memory_order_relaxed);
+    v_int64 t = m_top.load(std::memory_order_acquire);
+    if(b - t > m_mask) {
+      return false;
+    }
+    m_buffer[static_cast<size_t>(b & m_mask)].store(entry, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * Pop entry from the bottom. Owner thread only.
+   * @return - entry or `nullptr` if deque is empty.
+   */
+  T* pop() {
+    v_int64 b = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    v_int64 t = m_top.load(std::memory_order_relaxed);
+    if(t > b) {
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    T* entry = m_buffer[static_cast<size_t>(b & m_mask)].load(std::memory_order_relaxed);
+    if(t == b) {
+      if(!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        entry = nullptr;
+      }
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return entry;
+  }
+
+  /**
+   * Steal entry from the top. Thread-safe.
+   * @return - entry or `nullptr` if deque is empty or the race was lost.
+   */
+  T* steal() {
+    v_int64 t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    v_int64 b = m_bottom.load(std::memory_order_acquire);
+    if(t >= b) {
+      return nullptr;
+    }
+    T* entry = m_buffer[static_cast<size_t>(t & m_mask)].load(std::memory_order_relaxed);
+    if(!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return entry;
+  }
+
+};
+
+}}}
+
+#endif /* oatpp_async_utils_WorkStealingDeque_hpp */
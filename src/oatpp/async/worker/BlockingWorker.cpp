@@ -0,0 +1,193 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "BlockingWorker.hpp"
+
+#include "oatpp/async/Processor.hpp"
+
+namespace oatpp { namespace async { namespace worker {
+
+BlockingWorker::BlockingWorker()
+  : BlockingWorker(Config())
+{}
+
+BlockingWorker::BlockingWorker(const Config& config)
+  : Worker(Type::BLOCKING)
+  , m_config(config)
+  , m_running(true)
+  , m_threadsCount(0)
+  , m_idleCount(0)
+  , m_maxQueueDepth(0)
+  , m_completedCalls(0)
+{
+  if(m_config.maxThreads < 1 || m_config.minThreads < 0 || m_config.minThreads > m_config.maxThreads) {
+    throw std::runtime_error("[oatpp::async::worker::BlockingWorker::BlockingWorker()]: Error. Invalid threads count specified.");
+  }
+}
+
+BlockingWorker::~BlockingWorker() {
+  stop();
+  join();
+}
+
+void BlockingWorker::onTasksAdded() {
+
+  if(m_queue.count > m_maxQueueDepth) {
+    m_maxQueueDepth = m_queue.count;
+  }
+
+  if(!m_running) {
+    return;
+  }
+
+  reapExitedThreads();
+
+  // newly started thread counts as idle till it takes a task
+  while(m_idleCount < m_queue.count && m_threadsCount < m_config.maxThreads) {
+    ++ m_threadsCount;
+    ++ m_idleCount;
+    m_threads.emplace_back(&BlockingWorker::run, this);
+  }
+
+}
+
+void BlockingWorker::reapExitedThreads() {
+  for(auto& id : m_exitedThreads) {
+    for(auto it = m_threads.begin(); it != m_threads.end(); it ++) {
+      if(it->get_id() == id) {
+        // thread has released the lock and is returning - join doesn't block for long
+        it->join();
+        m_threads.erase(it);
+        break;
+      }
+    }
+  }
+  m_exitedThreads.clear();
+}
+
+void BlockingWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
+  v_int64 count;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    count = tasks.count;
+    utils::FastQueue<CoroutineHandle>::moveAll(tasks, m_queue);
+    onTasksAdded();
+  }
+  if(count > 1) {
+    m_condition.notify_all();
+  } else {
+    m_condition.notify_one();
+  }
+}
+
+void BlockingWorker::pushOneTask(CoroutineHandle* task) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.pushBack(task);
+    onTasksAdded();
+  }
+  m_condition.notify_one();
+}
+
+void BlockingWorker::runTask(CoroutineHandle* coroutine) {
+  getCoroutineScheduledAction(coroutine).getBlockingTask()->run();
+  setCoroutineScheduledAction(coroutine, Action::createActionByType(Action::TYPE_NONE));
+  getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
+}
+
+void BlockingWorker::run() {
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  while(m_running) {
+
+    if(m_queue.first == nullptr) {
+      auto status = m_condition.wait_for(lock, m_config.keepAlive);
+      if(status == std::cv_status::timeout && m_queue.first == nullptr && m_threadsCount > m_config.minThreads) {
+        break;
+      }
+      continue;
+    }
+
+    auto coroutine = m_queue.popFront();
+    -- m_idleCount;
+
+    lock.unlock();
+    runTask(coroutine);
+    lock.lock();
+
+    ++ m_idleCount;
+    ++ m_completedCalls;
+
+  }
+
+  -- m_idleCount;
+  -- m_threadsCount;
+  m_exitedThreads.push_back(std::this_thread::get_id());
+
+}
+
+void BlockingWorker::stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running = false;
+  }
+  m_condition.notify_all();
+  m_stopCondition.notify_all();
+}
+
+void BlockingWorker::join() {
+
+  std::list<std::thread> threads;
+
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while(m_running) {
+      m_stopCondition.wait(lock);
+    }
+    threads.splice(threads.end(), m_threads);
+    m_exitedThreads.clear();
+  }
+
+  for(auto& thread : threads) {
+    thread.join();
+  }
+
+}
+
+void BlockingWorker::detach() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for(auto& thread : m_threads) {
+    thread.detach();
+  }
+  m_threads.clear();
+  m_exitedThreads.clear();
+}
+
+BlockingWorker::Stats BlockingWorker::getStats() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return {m_queue.count, m_maxQueueDepth, m_threadsCount, m_threadsCount - m_idleCount, m_completedCalls};
+}
+
+}}}
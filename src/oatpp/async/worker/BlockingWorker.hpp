@@ -0,0 +1,175 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_worker_BlockingWorker_hpp
+#define oatpp_async_worker_BlockingWorker_hpp
+
+#include "./Worker.hpp"
+
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace async { namespace worker {
+
+/**
+ * Worker running blocking calls (&id:oatpp::async::BlockingCall;) off the processor threads. <br>
+ * Backed by an elastic thread pool - threads are started on demand up to &l:BlockingWorker::Config::maxThreads;
+ * and stopped after being idle for &l:BlockingWorker::Config::keepAlive;.
+ * Number of threads bounds the number of concurrently running blocking calls - the rest wait in the queue.
+ */
+class BlockingWorker : public Worker {
+public:
+
+  /**
+   * Thread pool configuration.
+   */
+  struct Config {
+
+    /**
+     * Number of threads kept alive when idle.
+     */
+    v_int32 minThreads = 0;
+
+    /**
+     * Max number of threads - max number of concurrently running blocking calls.
+     */
+    v_int32 maxThreads = 32;
+
+    /**
+     * Time an idle thread above &l:BlockingWorker::Config::minThreads; waits for work before it stops.
+     */
+    std::chrono::milliseconds keepAlive = std::chrono::seconds(10);
+
+  };
+
+  /**
+   * Worker statistics.
+   */
+  struct Stats {
+
+    /**
+     * Number of blocking calls waiting for a thread.
+     */
+    v_int64 queueDepth;
+
+    /**
+     * Max observed number of blocking calls waiting for a thread.
+     */
+    v_int64 maxQueueDepth;
+
+    /**
+     * Number of live threads.
+     */
+    v_int32 threads;
+
+    /**
+     * Number of threads running blocking calls.
+     */
+    v_int32 activeThreads;
+
+    /**
+     * Number of completed blocking calls.
+     */
+    v_uint64 completedCalls;
+
+  };
+
+private:
+  Config m_config;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::condition_variable m_stopCondition;
+  utils::FastQueue<CoroutineHandle> m_queue;
+  bool m_running;
+private:
+  v_int32 m_threadsCount;
+  v_int32 m_idleCount;
+  v_int64 m_maxQueueDepth;
+  v_uint64 m_completedCalls;
+private:
+  std::list<std::thread> m_threads;
+  std::vector<std::thread::id> m_exitedThreads;
+private:
+  void onTasksAdded();
+  void reapExitedThreads();
+  void runTask(CoroutineHandle* coroutine);
+  void run();
+public:
+
+  /**
+   * Constructor. Default &l:BlockingWorker::Config;.
+   */
+  BlockingWorker();
+
+  /**
+   * Constructor.
+   * @param config - &l:BlockingWorker::Config;.
+   */
+  BlockingWorker(const Config& config);
+
+  /**
+   * Virtual destructor.
+   */
+  ~BlockingWorker() override;
+
+  /**
+   * Push list of tasks to worker.
+   * @param tasks - &id:oatpp::async::utils::FastQueue; of &id:oatpp::async::CoroutineHandle;.
+   */
+  void pushTasks(utils::FastQueue<CoroutineHandle>& tasks) override;
+
+  /**
+   * Push one task to worker.
+   * @param task - &id:oatpp::async::CoroutineHandle;.
+   */
+  void pushOneTask(CoroutineHandle* task) override;
+
+  /**
+   * Break run loop. Blocking calls being run are completed. Queued calls are not run.
+   */
+  void stop() override;
+
+  /**
+   * Join all worker-threads. Waits till the worker is stopped.
+   */
+  void join() override;
+
+  /**
+   * Detach all worker-threads.
+   */
+  void detach() override;
+
+  /**
+   * Get worker statistics.
+   * @return - &l:BlockingWorker::Stats;.
+   */
+  Stats getStats();
+
+};
+
+}}}
+
+#endif //oatpp_async_worker_BlockingWorker_hpp
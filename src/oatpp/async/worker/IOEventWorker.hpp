@@ -30,6 +30,7 @@
 
 #include <thread>
 #include <mutex>
+#include <unordered_map>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -71,9 +72,23 @@ class IOEventWorkerForeman; // FWD
 class IOEventWorker : public Worker {
 private:
   static constexpr const v_int32 MAX_EVENTS = 10000;
+private:
+
+  /**
+   * State of the I/O handle registered in the event queue. <br>
+   * Used by `epoll` implementation where handle stays registered between waits (edge-triggered),
+   * and the event carries the handle rather than pointer to the coroutine. <br>
+   * The state exists only while the coroutine waiting for the handle is in the worker -
+   * events of handles without state are dropped.
+   */
+  struct HandleState {
+    CoroutineHandle* waiter = nullptr;
+  };
+
 private:
   IOEventWorkerForeman* m_foreman;
   Action::IOEventType m_specialization;
+  LocalRunBudget m_localRunBudget;
   std::atomic<bool> m_running;
   utils::FastQueue<CoroutineHandle> m_backlog;
   oatpp::concurrency::SpinLock m_backlogLock;
@@ -84,6 +99,7 @@ private:
   v_int32 m_inEventsCount;
   v_int32 m_inEventsCapacity;
   std::unique_ptr<v_char8[]> m_outEvents;
+  std::unordered_map<v_io_handle, HandleState> m_handleStates;
 private:
   std::thread m_thread;
 private:
@@ -98,8 +114,11 @@ public:
 
   /**
    * Constructor.
+   * @param foreman - &l:IOEventWorkerForeman;.
+   * @param specialization - I/O event type this worker waits for.
+   * @param localRunBudget - run-to-completion budget. &id:oatpp::async::worker::Worker::LocalRunBudget;.
    */
-  IOEventWorker(IOEventWorkerForeman* foreman, Action::IOEventType specialization);
+  IOEventWorker(IOEventWorkerForeman* foreman, Action::IOEventType specialization, const LocalRunBudget& localRunBudget = LocalRunBudget());
 
   /**
    * Virtual destructor.
@@ -152,8 +171,9 @@ public:
 
   /**
    * Constructor.
+   * @param localRunBudget - run-to-completion budget of reader and writer workers. &id:oatpp::async::worker::Worker::LocalRunBudget;.
    */
-  IOEventWorkerForeman();
+  IOEventWorkerForeman(const LocalRunBudget& localRunBudget = LocalRunBudget());
 
   /**
    * Virtual destructor.
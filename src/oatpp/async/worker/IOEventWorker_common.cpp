@@ -35,10 +35,11 @@ namespace oatpp { namespace async { namespace worker {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // IOEventWorker
 
-IOEventWorker::IOEventWorker(IOEventWorkerForeman* foreman, Action::IOEventType specialization)
+IOEventWorker::IOEventWorker(IOEventWorkerForeman* foreman, Action::IOEventType specialization, const LocalRunBudget& localRunBudget)
   : Worker(Type::IO)
   , m_foreman(foreman)
   , m_specialization(specialization)
+  , m_localRunBudget(localRunBudget)
   , m_running(true)
   , m_eventQueueHandle(INVALID_IO_HANDLE)
   , m_wakeupTrigger(INVALID_IO_HANDLE)
@@ -112,10 +113,10 @@ void IOEventWorker::detach() {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // IOEventWorkerForeman
 
-IOEventWorkerForeman::IOEventWorkerForeman()
+IOEventWorkerForeman::IOEventWorkerForeman(const LocalRunBudget& localRunBudget)
   : Worker(Type::IO)
-  , m_reader(this, Action::IOEventType::IO_EVENT_READ)
-  , m_writer(this, Action::IOEventType::IO_EVENT_WRITE)
+  , m_reader(this, Action::IOEventType::IO_EVENT_READ, localRunBudget)
+  , m_writer(this, Action::IOEventType::IO_EVENT_WRITE, localRunBudget)
 {}
 
 IOEventWorkerForeman::~IOEventWorkerForeman() {
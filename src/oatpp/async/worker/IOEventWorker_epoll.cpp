@@ -69,7 +69,7 @@ void IOEventWorker::initEventQueue() {
   epoll_event event;
   std::memset(&event, 0, sizeof(epoll_event));
 
-  event.data.ptr = this;
+  event.data.fd = m_wakeupTrigger;
 
 #ifdef EPOLLEXCLUSIVE
   event.events = EPOLLIN | EPOLLET | EPOLLEXCLUSIVE;
@@ -110,19 +110,27 @@ void IOEventWorker::setCoroutineEvent(CoroutineHandle* coroutine, int operation,
 
   }
 
+  auto& state = m_handleStates[action.getIOHandle()];
+  state.waiter = coroutine;
+
+  if(operation == 0) {
+    /* Handle is registered and wasn't out of sight since the last event - edge-triggered registration reports new readiness */
+    return;
+  }
+
   epoll_event event;
   std::memset(&event, 0, sizeof(epoll_event));
 
-  event.data.ptr = coroutine;
+  event.data.fd = action.getIOHandle();
 
   switch(action.getIOEventType()) {
 
     case Action::IOEventType::IO_EVENT_READ:
-      event.events = EPOLLIN  | EPOLLET | EPOLLONESHOT;
+      event.events = EPOLLIN  | EPOLLET;
       break;
 
     case Action::IOEventType::IO_EVENT_WRITE:
-      event.events = EPOLLOUT | EPOLLET | EPOLLONESHOT;
+      event.events = EPOLLOUT | EPOLLET;
       break;
 
     default:
@@ -130,8 +138,18 @@ void IOEventWorker::setCoroutineEvent(CoroutineHandle* coroutine, int operation,
 
   }
 
-  auto res = epoll_ctl(m_eventQueueHandle, operation, action.getIOHandle(), &event);
+  /*
+   * Re-arm existing registration - it also reports the handle if it is ready already.
+   * If the handle was closed while the coroutine was away (and its number possibly reused), the registration
+   * was removed by the kernel - MOD fails with ENOENT and the handle is registered again.
+   */
+  auto res = epoll_ctl(m_eventQueueHandle, EPOLL_CTL_MOD, action.getIOHandle(), &event);
+  if(res == -1 && errno == ENOENT) {
+    res = epoll_ctl(m_eventQueueHandle, EPOLL_CTL_ADD, action.getIOHandle(), &event);
+  }
+
   if(res == -1) {
+    m_handleStates.erase(action.getIOHandle());
     OATPP_LOGe("[oatpp::async::worker::IOEventWorker::setEpollEvent()]", "Error. Call to epoll_ctl failed. operation={}, errno={}", operation, errno)
     throw std::runtime_error("[oatpp::async::worker::IOEventWorker::setEpollEvent()]: Error. Call to epoll_ctl failed.");
   }
@@ -144,7 +162,7 @@ void IOEventWorker::consumeBacklog() {
 
   auto curr = m_backlog.first;
   while(curr != nullptr) {
-    setCoroutineEvent(curr, EPOLL_CTL_ADD, nullptr);
+    setCoroutineEvent(curr, EPOLL_CTL_MOD, nullptr);
     curr = nextCoroutine(curr);
   }
 
@@ -176,97 +194,72 @@ void IOEventWorker::waitEvents() {
 
   for(v_int32 i = 0; i < eventsCount; i ++) {
 
-    void* dataPtr = outEvents[i].data.ptr;
-
-    if(dataPtr != nullptr) {
-
-      if(dataPtr == this) {
-
-        eventfd_t value;
-        eventfd_read(m_wakeupTrigger, &value);
-
-      } else {
-
-        auto coroutine = reinterpret_cast<CoroutineHandle*>(dataPtr);
-
-        Action action = coroutine->iterate();
-
-        int res;
-
-        switch(action.getIOEventCode() | m_specialization) {
-
-          case Action::CODE_IO_WAIT_READ:
-            setCoroutineScheduledAction(coroutine, std::move(action));
-            setCoroutineEvent(coroutine, EPOLL_CTL_MOD, nullptr);
-            break;
-
-          case Action::CODE_IO_WAIT_WRITE:
-            setCoroutineScheduledAction(coroutine, std::move(action));
-            setCoroutineEvent(coroutine, EPOLL_CTL_MOD, nullptr);
-            break;
+    v_io_handle handle = outEvents[i].data.fd;
 
-          case Action::CODE_IO_REPEAT_READ:
-            setCoroutineScheduledAction(coroutine, std::move(action));
-            setCoroutineEvent(coroutine, EPOLL_CTL_MOD, nullptr);
-            break;
-
-          case Action::CODE_IO_REPEAT_WRITE:
-            setCoroutineScheduledAction(coroutine, std::move(action));
-            setCoroutineEvent(coroutine, EPOLL_CTL_MOD, nullptr);
-            break;
-
-          case Action::CODE_IO_WAIT_RESCHEDULE:
-
-            res = epoll_ctl(m_eventQueueHandle, EPOLL_CTL_DEL, action.getIOHandle(), nullptr);
-            if(res == -1) {
-              OATPP_LOGe(
-                "[oatpp::async::worker::IOEventWorker::waitEvents()]",
-                "Error. Call to epoll_ctl failed. operation={}, errno={}. action_code={}, worker_specialization={}",
-                EPOLL_CTL_DEL, errno, action.getIOEventCode(), static_cast<v_int32>(m_specialization)
-              )
-              throw std::runtime_error("[oatpp::async::worker::IOEventWorker::waitEvents()]: Error. Call to epoll_ctl failed.");
-            }
-
-            setCoroutineScheduledAction(coroutine, std::move(action));
-            popQueue.pushBack(coroutine);
-
-            break;
-
-          case Action::CODE_IO_REPEAT_RESCHEDULE:
-
-            res = epoll_ctl(m_eventQueueHandle, EPOLL_CTL_DEL, action.getIOHandle(), nullptr);
-            if(res == -1) {
-              OATPP_LOGe(
-                "[oatpp::async::worker::IOEventWorker::waitEvents()]",
-                "Error. Call to epoll_ctl failed. operation={}, errno={}. action_code={}, worker_specialization={}",
-                EPOLL_CTL_DEL, errno, action.getIOEventCode(), static_cast<v_int32>(m_specialization)
-              )
-              throw std::runtime_error("[oatpp::async::worker::IOEventWorker::waitEvents()]: Error. Call to epoll_ctl failed.");
-            }
-
-            setCoroutineScheduledAction(coroutine, std::move(action));
-            popQueue.pushBack(coroutine);
-
-            break;
+    if(handle == m_wakeupTrigger) {
+      eventfd_t value;
+      eventfd_read(m_wakeupTrigger, &value);
+      continue;
+    }
 
+    auto it = m_handleStates.find(handle);
 
-          default:
+    if(it == m_handleStates.end() || it->second.waiter == nullptr) {
+      /* Nobody waits for this handle at the moment - keep registration */
+      continue;
+    }
 
-            auto& prevAction = getCoroutineScheduledAction(coroutine);
+    auto coroutine = it->second.waiter;
+    it->second.waiter = nullptr;
 
-            res = epoll_ctl(m_eventQueueHandle, EPOLL_CTL_DEL, prevAction.getIOHandle(), nullptr);
-            if(res == -1) {
-              OATPP_LOGe("[oatpp::async::worker::IOEventWorker::waitEvents()]", "Error. Call to epoll_ctl failed. operation={}, errno={}", EPOLL_CTL_DEL, errno)
-              throw std::runtime_error("[oatpp::async::worker::IOEventWorker::waitEvents()]: Error. Call to epoll_ctl failed.");
-            }
+    Action action = coroutine->iterate();
+    bool ranLocally = false;
 
-            setCoroutineScheduledAction(coroutine, std::move(action));
-            getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
+    if(m_localRunBudget.maxSteps > 0 && action.getType() != Action::TYPE_IO_WAIT && action.getType() != Action::TYPE_IO_REPEAT) {
+      action = runLocally(coroutine, std::move(action), m_localRunBudget);
+      ranLocally = true;
+    }
 
+    switch(action.getIOEventCode() | m_specialization) {
+
+      case Action::CODE_IO_WAIT_READ:
+      case Action::CODE_IO_WAIT_WRITE: {
+        /*
+         * No syscall if the coroutine waits for the same handle right after the I/O step.
+         * After running locally the handle could have been closed and its number reused - re-arm.
+         */
+        int operation = (!ranLocally && action.getIOHandle() == handle) ? 0 : EPOLL_CTL_MOD;
+        if(action.getIOHandle() != handle) {
+          m_handleStates.erase(handle);
         }
-
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        setCoroutineEvent(coroutine, operation, nullptr);
+        break;
       }
 
+      case Action::CODE_IO_REPEAT_READ:
+      case Action::CODE_IO_REPEAT_WRITE:
+        /* Handle wasn't drained - there will be no new edge, re-arm to get it reported */
+        if(action.getIOHandle() != handle) {
+          m_handleStates.erase(handle);
+        }
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        setCoroutineEvent(coroutine, EPOLL_CTL_MOD, nullptr);
+        break;
+
+      case Action::CODE_IO_WAIT_RESCHEDULE:
+      case Action::CODE_IO_REPEAT_RESCHEDULE:
+        /* Coroutine leaves the worker - drop the state, registration is re-armed when it comes back */
+        m_handleStates.erase(handle);
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        popQueue.pushBack(coroutine);
+        break;
+
+      default:
+        m_handleStates.erase(handle);
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
+
     }
 
   }
@@ -191,6 +191,10 @@ void IOEventWorker::waitEvents() {
 
       Action action = coroutine->iterate();
 
+      if(m_localRunBudget.maxSteps > 0 && action.getType() != Action::TYPE_IO_WAIT && action.getType() != Action::TYPE_IO_REPEAT) {
+        action = runLocally(coroutine, std::move(action), m_localRunBudget);
+      }
+
       switch(action.getIOEventCode() | m_specialization) {
 
         case Action::CODE_IO_WAIT_READ:
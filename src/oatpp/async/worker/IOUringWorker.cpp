@@ -0,0 +1,495 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOUringWorker.hpp"
+
+#include "oatpp/async/Processor.hpp"
+#include "oatpp/base/Log.hpp"
+
+#ifdef OATPP_IO_URING_AVAILABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// io_uring based implementation
+
+#include <linux/io_uring.h>
+
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+
+#include <algorithm>
+#include <cstring>
+
+#ifndef __NR_io_uring_setup
+  #define __NR_io_uring_setup 425
+#endif
+
+#ifndef __NR_io_uring_enter
+  #define __NR_io_uring_enter 426
+#endif
+
+namespace oatpp { namespace async { namespace worker {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// IOUringWorker::Ring
+
+/**
+ * Submission and completion queues shared with the kernel.
+ */
+struct IOUringWorker::Ring {
+
+  int fd;
+
+  void* sqMemory;
+  size_t sqMemorySize;
+  void* cqMemory;
+  size_t cqMemorySize;
+  io_uring_sqe* sqes;
+  size_t sqesSize;
+
+  unsigned* sqHead;
+  unsigned* sqTail;
+  unsigned* sqArray;
+  unsigned sqMask;
+  unsigned sqEntries;
+  unsigned sqLocalTail;
+  unsigned sqSubmitted;
+
+  unsigned* cqHead;
+  unsigned* cqTail;
+  unsigned cqMask;
+  io_uring_cqe* cqes;
+
+  static int setup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+  }
+
+  explicit Ring(unsigned entries)
+    : fd(-1)
+    , sqMemory(MAP_FAILED)
+    , sqMemorySize(0)
+    , cqMemory(MAP_FAILED)
+    , cqMemorySize(0)
+    , sqes(static_cast<io_uring_sqe*>(MAP_FAILED))
+    , sqesSize(0)
+    , sqLocalTail(0)
+    , sqSubmitted(0)
+  {
+
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(io_uring_params));
+
+    fd = setup(entries, &params);
+    if(fd < 0) {
+      OATPP_LOGe("[oatpp::async::worker::IOUringWorker::Ring::Ring()]", "Error. Call to io_uring_setup() failed. errno={}", errno)
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::Ring::Ring()]: Error. Call to io_uring_setup() failed.");
+    }
+
+    sqMemorySize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqMemorySize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if(singleMmap) {
+      sqMemorySize = std::max(sqMemorySize, cqMemorySize);
+      cqMemorySize = sqMemorySize;
+    }
+
+    sqMemory = ::mmap(nullptr, sqMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if(sqMemory == MAP_FAILED) {
+      release();
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::Ring::Ring()]: Error. Can't map submission queue.");
+    }
+
+    if(singleMmap) {
+      cqMemory = sqMemory;
+    } else {
+      cqMemory = ::mmap(nullptr, cqMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+      if(cqMemory == MAP_FAILED) {
+        release();
+        throw std::runtime_error("[oatpp::async::worker::IOUringWorker::Ring::Ring()]: Error. Can't map completion queue.");
+      }
+    }
+
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = static_cast<io_uring_sqe*>(::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+    if(sqes == MAP_FAILED) {
+      release();
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::Ring::Ring()]: Error. Can't map submission queue entries.");
+    }
+
+    auto sq = static_cast<p_char8>(sqMemory);
+    sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sqEntries = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+    sqLocalTail = *sqTail;
+    sqSubmitted = sqLocalTail;
+
+    auto cq = static_cast<p_char8>(cqMemory);
+    cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+  }
+
+  ~Ring() {
+    release();
+  }
+
+  void release() {
+    if(sqes != MAP_FAILED) {
+      ::munmap(sqes, sqesSize);
+      sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    }
+    if(cqMemory != MAP_FAILED && cqMemory != sqMemory) {
+      ::munmap(cqMemory, cqMemorySize);
+    }
+    cqMemory = MAP_FAILED;
+    if(sqMemory != MAP_FAILED) {
+      ::munmap(sqMemory, sqMemorySize);
+      sqMemory = MAP_FAILED;
+    }
+    if(fd >= 0) {
+      ::close(fd);
+      fd = -1;
+    }
+  }
+
+  /**
+   * Submit queued entries and wait for at least `minComplete` completions.
+   * @param minComplete
+   * @return - number of submitted entries or negative errno.
+   */
+  int enter(unsigned minComplete) {
+
+    unsigned toSubmit = sqLocalTail - sqSubmitted;
+    if(toSubmit > 0) {
+      __atomic_store_n(sqTail, sqLocalTail, __ATOMIC_RELEASE);
+    }
+
+    unsigned flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    auto res = ::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0);
+    if(res < 0) {
+      return -errno;
+    }
+
+    sqSubmitted += static_cast<unsigned>(res);
+    return static_cast<int>(res);
+
+  }
+
+  /**
+   * Get next free submission queue entry. Submits queued entries if the queue is full.
+   * @return - zeroed entry.
+   */
+  io_uring_sqe* nextSqe() {
+
+    if(sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries) {
+      auto res = enter(0);
+      if(res < 0 || sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries) {
+        OATPP_LOGe("[oatpp::async::worker::IOUringWorker::Ring::nextSqe()]", "Error. Submission queue is full. res={}", res)
+        throw std::runtime_error("[oatpp::async::worker::IOUringWorker::Ring::nextSqe()]: Error. Submission queue is full.");
+      }
+    }
+
+    unsigned index = sqLocalTail & sqMask;
+    sqArray[index] = index;
+    sqLocalTail ++;
+
+    io_uring_sqe* sqe = &sqes[index];
+    std::memset(sqe, 0, sizeof(io_uring_sqe));
+    return sqe;
+
+  }
+
+  static void preparePoll(io_uring_sqe* sqe, v_io_handle handle, v_uint32 mask, void* userData) {
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = handle;
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    mask = (mask << 16) | (mask >> 16); // poll32_events is word-reversed on big-endian
+#endif
+    sqe->poll32_events = mask;
+    sqe->user_data = reinterpret_cast<__u64>(userData);
+  }
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// IOUringWorker
+
+bool IOUringWorker::isSupported() {
+
+  static const bool supported = [] {
+
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(io_uring_params));
+
+    int fd = Ring::setup(8, &params);
+    if(fd < 0) {
+      return false;
+    }
+    ::close(fd);
+
+    /* Without NODROP completions are lost on completion queue overflow - coroutines would hang */
+    return (params.features & IORING_FEAT_NODROP) != 0;
+
+  }();
+
+  return supported;
+
+}
+
+IOUringWorker::IOUringWorker(const LocalRunBudget& localRunBudget)
+  : Worker(Type::IO)
+  , m_localRunBudget(localRunBudget)
+  , m_running(true)
+  , m_ring(new Ring(RING_SIZE))
+  , m_wakeupTrigger(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+
+  if(m_wakeupTrigger == -1) {
+    OATPP_LOGe("[oatpp::async::worker::IOUringWorker::IOUringWorker()]", "Error. Call to ::eventfd() failed. errno={}", errno)
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::IOUringWorker()]: Error. Call to ::eventfd() failed.");
+  }
+
+  m_thread = std::thread(&IOUringWorker::run, this);
+
+}
+
+IOUringWorker::~IOUringWorker() {
+  if(m_wakeupTrigger >= 0) {
+    ::close(m_wakeupTrigger);
+  }
+}
+
+void IOUringWorker::triggerWakeup() {
+  eventfd_write(m_wakeupTrigger, 1);
+}
+
+void IOUringWorker::pollWakeupTrigger() {
+  Ring::preparePoll(m_ring->nextSqe(), m_wakeupTrigger, POLLIN, this);
+}
+
+void IOUringWorker::pollCoroutineEvent(CoroutineHandle* coroutine) {
+
+  auto& action = getCoroutineScheduledAction(coroutine);
+
+  switch(action.getType()) {
+
+    case Action::TYPE_IO_WAIT: break;
+    case Action::TYPE_IO_REPEAT: break;
+
+    default:
+      OATPP_LOGe("[oatpp::async::worker::IOUringWorker::pollCoroutineEvent()]", "Error. Unknown Action. action.getType()=={}", action.getType())
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::pollCoroutineEvent()]: Error. Unknown Action.");
+
+  }
+
+  v_uint32 mask;
+
+  switch(action.getIOEventType()) {
+
+    case Action::IOEventType::IO_EVENT_READ:
+      mask = POLLIN;
+      break;
+
+    case Action::IOEventType::IO_EVENT_WRITE:
+      mask = POLLOUT;
+      break;
+
+    default:
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::pollCoroutineEvent()]: Error. Unknown Action Event Type.");
+
+  }
+
+  Ring::preparePoll(m_ring->nextSqe(), action.getIOHandle(), mask, coroutine);
+
+}
+
+void IOUringWorker::processCoroutine(CoroutineHandle* coroutine) {
+
+  Action action = coroutine->iterate();
+
+  if(m_localRunBudget.maxSteps > 0 && action.getType() != Action::TYPE_IO_WAIT && action.getType() != Action::TYPE_IO_REPEAT) {
+    action = runLocally(coroutine, std::move(action), m_localRunBudget);
+  }
+
+  switch(action.getIOEventCode()) {
+
+    case Action::CODE_IO_WAIT_READ:
+    case Action::CODE_IO_WAIT_WRITE:
+    case Action::CODE_IO_REPEAT_READ:
+    case Action::CODE_IO_REPEAT_WRITE:
+      /* Poll is level-triggered - the same request works for both WAIT and REPEAT */
+      setCoroutineScheduledAction(coroutine, std::move(action));
+      pollCoroutineEvent(coroutine);
+      break;
+
+    default:
+      setCoroutineScheduledAction(coroutine, std::move(action));
+      getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
+
+  }
+
+}
+
+void IOUringWorker::consumeBacklog() {
+
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+
+  auto curr = m_backlog.first;
+  while(curr != nullptr) {
+    pollCoroutineEvent(curr);
+    curr = nextCoroutine(curr);
+  }
+
+  m_backlog.first = nullptr;
+  m_backlog.last = nullptr;
+  m_backlog.count = 0;
+
+}
+
+void IOUringWorker::waitEvents() {
+
+  /* Submit all queued polls and wait for completions in one syscall */
+  auto res = m_ring->enter(1);
+
+  /* EBUSY/EAGAIN - completion queue is overflown, completions have to be reaped before submitting more */
+  if(res < 0 && res != -EINTR && res != -EBUSY && res != -EAGAIN) {
+    OATPP_LOGe("[oatpp::async::worker::IOUringWorker::waitEvents()]", "Error. Call to io_uring_enter() failed. errno={}", -res)
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::waitEvents()]: Error. Event loop failed.");
+  }
+
+  unsigned head = *m_ring->cqHead;
+  unsigned tail = __atomic_load_n(m_ring->cqTail, __ATOMIC_ACQUIRE);
+
+  while(head != tail) {
+
+    void* userData = reinterpret_cast<void*>(m_ring->cqes[head & m_ring->cqMask].user_data);
+    head ++;
+    __atomic_store_n(m_ring->cqHead, head, __ATOMIC_RELEASE);
+
+    if(userData == this) {
+      eventfd_t value;
+      eventfd_read(m_wakeupTrigger, &value);
+      pollWakeupTrigger();
+    } else {
+      processCoroutine(reinterpret_cast<CoroutineHandle*>(userData));
+    }
+
+  }
+
+}
+
+void IOUringWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
+  if (tasks.first != nullptr) {
+    {
+      std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
+      utils::FastQueue<CoroutineHandle>::moveAll(tasks, m_backlog);
+    }
+    triggerWakeup();
+  }
+}
+
+void IOUringWorker::pushOneTask(CoroutineHandle* task) {
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
+    m_backlog.pushBack(task);
+  }
+  triggerWakeup();
+}
+
+void IOUringWorker::run() {
+
+  pollWakeupTrigger();
+
+  while (m_running) {
+    consumeBacklog();
+    waitEvents();
+  }
+
+}
+
+void IOUringWorker::stop() {
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    m_running = false;
+  }
+  triggerWakeup();
+}
+
+void IOUringWorker::join() {
+  m_thread.join();
+}
+
+void IOUringWorker::detach() {
+  m_thread.detach();
+}
+
+}}}
+
+#else
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// io_uring is not available
+
+namespace oatpp { namespace async { namespace worker {
+
+struct IOUringWorker::Ring {};
+
+bool IOUringWorker::isSupported() {
+  return false;
+}
+
+IOUringWorker::IOUringWorker(const LocalRunBudget& localRunBudget)
+  : Worker(Type::IO)
+  , m_localRunBudget(localRunBudget)
+  , m_running(false)
+  , m_wakeupTrigger(INVALID_IO_HANDLE)
+{
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::IOUringWorker()]: Error. io_uring is not available on this platform.");
+}
+
+IOUringWorker::~IOUringWorker() = default;
+
+void IOUringWorker::consumeBacklog() {}
+void IOUringWorker::waitEvents() {}
+void IOUringWorker::triggerWakeup() {}
+void IOUringWorker::pollWakeupTrigger() {}
+void IOUringWorker::pollCoroutineEvent(CoroutineHandle* coroutine) { (void) coroutine; }
+void IOUringWorker::processCoroutine(CoroutineHandle* coroutine) { (void) coroutine; }
+void IOUringWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) { (void) tasks; }
+void IOUringWorker::pushOneTask(CoroutineHandle* task) { (void) task; }
+void IOUringWorker::run() {}
+void IOUringWorker::stop() {}
+void IOUringWorker::join() {}
+void IOUringWorker::detach() {}
+
+}}}
+
+#endif // #ifdef OATPP_IO_URING_AVAILABLE
@@ -0,0 +1,136 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_worker_IOUringWorker_hpp
+#define oatpp_async_worker_IOUringWorker_hpp
+
+#include "./Worker.hpp"
+#include "oatpp/concurrency/SpinLock.hpp"
+
+#include <thread>
+#include <mutex>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(OATPP_IO_URING_DISABLED) && (defined(__linux__) || defined(linux) || defined(__linux))
+  #if defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+      #define OATPP_IO_URING_AVAILABLE
+    #endif
+  #endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace oatpp { namespace async { namespace worker {
+
+/**
+ * `io_uring` based implementation of I/O worker (Linux only). <br>
+ * Every I/O wait is a poll request (`IORING_OP_POLL_ADD`) put to the submission queue,
+ * all requests queued during one loop iteration are submitted together with waiting for completions - in one `io_uring_enter` call. <br>
+ * Unlike &id:oatpp::async::worker::IOEventWorker; one worker serves both read and write waits. <br>
+ * Built on raw `io_uring` syscalls - no dependency on liburing.
+ */
+class IOUringWorker : public Worker {
+private:
+  static constexpr const v_uint32 RING_SIZE = 4096;
+private:
+  struct Ring;
+private:
+  LocalRunBudget m_localRunBudget;
+  std::atomic<bool> m_running;
+  utils::FastQueue<CoroutineHandle> m_backlog;
+  oatpp::concurrency::SpinLock m_backlogLock;
+private:
+  std::unique_ptr<Ring> m_ring;
+  oatpp::v_io_handle m_wakeupTrigger;
+private:
+  std::thread m_thread;
+private:
+  void consumeBacklog();
+  void waitEvents();
+  void triggerWakeup();
+  void pollWakeupTrigger();
+  void pollCoroutineEvent(CoroutineHandle* coroutine);
+  void processCoroutine(CoroutineHandle* coroutine);
+public:
+
+  /**
+   * Check if `io_uring` can be used in the current environment. <br>
+   * It may be missing in the kernel or be forbidden by seccomp policy (ex.: in containers).
+   * @return - `true` if &l:IOUringWorker; can be created.
+   */
+  static bool isSupported();
+
+public:
+
+  /**
+   * Constructor.
+   * @param localRunBudget - run-to-completion budget. &id:oatpp::async::worker::Worker::LocalRunBudget;.
+   * @throws - `std::runtime_error` if `io_uring` is not supported. See &l:IOUringWorker::isSupported ();.
+   */
+  IOUringWorker(const LocalRunBudget& localRunBudget = LocalRunBudget());
+
+  /**
+   * Virtual destructor.
+   */
+  ~IOUringWorker() override;
+
+  /**
+   * Push list of tasks to worker.
+   * @param tasks - &id:oatpp::async::utils::FastQueue; of &id:oatpp::async::CoroutineHandle;.
+   */
+  void pushTasks(utils::FastQueue<CoroutineHandle>& tasks) override;
+
+  /**
+   * Push one task to worker.
+   * @param task - &id:CoroutineHandle;.
+   */
+  void pushOneTask(CoroutineHandle* task) override;
+
+  /**
+   * Run worker.
+   */
+  void run();
+
+  /**
+   * Break run loop.
+   */
+  void stop() override;
+
+  /**
+   * Join all worker-threads.
+   */
+  void join() override;
+
+  /**
+   * Detach all worker-threads.
+   */
+  void detach() override;
+
+};
+
+}}}
+
+#endif //oatpp_async_worker_IOUringWorker_hpp
@@ -33,11 +33,20 @@ namespace oatpp { namespace async { namespace worker {
 TimerWorker::TimerWorker(const std::chrono::duration<v_int64, std::micro>& granularity)
   : Worker(Type::TIMER)
   , m_running(true)
-  , m_granularity(granularity)
+  , m_granularity(granularity.count() > 0 ? granularity : std::chrono::microseconds(1))
+  , m_startTime(std::chrono::steady_clock::now())
+  , m_systemNowMicroseconds(0)
+  , m_steadyNowMicroseconds(0)
 {
   m_thread = std::thread(&TimerWorker::run, this);
 }
 
+TimerWorker::~TimerWorker() {
+  m_wheel.clear([](CoroutineHandle* coroutine) {
+    delete coroutine;
+  });
+}
+
 void TimerWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
   {
     std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
@@ -46,13 +55,64 @@ void TimerWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
   m_backlogCondition.notify_one();
 }
 
+void TimerWorker::updateTime() {
+  m_systemNowMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>
+    (std::chrono::system_clock::now().time_since_epoch()).count();
+  m_steadyNowMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>
+    (std::chrono::steady_clock::now() - m_startTime).count();
+}
+
+void TimerWorker::schedule(CoroutineHandle* coroutine) {
+  // time point is in system clock - convert it to the monotonic clock once.
+  v_int64 delay = getCoroutineScheduledAction(coroutine).getTimePointMicroseconds() - m_systemNowMicroseconds;
+  v_int64 deadline = m_steadyNowMicroseconds + delay;
+  v_int64 granularity = m_granularity.count();
+  v_int64 tick = deadline > 0 ? (deadline + granularity - 1) / granularity : 0;
+  m_wheel.schedule(coroutine, tick);
+}
+
+void TimerWorker::processExpired(CoroutineHandle* coroutine) {
+
+  Action action = coroutine->iterate();
+
+  switch(action.getType()) {
+
+    case Action::TYPE_WAIT_REPEAT:
+      setCoroutineScheduledAction(coroutine, std::move(action));
+      schedule(coroutine);
+      break;
+
+    case Action::TYPE_IO_WAIT:
+      setCoroutineScheduledAction(coroutine, oatpp::async::Action::createWaitRepeatAction(0));
+      schedule(coroutine);
+      break;
+
+    default:
+      setCoroutineScheduledAction(coroutine, std::move(action));
+      getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
+      break;
+
+  }
+
+}
+
 void TimerWorker::consumeBacklog() {
 
-  std::unique_lock<oatpp::concurrency::SpinLock> lock(m_backlogLock);
-  while (m_backlog.first == nullptr && m_queue.first == nullptr && m_running) {
-    m_backlogCondition.wait(lock);
+  utils::FastQueue<CoroutineHandle> backlog;
+
+  {
+    std::unique_lock<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    while (m_backlog.first == nullptr && m_wheel.empty() && m_running) {
+      m_backlogCondition.wait(lock);
+    }
+    utils::FastQueue<CoroutineHandle>::moveAll(m_backlog, backlog);
+  }
+
+  updateTime();
+
+  while(backlog.first != nullptr) {
+    schedule(backlog.popFront());
   }
-  utils::FastQueue<CoroutineHandle>::moveAll(m_backlog, m_queue);
 
 }
 
@@ -69,51 +129,14 @@ void TimerWorker::run() {
   while(m_running) {
 
     consumeBacklog();
-    auto curr = m_queue.first;
-    CoroutineHandle* prev = nullptr;
-
-    auto startTime = std::chrono::system_clock::now();
-    std::chrono::microseconds ms = std::chrono::duration_cast<std::chrono::microseconds>(startTime.time_since_epoch());
-    v_int64 tick = ms.count();
-
-    while(curr != nullptr) {
-
-      auto next = nextCoroutine(curr);
-
-      const Action& schA = getCoroutineScheduledAction(curr);
-
-      if(schA.getTimePointMicroseconds() < tick) {
 
-        Action action = curr->iterate();
-
-        switch(action.getType()) {
-
-          case Action::TYPE_WAIT_REPEAT:
-            setCoroutineScheduledAction(curr, std::move(action));
-            break;
-
-          case Action::TYPE_IO_WAIT:
-            setCoroutineScheduledAction(curr, oatpp::async::Action::createWaitRepeatAction(0));
-            break;
-
-          default:
-            m_queue.cutEntry(curr, prev);
-            setCoroutineScheduledAction(curr, std::move(action));
-            getCoroutineProcessor(curr)->pushOneTask(curr);
-            curr = prev;
-            break;
-
-        }
-
-      }
-
-      prev = curr;
-      curr = next;
-    }
+    v_int64 tick = m_steadyNowMicroseconds / m_granularity.count();
+    m_wheel.advance(tick, [this](CoroutineHandle* coroutine) {
+      processExpired(coroutine);
+    });
 
-    auto elapsed = std::chrono::system_clock::now() - startTime;
-    if(elapsed < m_granularity) {
-      std::this_thread::sleep_for(m_granularity - elapsed);
+    if(!m_wheel.empty()) {
+      std::this_thread::sleep_until(m_startTime + m_granularity * (tick + 1));
     }
 
   }
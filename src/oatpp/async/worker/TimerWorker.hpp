@@ -26,6 +26,7 @@
 #define oatpp_async_worker_TimerWorker_hpp
 
 #include "./Worker.hpp"
+#include "oatpp/async/utils/TimerWheel.hpp"
 #include "oatpp/concurrency/SpinLock.hpp"
 
 #include <thread>
@@ -36,20 +37,29 @@ namespace oatpp { namespace async { namespace worker {
 
 /**
  * Timer worker.
- * Used to wait for timer-scheduled coroutines.
+ * Used to wait for timer-scheduled coroutines.<br>
+ * Coroutines are kept in &id:oatpp::async::utils::TimerWheel; ticking with the worker's granularity on a monotonic clock.
+ * Scheduled time points are converted to the monotonic clock when a coroutine is scheduled,
+ * so wall-clock adjustments don't affect already waiting coroutines.
  */
 class TimerWorker : public Worker {
 private:
   std::atomic<bool> m_running;
   utils::FastQueue<CoroutineHandle> m_backlog;
-  utils::FastQueue<CoroutineHandle> m_queue;
+  utils::TimerWheel<CoroutineHandle> m_wheel;
   oatpp::concurrency::SpinLock m_backlogLock;
   std::condition_variable_any m_backlogCondition;
 private:
   std::chrono::duration<v_int64, std::micro> m_granularity;
+  std::chrono::steady_clock::time_point m_startTime;
+  v_int64 m_systemNowMicroseconds;
+  v_int64 m_steadyNowMicroseconds;
 private:
   std::thread m_thread;
 private:
+  void updateTime();
+  void schedule(CoroutineHandle* coroutine);
+  void processExpired(CoroutineHandle* coroutine);
   void consumeBacklog();
 public:
 
@@ -59,6 +69,11 @@ public:
    */
   TimerWorker(const std::chrono::duration<v_int64, std::micro>& granularity = std::chrono::milliseconds(100));
 
+  /**
+   * Virtual destructor.
+   */
+  ~TimerWorker() override;
+
   /**
    * Push list of tasks to worker.
    * @param tasks - &id:oatpp::aysnc::utils::FastQueue; of &id:oatpp::async::CoroutineHandle;.
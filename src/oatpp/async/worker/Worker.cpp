@@ -50,6 +50,43 @@ CoroutineHandle* Worker::nextCoroutine(CoroutineHandle* coroutine) {
   return coroutine->_ref;
 }
 
+Action Worker::runLocally(CoroutineHandle* coroutine, Action&& action, const LocalRunBudget& budget) {
+
+  auto deadline = std::chrono::steady_clock::now() + budget.maxTime;
+
+  for(v_int32 step = 0; step < budget.maxSteps; step ++) {
+
+    action = coroutine->takeAction(std::move(action));
+
+    if(coroutine->finished()) {
+      /* Finished coroutine has to be released by its processor */
+      return std::move(action);
+    }
+
+    switch(action.getType()) {
+
+      case Action::TYPE_NONE:
+      case Action::TYPE_REPEAT:
+      case Action::TYPE_YIELD_TO:
+        break;
+
+      default:
+        return std::move(action);
+
+    }
+
+    if(std::chrono::steady_clock::now() >= deadline) {
+      break;
+    }
+
+    action = coroutine->iterate();
+
+  }
+
+  return std::move(action);
+
+}
+
 Worker::Type Worker::getType() {
   return m_type;
 }
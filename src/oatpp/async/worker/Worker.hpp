@@ -27,6 +27,7 @@
 
 #include "oatpp/async/Coroutine.hpp"
 #include <thread>
+#include <chrono>
 
 namespace oatpp { namespace async { namespace worker {
 
@@ -57,10 +58,36 @@ public:
      */
     IO = 2,
 
+    /**
+     * Worker type - blocking calls processor.
+     */
+    BLOCKING = 3,
+
     /**
      * Number of types in this enum.
      */
-    TYPES_COUNT = 3
+    TYPES_COUNT = 4
+
+  };
+
+  /**
+   * Run-to-completion budget of I/O workers. <br>
+   * When I/O worker resumes a coroutine and coroutine's next action is not an I/O wait,
+   * the worker keeps iterating the coroutine on its own thread instead of pushing it back to the &id:oatpp::async::Processor;.
+   * It stops when the coroutine waits for I/O again, needs its processor (timer, wait-list, finish), or the budget is exhausted. <br>
+   * `maxSteps == 0` disables the mode (default).
+   */
+  struct LocalRunBudget {
+
+    /**
+     * Max number of coroutine steps to run on the I/O worker thread.
+     */
+    v_int32 maxSteps = 0;
+
+    /**
+     * Max time to run one coroutine on the I/O worker thread.
+     */
+    std::chrono::microseconds maxTime = std::chrono::microseconds(100);
 
   };
 
@@ -72,6 +99,15 @@ protected:
   static Processor* getCoroutineProcessor(CoroutineHandle* coroutine);
   static void dismissAction(Action& action);
   static CoroutineHandle* nextCoroutine(CoroutineHandle* coroutine);
+
+  /**
+   * Continue iterating coroutine on the current thread within the budget.
+   * @param coroutine - coroutine to iterate.
+   * @param action - action returned by the last iteration.
+   * @param budget - &l:Worker::LocalRunBudget;.
+   * @return - action to schedule.
+   */
+  static Action runLocally(CoroutineHandle* coroutine, Action&& action, const LocalRunBudget& budget);
 public:
 
   /**
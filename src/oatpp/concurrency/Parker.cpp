@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Parker.hpp"
+
+#if defined(OATPP_PARKER_FUTEX)
+  #include <linux/futex.h>
+  #include <time.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+namespace oatpp { namespace concurrency {
+
+Parker::Parker()
+  : m_state(STATE_RUNNING)
+{}
+
+void Parker::prepare() {
+  m_state.store(STATE_PARKED, std::memory_order_seq_cst);
+}
+
+void Parker::cancel() {
+  m_state.store(STATE_RUNNING, std::memory_order_relaxed);
+}
+
+#if defined(OATPP_PARKER_FUTEX)
+
+void Parker::park() {
+  if(m_state.load(std::memory_order_acquire) == STATE_PARKED) {
+    syscall(SYS_futex, reinterpret_cast<int*>(&m_state), FUTEX_WAIT_PRIVATE, STATE_PARKED, nullptr, nullptr, 0);
+  }
+  m_state.store(STATE_RUNNING, std::memory_order_relaxed);
+}
+
+void Parker::park(const std::chrono::microseconds& timeout) {
+  if(m_state.load(std::memory_order_acquire) == STATE_PARKED) {
+    timespec ts;
+    ts.tv_sec = timeout.count() / 1000000;
+    ts.tv_nsec = (timeout.count() % 1000000) * 1000;
+    syscall(SYS_futex, reinterpret_cast<int*>(&m_state), FUTEX_WAIT_PRIVATE, STATE_PARKED, &ts, nullptr, 0);
+  }
+  m_state.store(STATE_RUNNING, std::memory_order_relaxed);
+}
+
+void Parker::unpark() {
+  if(m_state.load(std::memory_order_seq_cst) == STATE_PARKED &&
+     m_state.exchange(STATE_RUNNING, std::memory_order_seq_cst) == STATE_PARKED)
+  {
+    syscall(SYS_futex, reinterpret_cast<int*>(&m_state), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+  }
+}
+
+#else
+
+void Parker::park() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while(m_state.load(std::memory_order_acquire) == STATE_PARKED) {
+    m_cv.wait(lock);
+  }
+}
+
+void Parker::park(const std::chrono::microseconds& timeout) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cv.wait_for(lock, timeout, [this]{
+    return m_state.load(std::memory_order_acquire) != STATE_PARKED;
+  });
+  m_state.store(STATE_RUNNING, std::memory_order_relaxed);
+}
+
+void Parker::unpark() {
+  if(m_state.load(std::memory_order_seq_cst) == STATE_PARKED) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_state.store(STATE_RUNNING, std::memory_order_seq_cst);
+    }
+    m_cv.notify_one();
+  }
+}
+
+#endif
+
+}}
@@ -0,0 +1,95 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_concurrency_Parker_hpp
+#define oatpp_concurrency_Parker_hpp
+
+#include <atomic>
+#include <chrono>
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+  #define OATPP_PARKER_FUTEX
+#else
+  #include <condition_variable>
+  #include <mutex>
+#endif
+
+namespace oatpp { namespace concurrency {
+
+/**
+ * Single-consumer thread parking primitive.<br>
+ * Consumer announces itself parked with &l:Parker::prepare ();, re-checks its wait condition,
+ * and then calls &l:Parker::park ();. Producers call &l:Parker::unpark (); after publishing work -
+ * it's a single atomic load unless the consumer is actually parked.<br>
+ * Uses futex on Linux, mutex with condition variable elsewhere.
+ */
+class Parker {
+private:
+  static constexpr int STATE_RUNNING = 0;
+  static constexpr int STATE_PARKED = 1;
+private:
+  std::atomic<int> m_state;
+#if !defined(OATPP_PARKER_FUTEX)
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+#endif
+public:
+
+  /**
+   * Constructor.
+   */
+  Parker();
+
+  /**
+   * Announce that consumer is about to park. Consumer thread only.
+   * Consumer must re-check its wait condition after this call.
+   */
+  void prepare();
+
+  /**
+   * Cancel parking announced by &l:Parker::prepare ();. Consumer thread only.
+   */
+  void cancel();
+
+  /**
+   * Block until &l:Parker::unpark (); is called. May return spuriously. Consumer thread only.
+   */
+  void park();
+
+  /**
+   * Block until &l:Parker::unpark (); is called or timeout expires. May return spuriously. Consumer thread only.
+   * @param timeout
+   */
+  void park(const std::chrono::microseconds& timeout);
+
+  /**
+   * Wake consumer if it's parked. Thread-safe.
+   */
+  void unpark();
+
+};
+
+}}
+
+#endif /* oatpp_concurrency_Parker_hpp */
@@ -42,7 +42,7 @@ template<typename Key, typename MapType>
 class LazyStringMapTemplate {
 public:
   typedef oatpp::data::type::String String;
-private:
+protected:
   mutable concurrency::SpinLock m_lock;
   mutable bool m_fullyInitialized;
   MapType m_map;
@@ -253,7 +253,7 @@ public:
     auto it = m_map.find(key);
 
     if(it != m_map.end()) {
-      it->second.captureToOwnMemory();
+      it->second.retainMemory();
       const auto& label = it->second;
       return T(label.getMemoryHandle(), reinterpret_cast<const char*>(label.getData()), label.getSize());
     }
@@ -296,8 +296,8 @@ public:
     if(!m_fullyInitialized) {
 
       for(auto& pair : m_map) {
-        pair.first.captureToOwnMemory();
-        pair.second.captureToOwnMemory();
+        pair.first.retainMemory();
+        pair.second.retainMemory();
       }
 
       m_fullyInitialized = true;
@@ -119,6 +119,18 @@ public:
     }
   }
 
+  /**
+   * Make sure labeled data is kept alive by the memory handle.
+   * Unlike &l:MemoryLabel::captureToOwnMemory ();, data is copied only if the label has no memory handle.
+   * A label pointing to a part of a shared buffer keeps pointing to that buffer.
+   */
+  void retainMemory() const {
+    if(!m_memoryHandle) {
+      m_memoryHandle = std::make_shared<std::string>(reinterpret_cast<const char*>(m_data), m_size);
+      m_data = m_memoryHandle->data();
+    }
+  }
+
   /**
    * Check if labeled data equals to data specified.
    * Data is compared using &id:oatpp::urils::String::compare;.
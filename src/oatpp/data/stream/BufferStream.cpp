@@ -60,6 +60,28 @@ v_io_size BufferOutputStream::write(const void *data, v_buff_size count, async::
 
 }
 
+v_io_size BufferOutputStream::writev(const WriteSegment* segments, v_int32 count, async::Action& action) {
+
+  (void) action;
+
+  v_buff_size total = 0;
+  for(v_int32 i = 0; i < count; i ++) {
+    total += segments[i].size;
+  }
+
+  reserveBytesUpfront(total);
+
+  for(v_int32 i = 0; i < count; i ++) {
+    if(segments[i].size > 0) {
+      std::memcpy(m_data + m_position, segments[i].data, static_cast<size_t>(segments[i].size));
+      m_position += segments[i].size;
+    }
+  }
+
+  return total;
+
+}
+
 void BufferOutputStream::setOutputStreamIOMode(IOMode ioMode) {
   m_ioMode = ioMode;
 }
@@ -67,6 +67,16 @@ public:
    */
   v_io_size write(const void *data, v_buff_size count, async::Action& action) override;
 
+  /**
+   * Write all segments. Reserves space for all of them at once.
+   * @param segments - array of &id:oatpp::data::stream::WriteSegment;.
+   * @param count - number of segments in the array.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual number of bytes written. &id:oatpp::v_io_size;.
+   */
+  v_io_size writev(const WriteSegment* segments, v_int32 count, async::Action& action) override;
+
   /**
    * Set stream I/O mode.
    * @throws
@@ -130,6 +130,127 @@ async::CoroutineStarter WriteCallback::writeExactSizeDataAsync(const void* data,
 
 }
 
+v_io_size WriteCallback::writev(const WriteSegment* segments, v_int32 count, async::Action& action) {
+
+  v_io_size progress = 0;
+
+  for(v_int32 i = 0; i < count; i ++) {
+
+    const auto& segment = segments[i];
+    if(segment.size == 0) {
+      continue;
+    }
+
+    auto res = write(segment.data, segment.size, action);
+
+    if(res <= 0) {
+      if(progress > 0) {
+        /* report what is already written. The caller will retry the rest */
+        action = async::Action();
+        return progress;
+      }
+      return res;
+    }
+
+    progress += res;
+
+    if(res < segment.size || !action.isNone()) {
+      break;
+    }
+
+  }
+
+  return progress;
+
+}
+
+v_buff_size WriteCallback::advanceSegments(WriteSegment* segments, v_int32 count, v_io_size written) {
+  v_buff_size bytesLeft = 0;
+  for(v_int32 i = 0; i < count; i ++) {
+    auto& segment = segments[i];
+    if(written > 0) {
+      if(written >= segment.size) {
+        written -= segment.size;
+        segment.size = 0;
+      } else {
+        segment.data = reinterpret_cast<const v_char8*>(segment.data) + written;
+        segment.size -= written;
+        written = 0;
+      }
+    }
+    bytesLeft += segment.size;
+  }
+  return bytesLeft;
+}
+
+v_io_size WriteCallback::writevExactSizeDataSimple(WriteSegment* segments, v_int32 count) {
+
+  v_io_size progress = 0;
+  v_buff_size bytesLeft = advanceSegments(segments, count, 0);
+
+  while(bytesLeft > 0) {
+
+    async::Action action;
+    auto res = writev(segments, count, action);
+
+    if(!action.isNone()) {
+      OATPP_LOGe("[oatpp::data::stream::WriteCallback::writevExactSizeDataSimple()]", "Error. writevExactSizeDataSimple() is called on a stream in Async mode.")
+      throw std::runtime_error("[oatpp::data::stream::WriteCallback::writevExactSizeDataSimple()]: Error. writevExactSizeDataSimple() is called on a stream in Async mode.");
+    }
+
+    if(res > 0) {
+      progress += res;
+      bytesLeft = advanceSegments(segments, count, res);
+    } else if(res == IOError::BROKEN_PIPE || res == IOError::ZERO_VALUE) {
+      break;
+    }
+
+  }
+
+  return progress;
+
+}
+
+async::Action WriteCallback::writevExactSizeDataAsyncInline(WriteSegment* segments, v_int32 count, async::Action&& nextAction) {
+
+  if(advanceSegments(segments, count, 0) > 0) {
+
+    async::Action action;
+    auto res = writev(segments, count, action);
+
+    if (res > 0) {
+      advanceSegments(segments, count, res);
+    }
+
+    if (!action.isNone()) {
+      return action;
+    }
+
+    if (res > 0) {
+      return async::Action::createActionByType(async::Action::TYPE_REPEAT);
+    } else {
+      switch (res) {
+        case IOError::BROKEN_PIPE:
+          return new AsyncIOError(IOError::BROKEN_PIPE);
+        case IOError::ZERO_VALUE:
+          break;
+        case IOError::RETRY_READ:
+          return async::Action::createActionByType(async::Action::TYPE_REPEAT);
+        case IOError::RETRY_WRITE:
+          return async::Action::createActionByType(async::Action::TYPE_REPEAT);
+        default:
+          OATPP_LOGe("[oatpp::data::stream::writevExactSizeDataAsyncInline()]", "Error. Unknown IO result.")
+          return new async::Error(
+            "[oatpp::data::stream::writevExactSizeDataAsyncInline()]: Error. Unknown IO result.");
+      }
+    }
+
+  }
+
+  return std::forward<async::Action>(nextAction);
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ReadCallback
 
@@ -570,6 +691,27 @@ v_int32 StatelessDataTransferProcessor::iterate(data::buffer::InlineReadData& da
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Other functions
 
+namespace {
+
+  /*
+   * Small processor outputs (such as chunk headers) are not written right away.
+   * They are copied to the carry buffer and written together with the next output in one `writev` call.
+   */
+  constexpr v_buff_size TRANSFER_CARRY_SIZE = 64;
+  constexpr v_buff_size TRANSFER_CARRY_MAX_OUTPUT = 32;
+
+  bool carryOutput(v_char8* carry, v_buff_size& carrySize, data::buffer::InlineReadData& outData) {
+    if(outData.bytesLeft <= TRANSFER_CARRY_MAX_OUTPUT && carrySize + outData.bytesLeft <= TRANSFER_CARRY_SIZE) {
+      std::memcpy(carry + carrySize, outData.currBufferPtr, static_cast<size_t>(outData.bytesLeft));
+      carrySize += outData.bytesLeft;
+      outData.setEof();
+      return true;
+    }
+    return false;
+  }
+
+}
+
 v_io_size transfer(const base::ObjectHandle<ReadCallback>& readCallback,
                          const base::ObjectHandle<WriteCallback>& writeCallback,
                          v_io_size transferSize,
@@ -581,6 +723,9 @@ v_io_size transfer(const base::ObjectHandle<ReadCallback>& readCallback,
   data::buffer::InlineReadData inData;
   data::buffer::InlineReadData outData;
 
+  v_char8 carry[TRANSFER_CARRY_SIZE];
+  v_buff_size carrySize = 0;
+
   v_int32 procRes = data::buffer::Processor::Error::PROVIDE_DATA_IN;
   v_io_size progress = 0;
 
@@ -588,6 +733,15 @@ v_io_size transfer(const base::ObjectHandle<ReadCallback>& readCallback,
 
     if(procRes == data::buffer::Processor::Error::PROVIDE_DATA_IN && inData.bytesLeft == 0) {
 
+      /* don't hold data back while waiting for the input */
+      if(carrySize > 0) {
+        auto res = writeCallback->writeExactSizeDataSimple(carry, carrySize);
+        if(res < carrySize) {
+          return IOError::BROKEN_PIPE;
+        }
+        carrySize = 0;
+      }
+
       v_buff_size desiredToRead = processor->suggestInputStreamReadSize();
 
       if (desiredToRead > bufferSize) {
@@ -628,19 +782,27 @@ v_io_size transfer(const base::ObjectHandle<ReadCallback>& readCallback,
       }
 
       case data::buffer::Processor::Error::FLUSH_DATA_OUT: {
-        v_io_size res = IOError::RETRY_WRITE;
-        while(res == IOError::RETRY_WRITE || res == IOError::RETRY_READ) {
-          res = writeCallback->writeSimple(outData.currBufferPtr, outData.bytesLeft);
+        if(carryOutput(carry, carrySize, outData)) {
+          break;
         }
-        if(res > 0) {
-          outData.inc(res);
-        } else {
-          return progress;
+        WriteSegment segments[2] = {
+          {carry, carrySize},
+          {outData.currBufferPtr, outData.bytesLeft}
+        };
+        auto size = carrySize + outData.bytesLeft;
+        auto res = writeCallback->writevExactSizeDataSimple(segments, 2);
+        if(res < size) {
+          return IOError::BROKEN_PIPE;
         }
+        carrySize = 0;
+        outData.setEof();
         break;
       }
 
       case data::buffer::Processor::Error::FINISHED:
+        if(carrySize > 0 && writeCallback->writeExactSizeDataSimple(carry, carrySize) < carrySize) {
+          return IOError::BROKEN_PIPE;
+        }
         return progress;
 
       default:
@@ -674,9 +836,12 @@ async::CoroutineStarter transferAsync(const base::ObjectHandle<ReadCallback>& re
   private:
     v_int32 m_procRes;
     data::buffer::InlineReadData m_readData;
-    data::buffer::InlineWriteData m_writeData;
     data::buffer::InlineReadData m_inData;
     data::buffer::InlineReadData m_outData;
+  private:
+    v_char8 m_carry[TRANSFER_CARRY_SIZE];
+    v_buff_size m_carrySize;
+    WriteSegment m_segments[2];
   public:
 
     TransferCoroutine(const base::ObjectHandle<ReadCallback>& readCallback,
@@ -692,6 +857,7 @@ async::CoroutineStarter transferAsync(const base::ObjectHandle<ReadCallback>& re
       , m_progress(0)
       , m_procRes(data::buffer::Processor::Error::PROVIDE_DATA_IN)
       , m_readData(buffer->getData(), buffer->getSize())
+      , m_carrySize(0)
     {}
 
     Action act() override {
@@ -784,17 +950,29 @@ async::CoroutineStarter transferAsync(const base::ObjectHandle<ReadCallback>& re
 
         case data::buffer::Processor::Error::PROVIDE_DATA_IN: {
           m_readData.set(m_buffer->getData(), m_buffer->getSize());
+          if(m_carrySize > 0) {
+            /* don't hold data back while waiting for the input */
+            takeCarry(nullptr, 0);
+            return yieldTo(&TransferCoroutine::flushData);
+          }
           return yieldTo(&TransferCoroutine::act);
         }
 
         case data::buffer::Processor::Error::FLUSH_DATA_OUT: {
           m_readData.set(m_buffer->getData(), m_buffer->getSize());
-          m_writeData.set(m_outData.currBufferPtr, m_outData.bytesLeft);
+          if(carryOutput(m_carry, m_carrySize, m_outData)) {
+            return yieldTo(&TransferCoroutine::act);
+          }
+          takeCarry(m_outData.currBufferPtr, m_outData.bytesLeft);
           m_outData.setEof();
           return yieldTo(&TransferCoroutine::flushData);
         }
 
         case data::buffer::Processor::Error::FINISHED:
+          if(m_carrySize > 0) {
+            takeCarry(nullptr, 0);
+            return yieldTo(&TransferCoroutine::flushDataAndFinish);
+          }
           return finish();
 
         default:
@@ -804,8 +982,18 @@ async::CoroutineStarter transferAsync(const base::ObjectHandle<ReadCallback>& re
 
     }
 
+    void takeCarry(const void* data, v_buff_size size) {
+      m_segments[0] = {m_carry, m_carrySize};
+      m_segments[1] = {data, size};
+      m_carrySize = 0;
+    }
+
     Action flushData() {
-      return m_writeCallback->writeExactSizeDataAsyncInline(m_writeData, yieldTo(&TransferCoroutine::act));
+      return m_writeCallback->writevExactSizeDataAsyncInline(m_segments, 2, yieldTo(&TransferCoroutine::act));
+    }
+
+    Action flushDataAndFinish() {
+      return m_writeCallback->writevExactSizeDataAsyncInline(m_segments, 2, finish());
     }
 
   };
@@ -191,12 +191,34 @@ enum IOMode : v_int32 {
   ASYNCHRONOUS = 1
 };
 
+/**
+ * One segment of the vectored (scatter-gather) write. See &l:WriteCallback::writev ();.
+ */
+struct WriteSegment {
+
+  /**
+   * Pointer to segment data.
+   */
+  const void* data;
+
+  /**
+   * Size of the segment data in bytes.
+   */
+  v_buff_size size;
+
+};
+
 /**
  * Callback for stream write operation.
  */
 class WriteCallback {
 public:
 
+  /**
+   * Max number of segments passed to the underlying system call by a single &l:WriteCallback::writev ();.
+   */
+  static constexpr v_int32 WRITEV_MAX_SEGMENTS = 64;
+
   /**
    * Default virtual destructor.
    */
@@ -224,6 +246,46 @@ public:
 
   async::CoroutineStarter writeExactSizeDataAsync(const void* data, v_buff_size size);
 
+  /**
+   * Vectored (scatter-gather) write operation. Write data of several segments with as few underlying calls as possible.<br>
+   * *The default implementation calls &l:WriteCallback::write (); for each segment and returns
+   * on the first partial write. Streams which can do better (e.g. sockets) should override this method.*
+   * @param segments - array of &l:WriteSegment;. Empty segments are skipped.
+   * @param count - number of segments in the array.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual number of bytes written (in total). May be less than the size of all segments.
+   */
+  virtual v_io_size writev(const WriteSegment* segments, v_int32 count, async::Action& action);
+
+  /**
+   * Write all data of all segments. Blocking. <br>
+   * Segments are advanced in place as data gets written - written segments are left with `size == 0`.
+   * @param segments - array of &l:WriteSegment;.
+   * @param count - number of segments in the array.
+   * @return - actual number of bytes written (in total). &id:oatpp::v_io_size;.
+   */
+  v_io_size writevExactSizeDataSimple(WriteSegment* segments, v_int32 count);
+
+  /**
+   * Write all data of all segments in an async manner. <br>
+   * Segments are advanced in place as data gets written - the `segments` array MUST stay valid until `nextAction` is returned.
+   * @param segments - array of &l:WriteSegment;.
+   * @param count - number of segments in the array.
+   * @param nextAction - action to return once all data is written.
+   * @return - &id:oatpp::async::Action;.
+   */
+  async::Action writevExactSizeDataAsyncInline(WriteSegment* segments, v_int32 count, async::Action&& nextAction);
+
+  /**
+   * Advance segments by the number of bytes written.
+   * @param segments - array of &l:WriteSegment;.
+   * @param count - number of segments in the array.
+   * @param written - number of bytes written.
+   * @return - number of bytes left in all segments.
+   */
+  static v_buff_size advanceSegments(WriteSegment* segments, v_int32 count, v_io_size written);
+
   /**
    * Same as `write((p_char8)data, std::strlen(data));`.
    * @param data - data to write.
@@ -538,7 +600,8 @@ public:
  * @param buffer - pointer to buffer used to do the transfer by chunks.
  * @param bufferSize - size of the buffer.
  * @param processor - data processing to be applied during the transfer.
- * @return - the actual amout of bytes read from the `readCallback`.
+ * @return - the actual amout of bytes read from the `readCallback`, or &id:oatpp::IOError::BROKEN_PIPE; if the output
+ * couldn't be written to the `writeCallback` in full.
  */
 v_io_size transfer(const base::ObjectHandle<ReadCallback>& readCallback,
                    const base::ObjectHandle<WriteCallback>& writeCallback,
@@ -30,6 +30,7 @@
 #else
   #include <unistd.h>
   #include <sys/socket.h>
+  #include <sys/uio.h>
 #endif
 
 #include <thread>
@@ -72,6 +73,11 @@ Connection::Connection(v_io_handle handle)
 
 }
 
+Connection::Connection(v_io_handle handle, data::stream::IOMode mode)
+  : m_handle(handle)
+  , m_mode(mode)
+{}
+
 Connection::~Connection(){
   close();
 }
@@ -156,6 +162,75 @@ v_io_size Connection::write(const void *buff, v_buff_size count, async::Action&
 #pragma GCC diagnostic ignored "-Wlogical-op"
 #endif
 
+v_io_size Connection::writev(const data::stream::WriteSegment* segments, v_int32 count, async::Action& action) {
+
+#if defined(WIN32) || defined(_WIN32)
+
+  return WriteCallback::writev(segments, count, action);
+
+#else
+
+  iovec iov[WRITEV_MAX_SEGMENTS];
+  v_int32 iovCount = 0;
+
+  for(v_int32 i = 0; i < count && iovCount < WRITEV_MAX_SEGMENTS; i ++) {
+    if(segments[i].size > 0) {
+      iov[iovCount].iov_base = const_cast<void*>(segments[i].data);
+      iov[iovCount].iov_len = static_cast<size_t>(segments[i].size);
+      iovCount ++;
+    }
+  }
+
+  if(iovCount == 0) {
+    return 0;
+  }
+
+  msghdr msg {};
+  msg.msg_iov = iov;
+  msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(iovCount);
+
+  errno = 0;
+  v_int32 flags = 0;
+
+#ifdef MSG_NOSIGNAL
+  flags |= MSG_NOSIGNAL;
+#endif
+
+  auto result = ::sendmsg(m_handle, &msg, flags);
+
+  if(result < 0) {
+    auto e = errno;
+
+    bool retry = ((e == EAGAIN) || (e == EWOULDBLOCK));
+
+    if(retry){
+      if(m_mode == data::stream::ASYNCHRONOUS) {
+        action = oatpp::async::Action::createIOWaitAction(m_handle, oatpp::async::Action::IOEventType::IO_EVENT_WRITE);
+      }
+      return IOError::RETRY_WRITE; // For async io. In case socket is non-blocking
+    }
+
+    if(e == EINTR) {
+      return IOError::RETRY_WRITE;
+    }
+
+    return IOError::BROKEN_PIPE; // Consider all other errors as a broken pipe.
+  }
+  return result;
+
+#endif
+
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wlogical-op"
+#endif
+
 v_io_size Connection::read(void *buff, v_buff_size count, async::Action& action){
 
 #if defined(WIN32) || defined(_WIN32)
@@ -249,6 +324,11 @@ void Connection::setStreamIOMode(oatpp::data::stream::IOMode ioMode) {
 #else
 void Connection::setStreamIOMode(oatpp::data::stream::IOMode ioMode) {
 
+  /* m_mode always reflects the actual state of the handle - no need for syscalls */
+  if(m_mode == ioMode) {
+    return;
+  }
+
   auto flags = fcntl(m_handle, F_GETFL);
   if (flags < 0) {
     throw std::runtime_error("[oatpp::network::tcp::Connection::setStreamIOMode()]: Error. Can't get socket flags.");
@@ -46,6 +46,14 @@ public:
    * @param handle - file descriptor (socket handle). See &id:oatpp::v_io_handle;.
    */
   Connection(v_io_handle handle);
+
+  /**
+   * Constructor for the handle with known I/O mode. <br>
+   * Skips querying socket flags - use it when the handle was created with the known mode (ex.: by `accept4`).
+   * @param handle - file descriptor (socket handle). See &id:oatpp::v_io_handle;.
+   * @param mode - current I/O mode of the handle. &id:oatpp::data::stream::IOMode;.
+   */
+  Connection(v_io_handle handle, data::stream::IOMode mode);
 public:
 
   /**
@@ -64,6 +72,17 @@ public:
    */
   v_io_size write(const void *buff, v_buff_size count, async::Action& action) override;
 
+  /**
+   * Implementation of &id:oatpp::data::stream::WriteCallback::writev;. <br>
+   * Writes all segments with a single `sendmsg` call (emulated on Windows).
+   * @param segments - array of &id:oatpp::data::stream::WriteSegment;.
+   * @param count - number of segments in the array.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual amount of bytes written. See &id:oatpp::v_io_size;.
+   */
+  v_io_size writev(const data::stream::WriteSegment* segments, v_int32 count, async::Action& action) override;
+
   /**
    * Implementation of &id:oatpp::data::stream::IOStream::read;.
    * @param buff - buffer to read data to.
@@ -25,6 +25,7 @@
 #include "./ConnectionProvider.hpp"
 
 #include "oatpp/network/tcp/Connection.hpp"
+#include "oatpp/async/BlockingCall.hpp"
 #include "oatpp/utils/Conversion.hpp"
 #include "oatpp/base/Log.hpp"
 
@@ -171,6 +172,8 @@ oatpp::async::CoroutineStarterForResult<const provider::ResourceHandle<data::str
     network::Address m_address;
     oatpp::v_io_handle m_clientHandle;
   private:
+    oatpp::String m_portStr;
+    addrinfo m_hints;
     addrinfo* m_result;
     addrinfo* m_currentResult;
     bool m_isHandleOpened;
@@ -193,25 +196,30 @@ oatpp::async::CoroutineStarterForResult<const provider::ResourceHandle<data::str
 
     Action act() override {
 
-      auto portStr = oatpp::utils::Conversion::int32ToStr(m_address.port);
+      m_portStr = oatpp::utils::Conversion::int32ToStr(m_address.port);
 
-      addrinfo hints;
-
-      memset(&hints, 0, sizeof(addrinfo));
-      hints.ai_socktype = SOCK_STREAM;
-      hints.ai_flags = 0;
-      hints.ai_protocol = 0;
+      memset(&m_hints, 0, sizeof(addrinfo));
+      m_hints.ai_socktype = SOCK_STREAM;
+      m_hints.ai_flags = 0;
+      m_hints.ai_protocol = 0;
 
       switch(m_address.family) {
-        case Address::IP_4: hints.ai_family = AF_INET; break;
-        case Address::IP_6: hints.ai_family = AF_INET6; break;
+        case Address::IP_4: m_hints.ai_family = AF_INET; break;
+        case Address::IP_6: m_hints.ai_family = AF_INET6; break;
         case Address::UNSPEC:
         default:
-          hints.ai_family = AF_UNSPEC;
+          m_hints.ai_family = AF_UNSPEC;
       }
 
-      // TODO make call to get addrinfo non-blocking !!!
-      auto res = getaddrinfo(m_address.host->c_str(), portStr->c_str(), &hints, &m_result);
+      // getaddrinfo() may block on DNS - run it on the blocking worker
+      return async::BlockingCall<v_int32>::startForResult([this]() {
+        return getaddrinfo(m_address.host->c_str(), m_portStr->c_str(), &m_hints, &m_result);
+      }).callbackTo(&ConnectCoroutine::onAddrInfo);
+
+    }
+
+    Action onAddrInfo(const v_int32& res) {
+
       if (res != 0) {
         return error<async::Error>(
           "[oatpp::network::tcp::client::ConnectionProvider::getConnectionAsync()]. Error. Call to getaddrinfo() failed.");
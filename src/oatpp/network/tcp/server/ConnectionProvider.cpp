@@ -42,6 +42,12 @@
   #if defined(__FreeBSD__)
     #include <netinet/in.h>
   #endif
+  #if defined(__linux__)
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+  #else
+    #include <poll.h>
+  #endif
 #endif
 
 
@@ -71,6 +77,51 @@
 
 namespace oatpp { namespace network { namespace tcp { namespace server {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ConnectionProvider::AcceptBatch
+
+struct ConnectionProvider::AcceptedConnection {
+  v_io_handle handle;
+  sockaddr_storage address;
+  v_sock_size addressSize;
+  bool nonBlocking; // handle is known to be non-blocking (accept4 with SOCK_NONBLOCK)
+};
+
+struct ConnectionProvider::AcceptBatch {
+  static constexpr v_int32 MAX_SIZE = 64;
+  AcceptedConnection connections[MAX_SIZE];
+  v_int32 size = 0;
+  v_int32 position = 0;
+};
+
+namespace {
+
+/**
+ * Connection which keeps &id:oatpp::network::tcp::server::ConnectionProvider::Statistics::openConnections; up to date.
+ */
+template<class ConnectionType>
+class CountedConnection : public ConnectionType {
+private:
+  std::shared_ptr<ConnectionProvider::Statistics> m_statistics;
+public:
+
+  template<class ... Args>
+  CountedConnection(const std::shared_ptr<ConnectionProvider::Statistics>& statistics, Args&&... args)
+    : ConnectionType(std::forward<Args>(args)...)
+    , m_statistics(statistics)
+  {
+    m_statistics->acceptedConnections ++;
+    m_statistics->openConnections ++;
+  }
+
+  ~CountedConnection() override {
+    m_statistics->openConnections --;
+  }
+
+};
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ExtendedConnection
 
@@ -83,6 +134,13 @@ ConnectionProvider::ExtendedConnection::ExtendedConnection(v_io_handle handle, d
   , m_context(data::stream::StreamType::STREAM_INFINITE, std::forward<data::stream::Context::Properties>(properties))
 {}
 
+ConnectionProvider::ExtendedConnection::ExtendedConnection(v_io_handle handle,
+                                                           data::stream::IOMode mode,
+                                                           data::stream::Context::Properties&& properties)
+  : Connection(handle, mode)
+  , m_context(data::stream::StreamType::STREAM_INFINITE, std::forward<data::stream::Context::Properties>(properties))
+{}
+
 oatpp::data::stream::Context& ConnectionProvider::ExtendedConnection::getOutputStreamContext() {
   return m_context;
 }
@@ -123,15 +181,21 @@ void ConnectionProvider::ConnectionInvalidator::invalidate(const std::shared_ptr
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ConnectionProvider
 
-ConnectionProvider::ConnectionProvider(const network::Address& address, bool useExtendedConnections)
+ConnectionProvider::ConnectionProvider(const network::Address& address, bool useExtendedConnections, bool reusePort)
         : m_invalidator(std::make_shared<ConnectionInvalidator>())
         , m_address(address)
         , m_closed(false)
         , m_useExtendedConnections(useExtendedConnections)
+        , m_reusePort(reusePort)
+        , m_statistics(std::make_shared<Statistics>())
+        , m_acceptBatch(new AcceptBatch())
+        , m_acceptEventQueue(INVALID_IO_HANDLE)
+        , m_stopTrigger(INVALID_IO_HANDLE)
 {
   setProperty(PROPERTY_HOST, m_address.host);
   setProperty(PROPERTY_PORT, oatpp::utils::Conversion::int32ToStr(m_address.port));
   m_serverHandle = instantiateServer();
+  initAcceptEvents();
 }
 
 void ConnectionProvider::setConnectionConfigurer(const std::shared_ptr<ConnectionConfigurer> &connectionConfigurer) {
@@ -139,12 +203,37 @@ void ConnectionProvider::setConnectionConfigurer(const std::shared_ptr<Connectio
 }
 
 ConnectionProvider::~ConnectionProvider() {
+
   stop();
+
+  /* Close accepted connections which were never handed out */
+  for(v_int32 i = m_acceptBatch->position; i < m_acceptBatch->size; i ++) {
+#if defined(WIN32) || defined(_WIN32)
+    ::closesocket(m_acceptBatch->connections[i].handle);
+#else
+    ::close(m_acceptBatch->connections[i].handle);
+#endif
+  }
+
+#if defined(__linux__)
+  if(m_acceptEventQueue != INVALID_IO_HANDLE) {
+    ::close(m_acceptEventQueue);
+  }
+  if(m_stopTrigger != INVALID_IO_HANDLE) {
+    ::close(m_stopTrigger);
+  }
+#endif
+
 }
 
 void ConnectionProvider::stop() {
   if(!m_closed) {
     m_closed = true;
+#if defined(__linux__)
+    if(m_stopTrigger != INVALID_IO_HANDLE) {
+      ::eventfd_write(m_stopTrigger, 1);
+    }
+#endif
 #if defined(WIN32) || defined(_WIN32)
 	  ::closesocket(m_serverHandle);
 #else
@@ -192,6 +281,11 @@ oatpp::v_io_handle ConnectionProvider::instantiateServer(){
 
       int no = 0;
 
+      if (m_reusePort) {
+        OATPP_LOGw("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]",
+                   "Warning. {} is not supported on this platform.", "SO_REUSEPORT")
+      }
+
       if (hints.ai_family == AF_UNSPEC || hints.ai_family == AF_INET6) {
         if (setsockopt(serverHandle, IPPROTO_IPV6, IPV6_V6ONLY, (char*)&no, sizeof( int ) ) != 0 ) {
           const size_t buflen = 500;
@@ -285,6 +379,18 @@ oatpp::v_io_handle ConnectionProvider::instantiateServer(){
                    "Warning. Failed to set {} for accepting socket: {}", "SO_REUSEADDR", strerror(errno))
       }
 
+      if (m_reusePort) {
+#if defined(SO_REUSEPORT)
+        if (setsockopt(serverHandle, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(int)) != 0) {
+          OATPP_LOGw("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]",
+                     "Warning. Failed to set {} for accepting socket: {}", "SO_REUSEPORT", strerror(errno))
+        }
+#else
+        OATPP_LOGw("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]",
+                   "Warning. {} is not supported on this platform.", "SO_REUSEPORT")
+#endif
+      }
+
       if (bind(serverHandle, currResult->ai_addr, currResult->ai_addrlen) == 0 &&
           listen(serverHandle, 10000) == 0)
       {
@@ -340,50 +446,197 @@ void ConnectionProvider::prepareConnectionHandle(oatpp::v_io_handle handle) {
 
 }
 
-provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::getDefaultConnection() {
+#if defined(__linux__)
 
-  oatpp::v_io_handle handle = accept(m_serverHandle, nullptr, nullptr);
+void ConnectionProvider::initAcceptEvents() {
 
-  if(!oatpp::isValidIOHandle(handle)) {
-    return nullptr;
+  m_acceptEventQueue = ::epoll_create1(EPOLL_CLOEXEC);
+  m_stopTrigger = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+  if(m_acceptEventQueue == INVALID_IO_HANDLE || m_stopTrigger == INVALID_IO_HANDLE) {
+    OATPP_LOGe("[oatpp::network::tcp::server::ConnectionProvider::initAcceptEvents()]", "Error. Can't create epoll. errno={}", errno)
+    throw std::runtime_error("[oatpp::network::tcp::server::ConnectionProvider::initAcceptEvents()]: Error. Can't create epoll.");
   }
 
-  prepareConnectionHandle(handle);
+  epoll_event event{};
 
-  return provider::ResourceHandle<data::stream::IOStream>(
-    std::make_shared<Connection>(handle),
-      m_invalidator
-  );
+  event.events = EPOLLIN;
+  event.data.fd = m_serverHandle;
+  if(::epoll_ctl(m_acceptEventQueue, EPOLL_CTL_ADD, m_serverHandle, &event) != 0) {
+    throw std::runtime_error("[oatpp::network::tcp::server::ConnectionProvider::initAcceptEvents()]: Error. Call to epoll_ctl() failed.");
+  }
+
+  event.events = EPOLLIN;
+  event.data.fd = m_stopTrigger;
+  if(::epoll_ctl(m_acceptEventQueue, EPOLL_CTL_ADD, m_stopTrigger, &event) != 0) {
+    throw std::runtime_error("[oatpp::network::tcp::server::ConnectionProvider::initAcceptEvents()]: Error. Call to epoll_ctl() failed.");
+  }
 
 }
 
-provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::getExtendedConnection() {
+v_int32 ConnectionProvider::acceptBatch() {
 
-  sockaddr_storage clientAddress;
-  v_sock_size clientAddressSize = sizeof(clientAddress);
+  auto& batch = *m_acceptBatch;
+  batch.size = 0;
+  batch.position = 0;
 
-  data::stream::Context::Properties properties;
+  while(batch.size < AcceptBatch::MAX_SIZE) {
 
-  oatpp::v_io_handle handle = accept(m_serverHandle, reinterpret_cast<sockaddr*>(&clientAddress), &clientAddressSize);
+    auto& accepted = batch.connections[batch.size];
+    accepted.addressSize = sizeof(accepted.address);
+
+    auto handle = ::accept4(m_serverHandle, reinterpret_cast<sockaddr*>(&accepted.address), &accepted.addressSize,
+                            SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+    if(handle < 0) {
+      if(errno == EINTR || errno == ECONNABORTED) {
+        continue;
+      }
+      if(errno == EAGAIN || batch.size > 0) {
+        break;
+      }
+#if EAGAIN != EWOULDBLOCK
+      if(errno == EWOULDBLOCK) {
+        break;
+      }
+#endif
+      return -1;
+    }
+
+    accepted.handle = handle;
+    accepted.nonBlocking = true;
+    batch.size ++;
+
+  }
+
+  return batch.size;
+
+}
+
+void ConnectionProvider::waitForConnections() {
+  epoll_event events[2];
+  ::epoll_wait(m_acceptEventQueue, events, 2, 1000);
+}
+
+#else
+
+void ConnectionProvider::initAcceptEvents() {
+  // DO NOTHING
+}
+
+v_int32 ConnectionProvider::acceptBatch() {
+
+  auto& batch = *m_acceptBatch;
+  batch.size = 0;
+  batch.position = 0;
+
+  /* Accepting socket is non-blocking - accept until there are no pending connections */
+  while(batch.size < AcceptBatch::MAX_SIZE) {
+
+    auto& accepted = batch.connections[batch.size];
+    accepted.addressSize = sizeof(accepted.address);
+
+    auto handle = ::accept(m_serverHandle, reinterpret_cast<sockaddr*>(&accepted.address), &accepted.addressSize);
+
+    if(!oatpp::isValidIOHandle(handle)) {
+      if(batch.size > 0) {
+        break;
+      }
+#if defined(WIN32) || defined(_WIN32)
+      if(WSAGetLastError() == WSAEWOULDBLOCK) {
+        break;
+      }
+#else
+      if(errno == EAGAIN || errno == EINTR || errno == ECONNABORTED) {
+        break;
+      }
+#if EAGAIN != EWOULDBLOCK
+      if(errno == EWOULDBLOCK) {
+        break;
+      }
+#endif
+#endif
+      return -1;
+    }
+
+    accepted.handle = handle;
+    accepted.nonBlocking = false;
+    batch.size ++;
+
+  }
+
+  return batch.size;
+
+}
+
+#if defined(WIN32) || defined(_WIN32)
+
+void ConnectionProvider::waitForConnections() {
+
+  fd_set set;
+  timeval timeout;
+  FD_ZERO(&set);
+  FD_SET(m_serverHandle, &set);
+
+  timeout.tv_sec = 1;
+  timeout.tv_usec = 0;
+
+  select(static_cast<int>(m_serverHandle + 1), &set, nullptr, nullptr, &timeout);
+
+}
+
+#else
+
+void ConnectionProvider::waitForConnections() {
+  pollfd fd{};
+  fd.fd = m_serverHandle;
+  fd.events = POLLIN;
+  ::poll(&fd, 1, 1000);
+}
+
+#endif
+
+#endif
+
+provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::createConnection(const AcceptedConnection& accepted) {
+
+  auto handle = accepted.handle;
+  auto mode = data::stream::IOMode::ASYNCHRONOUS;
+
+  if(!m_useExtendedConnections) {
+
+    prepareConnectionHandle(handle);
+
+    if(accepted.nonBlocking) {
+      return provider::ResourceHandle<data::stream::IOStream>(
+        std::make_shared<CountedConnection<Connection>>(m_statistics, handle, mode),
+        m_invalidator
+      );
+    }
+
+    return provider::ResourceHandle<data::stream::IOStream>(
+      std::make_shared<CountedConnection<Connection>>(m_statistics, handle),
+      m_invalidator
+    );
 
-  if(!oatpp::isValidIOHandle(handle)) {
-    return nullptr;
   }
 
-  if (clientAddress.ss_family == AF_INET) {
+  data::stream::Context::Properties properties;
+
+  if (accepted.address.ss_family == AF_INET) {
 
     char strIp[INET_ADDRSTRLEN];
-    sockaddr_in* sockAddress = reinterpret_cast<sockaddr_in*>(&clientAddress);
+    const sockaddr_in* sockAddress = reinterpret_cast<const sockaddr_in*>(&accepted.address);
     inet_ntop(AF_INET, &sockAddress->sin_addr, strIp, INET_ADDRSTRLEN);
 
     properties.put_LockFree(ExtendedConnection::PROPERTY_PEER_ADDRESS, oatpp::String(reinterpret_cast<const char*>(strIp)));
     properties.put_LockFree(ExtendedConnection::PROPERTY_PEER_ADDRESS_FORMAT, "ipv4");
     properties.put_LockFree(ExtendedConnection::PROPERTY_PEER_PORT, oatpp::utils::Conversion::int32ToStr(sockAddress->sin_port));
 
-  } else if (clientAddress.ss_family == AF_INET6) {
+  } else if (accepted.address.ss_family == AF_INET6) {
 
     char strIp[INET6_ADDRSTRLEN];
-    sockaddr_in6* sockAddress = reinterpret_cast<sockaddr_in6*>(&clientAddress);
+    const sockaddr_in6* sockAddress = reinterpret_cast<const sockaddr_in6*>(&accepted.address);
     inet_ntop(AF_INET6, &sockAddress->sin6_addr, strIp, INET6_ADDRSTRLEN);
 
     properties.put_LockFree(ExtendedConnection::PROPERTY_PEER_ADDRESS, oatpp::String(reinterpret_cast<const char*>(strIp)));
@@ -398,15 +651,22 @@ provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::getExtended
     ::close(handle);
 #endif
 
-    OATPP_LOGe("[oatpp::network::tcp::server::ConnectionProvider::getExtendedConnection()]", "Error. Unknown address family.")
+    OATPP_LOGe("[oatpp::network::tcp::server::ConnectionProvider::createConnection()]", "Error. Unknown address family.")
     return nullptr;
 
   }
 
   prepareConnectionHandle(handle);
 
+  if(accepted.nonBlocking) {
+    return provider::ResourceHandle<data::stream::IOStream>(
+      std::make_shared<CountedConnection<ExtendedConnection>>(m_statistics, handle, mode, std::move(properties)),
+      m_invalidator
+    );
+  }
+
   return provider::ResourceHandle<data::stream::IOStream>(
-    std::make_shared<ExtendedConnection>(handle, std::move(properties)),
+    std::make_shared<CountedConnection<ExtendedConnection>>(m_statistics, handle, std::move(properties)),
     m_invalidator
   );
 
@@ -414,38 +674,38 @@ provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::getExtended
 
 provider::ResourceHandle<oatpp::data::stream::IOStream> ConnectionProvider::get() {
 
-  while(!m_closed) {
+  /* Take a pending connection. If there is none - wait (up to 1 second or until stop()) and try once again */
+  for(v_int32 attempt = 0; attempt < 2 && !m_closed; attempt ++) {
 
-    fd_set set;
-    timeval timeout;
-    FD_ZERO(&set);
-    FD_SET(m_serverHandle, &set);
+    if(attempt > 0) {
+      waitForConnections();
+    }
 
-    timeout.tv_sec = 1;
-    timeout.tv_usec = 0;
+    AcceptedConnection accepted;
+    accepted.handle = INVALID_IO_HANDLE;
 
-    auto res = select(
-#if defined(WIN32) || defined(_WIN32)
-      static_cast<int>(m_serverHandle + 1),
-#else
-      m_serverHandle + 1,
-#endif
-      &set,
-      nullptr,
-      nullptr,
-      &timeout);
+    {
+
+      std::lock_guard<std::mutex> lock(m_acceptLock);
+      auto& batch = *m_acceptBatch;
+
+      if(batch.position == batch.size && acceptBatch() < 0) {
+        return nullptr;
+      }
+
+      if(batch.position < batch.size) {
+        accepted = batch.connections[batch.position ++];
+      }
 
-    if (res >= 0) {
-      break;
     }
 
-  }
+    if(accepted.handle != INVALID_IO_HANDLE) {
+      return createConnection(accepted);
+    }
 
-  if(m_useExtendedConnections) {
-    return getExtendedConnection();
   }
 
-  return getDefaultConnection();
+  return nullptr;
 
 }
 
@@ -32,6 +32,8 @@
 
 #include "oatpp/Types.hpp"
 
+#include <mutex>
+
 namespace oatpp { namespace network { namespace tcp { namespace server {
 
 /**
@@ -47,6 +49,25 @@ private:
 
   };
 
+public:
+
+  /**
+   * Connection counters of the provider.
+   */
+  struct Statistics {
+
+    /**
+     * Total number of accepted connections.
+     */
+    std::atomic<v_uint64> acceptedConnections {0};
+
+    /**
+     * Number of accepted connections which are not destroyed yet.
+     */
+    std::atomic<v_int64> openConnections {0};
+
+  };
+
 public:
 
   /**
@@ -70,6 +91,14 @@ public:
      */
     ExtendedConnection(v_io_handle handle, data::stream::Context::Properties&& properties);
 
+    /**
+     * Constructor for the handle with known I/O mode.
+     * @param handle - &id:oatpp::v_io_handle;.
+     * @param mode - current I/O mode of the handle. &id:oatpp::data::stream::IOMode;.
+     * @param properties - &id:oatpp::data::stream::Context::Properties;.
+     */
+    ExtendedConnection(v_io_handle handle, data::stream::IOMode mode, data::stream::Context::Properties&& properties);
+
     /**
      * Get output stream context.
      * @return - &id:oatpp::data::stream::Context;.
@@ -84,19 +113,32 @@ public:
 
   };
 
+private:
+
+  struct AcceptedConnection;
+  struct AcceptBatch;
+
 private:
   std::shared_ptr<ConnectionInvalidator> m_invalidator;
   network::Address m_address;
   std::atomic<bool> m_closed;
   oatpp::v_io_handle m_serverHandle;
   bool m_useExtendedConnections;
+  bool m_reusePort;
+  std::shared_ptr<Statistics> m_statistics;
   std::shared_ptr<ConnectionConfigurer> m_connectionConfigurer;
+  std::unique_ptr<AcceptBatch> m_acceptBatch;
+  std::mutex m_acceptLock;
+  oatpp::v_io_handle m_acceptEventQueue;
+  oatpp::v_io_handle m_stopTrigger;
 private:
   oatpp::v_io_handle instantiateServer();
+  void initAcceptEvents();
 private:
   void prepareConnectionHandle(oatpp::v_io_handle handle);
-  provider::ResourceHandle<data::stream::IOStream> getDefaultConnection();
-  provider::ResourceHandle<data::stream::IOStream> getExtendedConnection();
+  v_int32 acceptBatch();
+  void waitForConnections();
+  provider::ResourceHandle<data::stream::IOStream> createConnection(const AcceptedConnection& accepted);
 public:
 
   /**
@@ -104,8 +146,11 @@ public:
    * @param address - &id:oatpp::network::Address;.
    * @param useExtendedConnections - set `true` to use &l:ConnectionProvider::ExtendedConnection;.
    * `false` to use &id:oatpp::network::tcp::Connection;.
+   * @param reusePort - set `true` to set `SO_REUSEPORT` on the accepting socket. <br>
+   * This allows several providers to listen on the same address, and the kernel spreads new connections between them.
+   * See &id:oatpp::network::tcp::server::ShardedServer;.
    */
-  ConnectionProvider(const network::Address& address, bool useExtendedConnections = false);
+  ConnectionProvider(const network::Address& address, bool useExtendedConnections = false, bool reusePort = false);
 
 public:
 
@@ -114,10 +159,14 @@ public:
    * @param address - &id:oatpp::network::Address;.
    * @param useExtendedConnections - set `true` to use &l:ConnectionProvider::ExtendedConnection;.
    * `false` to use &id:oatpp::network::tcp::Connection;.
+   * @param reusePort - set `true` to set `SO_REUSEPORT` on the accepting socket.
    * @return - `std::shared_ptr` to ConnectionProvider.
    */
-  static std::shared_ptr<ConnectionProvider> createShared(const network::Address& address, bool useExtendedConnections = false){
-    return std::make_shared<ConnectionProvider>(address, useExtendedConnections);
+  static std::shared_ptr<ConnectionProvider> createShared(const network::Address& address,
+                                                          bool useExtendedConnections = false,
+                                                          bool reusePort = false)
+  {
+    return std::make_shared<ConnectionProvider>(address, useExtendedConnections, reusePort);
   }
 
   /**
@@ -137,7 +186,10 @@ public:
   void stop() override;
 
   /**
-   * Get incoming connection.
+   * Get incoming connection. <br>
+   * Waits up to 1 second for a pending connection and returns `nullptr` if there is none.
+   * All pending connections are accepted in one batch per wakeup and handed out by subsequent calls. <br>
+   * On Linux waits with `epoll` and accepts with `accept4` - &l:ConnectionProvider::stop (); wakes it up immediately.
    * @return &id:oatpp::data::stream::IOStream;.
    */
   provider::ResourceHandle<data::stream::IOStream> get() override;
@@ -169,6 +221,14 @@ public:
   const network::Address& getAddress() const {
     return m_address;
   }
+
+  /**
+   * Get connection counters of this provider.
+   * @return - &l:ConnectionProvider::Statistics;.
+   */
+  const Statistics& getStatistics() const {
+    return *m_statistics;
+  }
   
 };
   
@@ -0,0 +1,170 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "./ShardedServer.hpp"
+
+#include "oatpp/utils/Conversion.hpp"
+
+#include <unordered_set>
+
+namespace oatpp { namespace network { namespace tcp { namespace server {
+
+ShardedServer::ShardedServer(const network::Address& address,
+                             v_int32 shardsCount,
+                             const ConnectionHandlerFactory& connectionHandlerFactory,
+                             bool useExtendedConnections)
+  : m_started(false)
+  , m_stopped(false)
+{
+
+  if(shardsCount < 1) {
+    throw std::runtime_error("[oatpp::network::tcp::server::ShardedServer::ShardedServer()]: Error. Invalid shards count.");
+  }
+
+#if !defined(SO_REUSEPORT)
+  if(shardsCount > 1) {
+    throw std::runtime_error("[oatpp::network::tcp::server::ShardedServer::ShardedServer()]: Error. SO_REUSEPORT is not supported on this platform.");
+  }
+#endif
+
+  network::Address shardAddress = address;
+
+  m_shards.resize(static_cast<size_t>(shardsCount));
+
+  for(v_int32 i = 0; i < shardsCount; i ++) {
+
+    auto& shard = m_shards[static_cast<size_t>(i)];
+
+    shard.connectionProvider = ConnectionProvider::createShared(shardAddress, useExtendedConnections, true);
+
+    if(shardAddress.port == 0) {
+      /* All other shards should listen on the port which was picked for the first one */
+      bool success;
+      auto port = oatpp::utils::Conversion::strToInt32(shard.connectionProvider->getProperty(ConnectionProvider::PROPERTY_PORT).toString(), success);
+      if(!success) {
+        throw std::runtime_error("[oatpp::network::tcp::server::ShardedServer::ShardedServer()]: Error. Can't get bound port.");
+      }
+      shardAddress.port = static_cast<v_uint16>(port);
+    }
+
+    shard.connectionHandler = connectionHandlerFactory(i);
+    if(!shard.connectionHandler) {
+      throw std::runtime_error("[oatpp::network::tcp::server::ShardedServer::ShardedServer()]: Error. Connection handler factory returned 'null'.");
+    }
+
+    shard.server = network::Server::createShared(shard.connectionProvider, shard.connectionHandler);
+
+  }
+
+}
+
+std::shared_ptr<ShardedServer> ShardedServer::createShared(const network::Address& address,
+                                                           v_int32 shardsCount,
+                                                           const ConnectionHandlerFactory& connectionHandlerFactory,
+                                                           bool useExtendedConnections)
+{
+  return std::make_shared<ShardedServer>(address, shardsCount, connectionHandlerFactory, useExtendedConnections);
+}
+
+ShardedServer::~ShardedServer() {
+  stop();
+}
+
+void ShardedServer::start() {
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if(m_started || m_stopped) {
+    throw std::runtime_error("[oatpp::network::tcp::server::ShardedServer::start()]: Error. Server already started.");
+  }
+
+  m_started = true;
+
+  for(auto& shard : m_shards) {
+    auto server = shard.server;
+    shard.thread = std::thread([server]{
+      server->run();
+    });
+  }
+
+}
+
+void ShardedServer::stop() {
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if(m_stopped) {
+    return;
+  }
+
+  m_stopped = true;
+
+  for(auto& shard : m_shards) {
+    if(shard.server) {
+      shard.server->stop();
+    }
+    if(shard.connectionProvider) {
+      shard.connectionProvider->stop(); // unblock accept
+    }
+  }
+
+  for(auto& shard : m_shards) {
+    if(shard.thread.joinable()) {
+      shard.thread.join();
+    }
+  }
+
+  /* Handler may be shared between shards - stop each one once */
+  std::unordered_set<ConnectionHandler*> stopped;
+  for(auto& shard : m_shards) {
+    if(shard.connectionHandler && stopped.insert(shard.connectionHandler.get()).second) {
+      shard.connectionHandler->stop();
+    }
+  }
+
+}
+
+v_int32 ShardedServer::getShardsCount() const {
+  return static_cast<v_int32>(m_shards.size());
+}
+
+v_uint16 ShardedServer::getPort() const {
+  bool success;
+  auto port = oatpp::utils::Conversion::strToInt32(m_shards[0].connectionProvider->getProperty(ConnectionProvider::PROPERTY_PORT).toString(), success);
+  return static_cast<v_uint16>(port);
+}
+
+std::shared_ptr<ConnectionHandler> ShardedServer::getConnectionHandler(v_int32 shardIndex) const {
+  return m_shards.at(static_cast<size_t>(shardIndex)).connectionHandler;
+}
+
+ShardedServer::ShardStats ShardedServer::getShardStats(v_int32 shardIndex) const {
+  const auto& statistics = m_shards.at(static_cast<size_t>(shardIndex)).connectionProvider->getStatistics();
+  ShardStats stats;
+  stats.acceptedConnections = statistics.acceptedConnections.load();
+  stats.openConnections = statistics.openConnections.load();
+  return stats;
+}
+
+}}}}
@@ -0,0 +1,156 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_network_tcp_server_ShardedServer_hpp
+#define oatpp_network_tcp_server_ShardedServer_hpp
+
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/network/Server.hpp"
+
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace network { namespace tcp { namespace server {
+
+/**
+ * TCP server with several accepting sockets bound to the same address with `SO_REUSEPORT`. <br>
+ * Each shard has its own &id:oatpp::network::tcp::server::ConnectionProvider;, accept loop (&id:oatpp::network::Server;)
+ * running in its own thread, and &id:oatpp::network::ConnectionHandler;. The kernel spreads new connections between shards. <br>
+ * Handlers are created by &l:ShardedServer::ConnectionHandlerFactory; - return the same handler for all shards to share it,
+ * or a new handler (ex.: with its own &id:oatpp::async::Executor;) per shard.
+ */
+class ShardedServer : public base::Countable {
+public:
+
+  /**
+   * Create connection handler for the shard.
+   */
+  typedef std::function<std::shared_ptr<ConnectionHandler>(v_int32 shardIndex)> ConnectionHandlerFactory;
+
+  /**
+   * Shard statistics.
+   */
+  struct ShardStats {
+
+    /**
+     * Total number of connections accepted by the shard.
+     */
+    v_uint64 acceptedConnections;
+
+    /**
+     * Number of shard connections which are still open.
+     */
+    v_int64 openConnections;
+
+  };
+
+private:
+
+  struct Shard {
+    std::shared_ptr<ConnectionProvider> connectionProvider;
+    std::shared_ptr<ConnectionHandler> connectionHandler;
+    std::shared_ptr<network::Server> server;
+    std::thread thread;
+  };
+
+private:
+  std::vector<Shard> m_shards;
+  std::mutex m_mutex;
+  bool m_started;
+  bool m_stopped;
+public:
+
+  /**
+   * Constructor. Binds all accepting sockets.
+   * @param address - &id:oatpp::network::Address;. If port is `0` all shards listen on the port picked for the first one.
+   * @param shardsCount - number of shards (accepting sockets).
+   * @param connectionHandlerFactory - &l:ShardedServer::ConnectionHandlerFactory;.
+   * @param useExtendedConnections - see &id:oatpp::network::tcp::server::ConnectionProvider;.
+   */
+  ShardedServer(const network::Address& address,
+                v_int32 shardsCount,
+                const ConnectionHandlerFactory& connectionHandlerFactory,
+                bool useExtendedConnections = false);
+
+  /**
+   * Create shared ShardedServer.
+   * @param address - &id:oatpp::network::Address;.
+   * @param shardsCount - number of shards (accepting sockets).
+   * @param connectionHandlerFactory - &l:ShardedServer::ConnectionHandlerFactory;.
+   * @param useExtendedConnections - see &id:oatpp::network::tcp::server::ConnectionProvider;.
+   * @return - `std::shared_ptr` to ShardedServer.
+   */
+  static std::shared_ptr<ShardedServer> createShared(const network::Address& address,
+                                                     v_int32 shardsCount,
+                                                     const ConnectionHandlerFactory& connectionHandlerFactory,
+                                                     bool useExtendedConnections = false);
+
+  /**
+   * Virtual destructor. Stops the server.
+   */
+  ~ShardedServer() override;
+
+  /**
+   * Start accept loops of all shards. Each loop runs in its own thread. Non-blocking.
+   */
+  void start();
+
+  /**
+   * Stop accept loops, close accepting sockets, and stop connection handlers.
+   */
+  void stop();
+
+  /**
+   * Get number of shards.
+   * @return - number of shards.
+   */
+  v_int32 getShardsCount() const;
+
+  /**
+   * Get port all shards listen on.
+   * @return - port.
+   */
+  v_uint16 getPort() const;
+
+  /**
+   * Get connection handler of the shard.
+   * @param shardIndex - index of the shard.
+   * @return - &id:oatpp::network::ConnectionHandler;.
+   */
+  std::shared_ptr<ConnectionHandler> getConnectionHandler(v_int32 shardIndex) const;
+
+  /**
+   * Get shard statistics.
+   * @param shardIndex - index of the shard.
+   * @return - &l:ShardedServer::ShardStats;.
+   */
+  ShardStats getShardStats(v_int32 shardIndex) const;
+
+};
+
+}}}}
+
+#endif /* oatpp_network_tcp_server_ShardedServer_hpp */
@@ -112,11 +112,45 @@ void Pipe::Writer::setMaxAvailableToWrite(v_io_size maxAvailableToWrite) {
 }
   
 v_io_size Pipe::Writer::write(const void *data, v_buff_size count, async::Action& action) {
-  
-  if(m_maxAvailableToWrtie > -1 && count > m_maxAvailableToWrtie) {
-    count = m_maxAvailableToWrtie;
+  data::stream::WriteSegment segment = {data, count};
+  return writev(&segment, 1, action);
+}
+
+v_io_size Pipe::Writer::writeSegmentsToFifo(const data::stream::WriteSegment* segments, v_int32 count) {
+
+  v_buff_size maxCount = m_maxAvailableToWrtie;
+  v_io_size result = 0;
+
+  for(v_int32 i = 0; i < count; i ++) {
+
+    auto size = segments[i].size;
+    if(maxCount > -1 && result + size > maxCount) {
+      size = maxCount - result;
+    }
+
+    if(size <= 0) {
+      continue;
+    }
+
+    auto res = m_pipe->m_fifo.write(segments[i].data, size);
+    if(res <= 0) {
+      break;
+    }
+
+    result += res;
+
+    if(res < segments[i].size) {
+      break;
+    }
+
   }
 
+  return result;
+
+}
+
+v_io_size Pipe::Writer::writev(const data::stream::WriteSegment* segments, v_int32 count, async::Action& action) {
+
   Pipe& pipe = *m_pipe;
   oatpp::v_io_size result;
   
@@ -126,7 +160,7 @@ v_io_size Pipe::Writer::write(const void *data, v_buff_size count, async::Action
 
     if(pipe.m_open) {
       if (pipe.m_fifo.availableToWrite() > 0) {
-        result = pipe.m_fifo.write(data, count);
+        result = writeSegmentsToFifo(segments, count);
       } else {
         action = async::Action::createWaitListAction(&m_waitList);
         result = IOError::RETRY_WRITE;
@@ -141,7 +175,7 @@ v_io_size Pipe::Writer::write(const void *data, v_buff_size count, async::Action
       pipe.m_conditionWrite.wait(lock);
     }
     if (pipe.m_open && pipe.m_fifo.availableToWrite() > 0) {
-      result = pipe.m_fifo.write(data, count);
+      result = writeSegmentsToFifo(segments, count);
     } else {
       result = IOError::BROKEN_PIPE;
     }
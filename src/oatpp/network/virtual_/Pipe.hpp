@@ -177,6 +177,8 @@ public:
 
     oatpp::async::CoroutineWaitList m_waitList;
     WaitListListener m_waitListListener;
+  private:
+    v_io_size writeSegmentsToFifo(const data::stream::WriteSegment* segments, v_int32 count);
   protected:
     
     Writer(Pipe* pipe, oatpp::data::stream::IOMode ioMode = oatpp::data::stream::IOMode::BLOCKING)
@@ -209,6 +211,17 @@ public:
      */
     v_io_size write(const void *data, v_buff_size count, async::Action& action) override;
 
+    /**
+     * Implements &id:oatpp::data::stream::OutputStream::writev; method.
+     * Write all segments to pipe under one lock.
+     * @param segments - array of &id:oatpp::data::stream::WriteSegment;.
+     * @param count - number of segments in the array.
+     * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+     * caller MUST return this action on coroutine iteration.
+     * @return - &id:oatpp::v_io_size;.
+     */
+    v_io_size writev(const data::stream::WriteSegment* segments, v_int32 count, async::Action& action) override;
+
     /**
      * Set OutputStream I/O mode.
      * @param ioMode
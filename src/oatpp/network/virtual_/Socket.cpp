@@ -52,6 +52,10 @@ v_io_size Socket::write(const void *data, v_buff_size count, async::Action& acti
   return m_pipeOut->getWriter()->write(data, count, action);
 }
 
+v_io_size Socket::writev(const data::stream::WriteSegment* segments, v_int32 count, async::Action& action) {
+  return m_pipeOut->getWriter()->writev(segments, count, action);
+}
+
 void Socket::setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) {
   m_pipeOut->getWriter()->setOutputStreamIOMode(ioMode);
 }
@@ -88,6 +88,16 @@ public:
    */
   v_io_size write(const void *data, v_buff_size count, async::Action& action) override;
 
+  /**
+   * Write data of all segments to socket.
+   * @param segments - array of &id:oatpp::data::stream::WriteSegment;.
+   * @param count - number of segments in the array.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual amount of data written to socket.
+   */
+  v_io_size writev(const data::stream::WriteSegment* segments, v_int32 count, async::Action& action) override;
+
   /**
    * Set OutputStream I/O mode.
    * @param ioMode
@@ -61,6 +61,10 @@ v_io_size HttpRequestExecutor::ConnectionProxy::write(const void *data, v_buff_s
   return m_connectionHandle.object->write(data,count, action);
 }
 
+v_io_size HttpRequestExecutor::ConnectionProxy::writev(const data::stream::WriteSegment* segments, v_int32 count, async::Action& action) {
+  return m_connectionHandle.object->writev(segments, count, action);
+}
+
 void HttpRequestExecutor::ConnectionProxy::setInputStreamIOMode(data::stream::IOMode ioMode) {
   m_connectionHandle.object->setInputStreamIOMode(ioMode);
 }
@@ -230,7 +234,7 @@ HttpRequestExecutor::executeOnce(const String& method,
                                 "[oatpp::web::client::HttpRequestExecutor::executeOnce()]: Failed to read response.");
   }
                                                                                 
-  auto connectionHeader = result.headers.getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(Header::CONNECTION);
+  auto connectionHeader = result.headers.getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(protocol::http::HeaderId::CONNECTION);
   if (connectionHeader == "close") {
     connection->setInvalidateOnDestroy(true);
   }
@@ -326,7 +330,7 @@ HttpRequestExecutor::executeOnceAsync(const String& method,
     
     Action onHeadersParsed(const ResponseHeadersReader::Result& result) {
 
-      auto connectionHeader = result.headers.getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(Header::CONNECTION);
+      auto connectionHeader = result.headers.getAsMemoryLabel<oatpp::data::share::StringKeyLabelCI>(protocol::http::HeaderId::CONNECTION);
       if (connectionHeader == "close") {
         m_connection->setInvalidateOnDestroy(true);
       }
@@ -26,7 +26,7 @@
 #define oatpp_web_mime_multipart_StatefulParser_hpp
 
 #include "oatpp/data/stream/BufferStream.hpp"
-#include "oatpp/data/share/LazyStringMap.hpp"
+#include "oatpp/web/protocol/http/Http.hpp"
 #include "oatpp/Types.hpp"
 
 #include <unordered_map>
@@ -51,7 +51,7 @@ private:
    * Typedef for headers map. Headers map key is case-insensitive.
    * For more info see &id:oatpp::data::share::LazyStringMap;.
    */
-  typedef oatpp::data::share::LazyStringMultimap<oatpp::data::share::StringKeyLabelCI> Headers;
+  typedef oatpp::web::protocol::http::Headers Headers;
 public:
 
   /**
@@ -63,7 +63,7 @@ public:
      * Typedef for headers map. Headers map key is case-insensitive.
      * For more info see &id:oatpp::data::share::LazyStringMap;.
      */
-    typedef oatpp::data::share::LazyStringMultimap<oatpp::data::share::StringKeyLabelCI> Headers;
+    typedef oatpp::web::protocol::http::Headers Headers;
   public:
 
     /**
@@ -100,7 +100,7 @@ public:
      * Typedef for headers map. Headers map key is case-insensitive.
      * For more info see &id:oatpp::data::share::LazyStringMap;.
      */
-    typedef oatpp::data::share::LazyStringMultimap<oatpp::data::share::StringKeyLabelCI> Headers;
+    typedef oatpp::web::protocol::http::Headers Headers;
   public:
 
     /**
@@ -0,0 +1,183 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HeadersMap.hpp"
+
+#include "oatpp/utils/String.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace web { namespace protocol { namespace http {
+
+namespace {
+
+bool nameEquals(const void* data, v_buff_size size, const char* name) {
+  return utils::String::compareCI_ASCII(data, size, name, size) == 0;
+}
+
+}
+
+HeaderId HeadersMap::getHeaderId(const void* data, v_buff_size size) {
+
+  switch(size) {
+    case 4:
+      if(nameEquals(data, size, "Host")) return HeaderId::HOST;
+      break;
+    case 6:
+      if(nameEquals(data, size, "Accept")) return HeaderId::ACCEPT;
+      if(nameEquals(data, size, "Expect")) return HeaderId::EXPECT;
+      break;
+    case 10:
+      if(nameEquals(data, size, "Connection")) return HeaderId::CONNECTION;
+      break;
+    case 12:
+      if(nameEquals(data, size, "Content-Type")) return HeaderId::CONTENT_TYPE;
+      break;
+    case 13:
+      if(nameEquals(data, size, "Authorization")) return HeaderId::AUTHORIZATION;
+      break;
+    case 14:
+      if(nameEquals(data, size, "Content-Length")) return HeaderId::CONTENT_LENGTH;
+      break;
+    case 15:
+      if(nameEquals(data, size, "Accept-Encoding")) return HeaderId::ACCEPT_ENCODING;
+      break;
+    case 16:
+      if(nameEquals(data, size, "Content-Encoding")) return HeaderId::CONTENT_ENCODING;
+      break;
+    case 17:
+      if(nameEquals(data, size, "Transfer-Encoding")) return HeaderId::TRANSFER_ENCODING;
+      break;
+    default:
+      break;
+  }
+
+  return HeaderId::UNKNOWN;
+
+}
+
+HeadersMap::HeadersMap() {
+  resetIndex();
+}
+
+HeadersMap::HeadersMap(HeadersMap&& other) noexcept
+  : m_entries(std::move(other.m_entries))
+{
+  std::memcpy(m_index, other.m_index, sizeof(m_index));
+  other.m_entries.clear();
+  other.resetIndex();
+}
+
+HeadersMap& HeadersMap::operator = (HeadersMap&& other) noexcept {
+  if(this != &other) {
+    m_entries = std::move(other.m_entries);
+    std::memcpy(m_index, other.m_index, sizeof(m_index));
+    other.m_entries.clear();
+    other.resetIndex();
+  }
+  return *this;
+}
+
+void HeadersMap::resetIndex() {
+  for(v_int32 i = 0; i < HEADERS_COUNT; i ++) {
+    m_index[i] = -1;
+  }
+}
+
+void HeadersMap::reindex() {
+  resetIndex();
+  for(size_t i = 0; i < m_entries.size(); i ++) {
+    auto id = getHeaderId(m_entries[i].first);
+    if(id != HeaderId::UNKNOWN && m_index[static_cast<v_int32>(id)] < 0) {
+      m_index[static_cast<v_int32>(id)] = static_cast<v_int32>(i);
+    }
+  }
+}
+
+HeadersMap::iterator HeadersMap::insert(const value_type& entry) {
+  if(m_entries.capacity() == 0) {
+    m_entries.reserve(INITIAL_CAPACITY);
+  }
+  auto id = getHeaderId(entry.first);
+  if(id != HeaderId::UNKNOWN && m_index[static_cast<v_int32>(id)] < 0) {
+    m_index[static_cast<v_int32>(id)] = static_cast<v_int32>(m_entries.size());
+  }
+  m_entries.push_back(entry);
+  return m_entries.end() - 1;
+}
+
+HeadersMap::iterator HeadersMap::find(const key_type& name) {
+  auto id = getHeaderId(name);
+  if(id != HeaderId::UNKNOWN) {
+    return find(id);
+  }
+  for(auto it = m_entries.begin(); it != m_entries.end(); it ++) {
+    if(it->first == name) {
+      return it;
+    }
+  }
+  return m_entries.end();
+}
+
+HeadersMap::const_iterator HeadersMap::find(const key_type& name) const {
+  return const_cast<HeadersMap*>(this)->find(name);
+}
+
+HeadersMap::iterator HeadersMap::find(HeaderId id) {
+  if(id == HeaderId::UNKNOWN || id == HeaderId::COUNT) {
+    return m_entries.end();
+  }
+  auto index = m_index[static_cast<v_int32>(id)];
+  if(index < 0) {
+    return m_entries.end();
+  }
+  return m_entries.begin() + index;
+}
+
+HeadersMap::const_iterator HeadersMap::find(HeaderId id) const {
+  return const_cast<HeadersMap*>(this)->find(id);
+}
+
+v_buff_size HeadersMap::erase(const key_type& name) {
+  auto size = m_entries.size();
+  for(auto it = m_entries.begin(); it != m_entries.end();) {
+    if(it->first == name) {
+      it = m_entries.erase(it);
+    } else {
+      it ++;
+    }
+  }
+  auto erased = static_cast<v_buff_size>(size - m_entries.size());
+  if(erased > 0) {
+    reindex();
+  }
+  return erased;
+}
+
+void HeadersMap::clear() {
+  m_entries.clear();
+  resetIndex();
+}
+
+}}}}
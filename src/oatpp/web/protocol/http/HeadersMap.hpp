@@ -0,0 +1,213 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_protocol_http_HeadersMap_hpp
+#define oatpp_web_protocol_http_HeadersMap_hpp
+
+#include "oatpp/data/share/MemoryLabel.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace web { namespace protocol { namespace http {
+
+/**
+ * Ids of the well-known http headers. <br>
+ * Header names are tokenized into these ids once - when put to &l:HeadersMap;.
+ * Lookups by id are then done without hashing or comparing header names.
+ */
+enum class HeaderId : v_int32 {
+
+  /**
+   * Header is not one of the well-known headers.
+   */
+  UNKNOWN = -1,
+
+  HOST = 0,
+  CONNECTION,
+  CONTENT_LENGTH,
+  CONTENT_TYPE,
+  CONTENT_ENCODING,
+  TRANSFER_ENCODING,
+  ACCEPT,
+  ACCEPT_ENCODING,
+  AUTHORIZATION,
+  EXPECT,
+
+  /**
+   * Number of well-known headers.
+   */
+  COUNT
+
+};
+
+/**
+ * Flat multimap of http headers. <br>
+ * Entries are stored in a vector in the order they were inserted - no per-entry allocation.
+ * Names of the well-known headers are tokenized to &l:HeaderId; on insert,
+ * and the index of the first entry for each id is kept, so lookup by id is O(1). <br>
+ * Other names are looked up by a case-insensitive linear scan which is fast for the typical (< 32) number of headers. <br>
+ * Implements the subset of `std::unordered_multimap` interface used by &id:oatpp::data::share::LazyStringMapTemplate;.
+ */
+class HeadersMap {
+public:
+  typedef oatpp::data::share::StringKeyLabelCI key_type;
+  typedef oatpp::data::share::StringKeyLabel mapped_type;
+  typedef std::pair<key_type, mapped_type> value_type;
+  typedef std::vector<value_type>::iterator iterator;
+  typedef std::vector<value_type>::const_iterator const_iterator;
+private:
+  static constexpr v_int32 INITIAL_CAPACITY = 16;
+  static constexpr v_int32 HEADERS_COUNT = static_cast<v_int32>(HeaderId::COUNT);
+private:
+  void resetIndex();
+  void reindex();
+private:
+  std::vector<value_type> m_entries;
+  v_int32 m_index[HEADERS_COUNT];
+public:
+
+  /**
+   * Get id of the header by its name. Name is compared case-insensitive.
+   * @param data - header name.
+   * @param size - size of the header name.
+   * @return - &l:HeaderId;. `HeaderId::UNKNOWN` if header is not one of the well-known headers.
+   */
+  static HeaderId getHeaderId(const void* data, v_buff_size size);
+
+  /**
+   * Get id of the header by its name. Name is compared case-insensitive.
+   * @param name - header name.
+   * @return - &l:HeaderId;. `HeaderId::UNKNOWN` if header is not one of the well-known headers.
+   */
+  static HeaderId getHeaderId(const key_type& name) {
+    return getHeaderId(name.getData(), name.getSize());
+  }
+
+public:
+
+  /**
+   * Constructor.
+   */
+  HeadersMap();
+
+  /**
+   * Copy-constructor.
+   * @param other
+   */
+  HeadersMap(const HeadersMap& other) = default;
+
+  /**
+   * Move-constructor. Leaves `other` empty.
+   * @param other
+   */
+  HeadersMap(HeadersMap&& other) noexcept;
+
+  HeadersMap& operator = (const HeadersMap& other) = default;
+
+  HeadersMap& operator = (HeadersMap&& other) noexcept;
+
+  /**
+   * Insert entry. Multiple entries with the same name are allowed.
+   * @param entry - name-value pair.
+   * @return - iterator to inserted entry.
+   */
+  iterator insert(const value_type& entry);
+
+  /**
+   * Find first entry with the name.
+   * @param name - header name.
+   * @return - iterator to the entry or `end()`.
+   */
+  iterator find(const key_type& name);
+
+  /**
+   * Find first entry with the name.
+   * @param name - header name.
+   * @return - iterator to the entry or `end()`.
+   */
+  const_iterator find(const key_type& name) const;
+
+  /**
+   * Find first entry of the well-known header.
+   * @param id - &l:HeaderId;.
+   * @return - iterator to the entry or `end()`.
+   */
+  iterator find(HeaderId id);
+
+  /**
+   * Find first entry of the well-known header.
+   * @param id - &l:HeaderId;.
+   * @return - iterator to the entry or `end()`.
+   */
+  const_iterator find(HeaderId id) const;
+
+  /**
+   * Erase all entries with the name.
+   * @param name - header name.
+   * @return - number of erased entries.
+   */
+  v_buff_size erase(const key_type& name);
+
+  /**
+   * Remove all entries.
+   */
+  void clear();
+
+  iterator begin() {
+    return m_entries.begin();
+  }
+
+  iterator end() {
+    return m_entries.end();
+  }
+
+  const_iterator begin() const {
+    return m_entries.begin();
+  }
+
+  const_iterator end() const {
+    return m_entries.end();
+  }
+
+  /**
+   * Get number of entries.
+   * @return
+   */
+  size_t size() const {
+    return m_entries.size();
+  }
+
+  /**
+   * Check if there are no entries.
+   * @return
+   */
+  bool empty() const {
+    return m_entries.empty();
+  }
+
+};
+
+}}}}
+
+#endif // oatpp_web_protocol_http_HeadersMap_hpp
@@ -27,6 +27,9 @@
 #include "oatpp/data/stream/BufferStream.hpp"
 #include "oatpp/utils/Conversion.hpp"
 
+#include <cstring>
+#include <string>
+
 namespace oatpp { namespace web { namespace protocol { namespace http {
   
 const Status Status::CODE_100(100, "Continue");
@@ -134,6 +137,7 @@ const char* const Header::CORS_MAX_AGE = "Access-Control-Max-Age";
 const char* const Header::ACCEPT_ENCODING = "Accept-Encoding";
 
 const char* const Header::EXPECT = "Expect";
+const char* const Header::DATE = "Date";
 
 const char* const Range::UNIT_BYTES = "bytes";
 const char* const ContentRange::UNIT_BYTES = "bytes";
@@ -428,6 +432,136 @@ void Parser::parseHeaderValueData(HeaderValueData& data, const oatpp::data::shar
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Utils
 
+namespace {
+
+  /*
+   * Pre-rendered status lines of all Status::CODE_* constants. Indexed by status code.
+   */
+  class StatusLines {
+  public:
+    static constexpr v_int32 MIN_CODE = 100;
+    static constexpr v_int32 MAX_CODE = 599;
+  private:
+    struct Line {
+      const char* description = nullptr;
+      std::string text;
+    };
+  private:
+    Line m_lines[MAX_CODE - MIN_CODE + 1];
+  public:
+
+    StatusLines() {
+      const Status* statuses[] = {
+      &Status::CODE_100,
+      &Status::CODE_101,
+      &Status::CODE_102,
+      &Status::CODE_200,
+      &Status::CODE_201,
+      &Status::CODE_202,
+      &Status::CODE_203,
+      &Status::CODE_204,
+      &Status::CODE_205,
+      &Status::CODE_206,
+      &Status::CODE_207,
+      &Status::CODE_226,
+      &Status::CODE_300,
+      &Status::CODE_301,
+      &Status::CODE_302,
+      &Status::CODE_303,
+      &Status::CODE_304,
+      &Status::CODE_305,
+      &Status::CODE_306,
+      &Status::CODE_307,
+      &Status::CODE_400,
+      &Status::CODE_401,
+      &Status::CODE_402,
+      &Status::CODE_403,
+      &Status::CODE_404,
+      &Status::CODE_405,
+      &Status::CODE_406,
+      &Status::CODE_407,
+      &Status::CODE_408,
+      &Status::CODE_409,
+      &Status::CODE_410,
+      &Status::CODE_411,
+      &Status::CODE_412,
+      &Status::CODE_413,
+      &Status::CODE_414,
+      &Status::CODE_415,
+      &Status::CODE_416,
+      &Status::CODE_417,
+      &Status::CODE_418,
+      &Status::CODE_422,
+      &Status::CODE_423,
+      &Status::CODE_424,
+      &Status::CODE_425,
+      &Status::CODE_426,
+      &Status::CODE_428,
+      &Status::CODE_429,
+      &Status::CODE_431,
+      &Status::CODE_434,
+      &Status::CODE_444,
+      &Status::CODE_449,
+      &Status::CODE_451,
+      &Status::CODE_500,
+      &Status::CODE_501,
+      &Status::CODE_502,
+      &Status::CODE_503,
+      &Status::CODE_504,
+      &Status::CODE_505,
+      &Status::CODE_506,
+      &Status::CODE_507,
+      &Status::CODE_508,
+      &Status::CODE_509,
+      &Status::CODE_510,
+      &Status::CODE_511
+      };
+      for(auto status : statuses) {
+        auto& line = m_lines[status->code - MIN_CODE];
+        line.description = status->description;
+        line.text = "HTTP/1.1 " + std::to_string(status->code) + " " + status->description + "\r\n";
+      }
+    }
+
+    const std::string* get(const Status& status) const {
+      if(status.code < MIN_CODE || status.code > MAX_CODE || status.description == nullptr) {
+        return nullptr;
+      }
+      auto& line = m_lines[status.code - MIN_CODE];
+      if(line.description == nullptr) {
+        return nullptr;
+      }
+      if(line.description != status.description && std::strcmp(line.description, status.description) != 0) {
+        return nullptr;
+      }
+      return &line.text;
+    }
+
+    static const StatusLines& getInstance() {
+      static const StatusLines instance;
+      return instance;
+    }
+
+  };
+
+}
+
+void Utils::writeStatusLine(const Status& status, data::stream::ConsistentOutputStream* stream) {
+
+  auto line = StatusLines::getInstance().get(status);
+  if(line != nullptr) {
+    stream->writeSimple(line->data(), static_cast<v_buff_size>(line->size()));
+    return;
+  }
+
+  stream->writeSimple("HTTP/1.1 ", 9);
+  stream->writeAsString(status.code);
+  stream->writeSimple(" ", 1);
+  stream->writeSimple(status.description);
+  stream->writeSimple("\r\n", 2);
+
+}
+
 void Utils::writeHeaders(const Headers& headers, data::stream::ConsistentOutputStream* stream) {
 
   auto& map = headers.getAll_Unsafe();
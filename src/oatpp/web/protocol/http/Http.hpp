@@ -28,6 +28,7 @@
 #include "oatpp/network/tcp/Connection.hpp"
 
 #include "oatpp/web/protocol/CommunicationError.hpp"
+#include "oatpp/web/protocol/http/HeadersMap.hpp"
 
 #include "oatpp/utils/parser/Caret.hpp"
 #include "oatpp/data/share/LazyStringMap.hpp"
@@ -39,10 +40,85 @@
 namespace oatpp { namespace web { namespace protocol { namespace http {
 
 /**
- * Typedef for headers map. Headers map key is case-insensitive.
- * For more info see &id:oatpp::data::share::LazyStringMultimap;.
+ * Headers map. Headers map key is case-insensitive. <br>
+ * Based on &id:oatpp::web::protocol::http::HeadersMap; - entries keep insertion order,
+ * and the well-known headers can be looked up in O(1) by &id:oatpp::web::protocol::http::HeaderId;.
+ * For more info see &id:oatpp::data::share::LazyStringMapTemplate;.
  */
-typedef oatpp::data::share::LazyStringMultimap<oatpp::data::share::StringKeyLabelCI> Headers;
+class Headers : public oatpp::data::share::LazyStringMapTemplate<oatpp::data::share::StringKeyLabelCI, HeadersMap> {
+public:
+  using LazyStringMapTemplate::LazyStringMapTemplate;
+  using LazyStringMapTemplate::get;
+  using LazyStringMapTemplate::getAsMemoryLabel;
+  using LazyStringMapTemplate::getAsMemoryLabel_Unsafe;
+public:
+
+  /**
+   * Get value of the well-known header as &id:oatpp::String;.
+   * @param id - &id:oatpp::web::protocol::http::HeaderId;.
+   * @return
+   */
+  String get(HeaderId id) const {
+
+    std::lock_guard<concurrency::SpinLock> lock(m_lock);
+
+    auto it = m_map.find(id);
+
+    if(it != m_map.end()) {
+      it->second.captureToOwnMemory();
+      return it->second.getMemoryHandle();
+    }
+
+    return nullptr;
+
+  }
+
+  /**
+   * Get value of the well-known header as a memory label.
+   * @tparam T - one of: &id:oatpp::data::share::MemoryLabel;, &id:oatpp::data::share::StringKeyLabel;, &id:oatpp::data::share::StringKeyLabelCI;.
+   * @param id - &id:oatpp::web::protocol::http::HeaderId;.
+   * @return
+   */
+  template<class T>
+  T getAsMemoryLabel(HeaderId id) const {
+
+    std::lock_guard<concurrency::SpinLock> lock(m_lock);
+
+    auto it = m_map.find(id);
+
+    if(it != m_map.end()) {
+      it->second.retainMemory();
+      const auto& label = it->second;
+      return T(label.getMemoryHandle(), reinterpret_cast<const char*>(label.getData()), label.getSize());
+    }
+
+    return T(nullptr, nullptr, 0);
+
+  }
+
+  /**
+   * Get value of the well-known header as a memory label without allocating memory for value.
+   * @tparam T - one of: &id:oatpp::data::share::MemoryLabel;, &id:oatpp::data::share::StringKeyLabel;, &id:oatpp::data::share::StringKeyLabelCI;.
+   * @param id - &id:oatpp::web::protocol::http::HeaderId;.
+   * @return
+   */
+  template<class T>
+  T getAsMemoryLabel_Unsafe(HeaderId id) const {
+
+    std::lock_guard<concurrency::SpinLock> lock(m_lock);
+
+    auto it = m_map.find(id);
+
+    if(it != m_map.end()) {
+      const auto& label = it->second;
+      return T(label.getMemoryHandle(), reinterpret_cast<const char*>(label.getData()), label.getSize());
+    }
+
+    return T(nullptr, nullptr, 0);
+
+  }
+
+};
 
 /**
  * Typedef for query parameters map.
@@ -506,6 +582,7 @@ public:
   static const char* const CORS_MAX_AGE;        // Access-Control-Max-Age
   static const char* const ACCEPT_ENCODING;     // Accept-Encoding
   static const char* const EXPECT;              // Expect
+  static const char* const DATE;                // Date
 };
   
 class Range {
@@ -729,6 +806,14 @@ public:
    */
   static void writeHeaders(const Headers& headers, data::stream::ConsistentOutputStream* stream);
 
+  /**
+   * Write status line - `HTTP/1.1 <code> <description>\r\n`. <br>
+   * Status lines of all &l:Status; constants are pre-rendered - for them this is a single write.
+   * @param status - &l:Status;.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   */
+  static void writeStatusLine(const Status& status, data::stream::ConsistentOutputStream* stream);
+
 };
   
 }}}}
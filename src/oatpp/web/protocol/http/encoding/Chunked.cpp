@@ -24,90 +24,149 @@
 
 #include "Chunked.hpp"
 
-#include "oatpp/utils/Conversion.hpp"
+#include <cstring>
+#include <cstdlib>
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace encoding {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // EncoderChunked
 
-v_io_size EncoderChunked::suggestInputStreamReadSize() {
-  return 32767;
+EncoderChunked::EncoderChunked(v_buff_size minChunkSize)
+  : m_minChunkSize(minChunkSize)
+{
+  if(m_minChunkSize > 0) {
+    m_aggregate.reset(new v_char8[static_cast<size_t>(m_minChunkSize)]);
+  }
 }
 
-v_int32 EncoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buffer::InlineReadData& dataOut) {
+v_buff_size EncoderChunked::writeChunkHeader(p_char8 buffer, v_buff_size chunkSize, bool firstChunk) {
 
-  if(dataOut.bytesLeft > 0) {
-    return Error::FLUSH_DATA_OUT;
+  static const char* HEX = "0123456789ABCDEF";
+
+  v_buff_size position = 0;
+
+  if(!firstChunk) {
+    buffer[position ++] = '\r';
+    buffer[position ++] = '\n';
   }
 
-  if(dataIn.currBufferPtr != nullptr) {
+  auto value = static_cast<v_uint64>(chunkSize);
 
-    if(m_lastFlush > 0) {
-      dataIn.inc(m_lastFlush);
-      m_lastFlush = 0;
-    }
+  v_int32 digits = 1;
+  while(digits < 16 && (value >> (digits * 4)) != 0) {
+    digits ++;
+  }
 
-    if(m_finished){
-      dataOut.set(nullptr, 0);
-      return Error::FINISHED;
-    }
+  for(v_int32 i = digits - 1; i >= 0; i --) {
+    buffer[position ++] = static_cast<v_char8>(HEX[(value >> (i * 4)) & 0x0F]);
+  }
 
-    if(dataIn.bytesLeft == 0) {
-      return Error::PROVIDE_DATA_IN;
-    }
+  buffer[position ++] = '\r';
+  buffer[position ++] = '\n';
 
-    if(m_writeChunkHeader) {
+  return position;
 
-      async::Action action;
-      data::stream::BufferOutputStream stream(16);
-      if(!m_firstChunk) {
-        stream.write("\r\n", 2, action);
-      }
+}
 
-      stream << utils::Conversion::primitiveToStr(dataIn.bytesLeft, "%X");
-      stream.write("\r\n", 2, action);
+v_int32 EncoderChunked::flushChunk(const void* data, v_buff_size size, bool fromInput, data::buffer::InlineReadData& dataOut) {
 
-      m_chunkHeader = stream.toString();
-      dataOut.set(reinterpret_cast<p_char8>(m_chunkHeader->data()), static_cast<v_buff_size>(m_chunkHeader->size()));
+  auto headerSize = writeChunkHeader(m_chunkHeader, size, m_firstChunk);
+  m_firstChunk = false;
 
-      m_firstChunk = false;
-      m_writeChunkHeader = false;
+  m_chunkData = data;
+  m_chunkDataSize = size;
+  m_chunkFromInput = fromInput;
 
-      return Error::FLUSH_DATA_OUT;
+  dataOut.set(m_chunkHeader, headerSize);
+  return Error::FLUSH_DATA_OUT;
 
+}
+
+v_io_size EncoderChunked::suggestInputStreamReadSize() {
+  if(m_minChunkSize - m_aggregatedSize > DEFAULT_READ_SIZE) {
+    return m_minChunkSize - m_aggregatedSize;
+  }
+  return DEFAULT_READ_SIZE;
+}
+
+v_int32 EncoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buffer::InlineReadData& dataOut) {
+
+  if(dataOut.bytesLeft > 0) {
+    return Error::FLUSH_DATA_OUT;
+  }
+
+  if(m_lastFlush > 0) {
+    dataIn.inc(m_lastFlush);
+    m_lastFlush = 0;
+  }
+
+  /* chunk header is flushed - flush chunk data */
+  if(m_chunkData != nullptr) {
+
+    dataOut.set(const_cast<void*>(m_chunkData), m_chunkDataSize);
+
+    if(m_chunkFromInput) {
+      m_lastFlush = m_chunkDataSize;
+    } else {
+      /* aggregate is not reused until dataOut is consumed */
+      m_aggregatedSize = 0;
     }
 
-    dataOut = dataIn;
-    m_lastFlush = dataOut.bytesLeft;
-    m_writeChunkHeader = true;
+    m_chunkData = nullptr;
     return Error::FLUSH_DATA_OUT;
 
   }
 
-  if(m_writeChunkHeader){
+  if(m_finished){
+    dataOut.set(nullptr, 0);
+    return Error::FINISHED;
+  }
+
+  if(dataIn.currBufferPtr != nullptr) {
+
+    if(dataIn.bytesLeft == 0) {
+      return Error::PROVIDE_DATA_IN;
+    }
 
-    async::Action action;
-    data::stream::BufferOutputStream stream(16);
-    if(!m_firstChunk) {
-      stream.write("\r\n", 2, action);
+    if(m_aggregatedSize == 0 && dataIn.bytesLeft >= m_minChunkSize) {
+      return flushChunk(dataIn.currBufferPtr, dataIn.bytesLeft, true, dataOut);
     }
 
-    stream.write("0\r\n\r\n", 5, action);
+    auto size = m_minChunkSize - m_aggregatedSize;
+    if(size > dataIn.bytesLeft) {
+      size = dataIn.bytesLeft;
+    }
 
-    m_chunkHeader = stream.toString();
-    dataOut.set(reinterpret_cast<p_char8>(m_chunkHeader->data()), static_cast<v_buff_size>(m_chunkHeader->size()));
+    std::memcpy(m_aggregate.get() + m_aggregatedSize, dataIn.currBufferPtr, static_cast<size_t>(size));
+    m_aggregatedSize += size;
+    dataIn.inc(size);
 
-    m_firstChunk = false;
-    m_writeChunkHeader = false;
+    if(m_aggregatedSize < m_minChunkSize) {
+      return Error::PROVIDE_DATA_IN;
+    }
 
-    return Error::FLUSH_DATA_OUT;
+    return flushChunk(m_aggregate.get(), m_aggregatedSize, false, dataOut);
 
   }
 
+  if(m_aggregatedSize > 0) {
+    return flushChunk(m_aggregate.get(), m_aggregatedSize, false, dataOut);
+  }
+
+  v_buff_size position = 0;
+  if(!m_firstChunk) {
+    m_chunkHeader[position ++] = '\r';
+    m_chunkHeader[position ++] = '\n';
+  }
+  std::memcpy(m_chunkHeader + position, "0\r\n\r\n", 5);
+  position += 5;
+
+  m_firstChunk = false;
   m_finished = true;
-  dataOut.set(nullptr, 0);
-  return Error::FINISHED;
+
+  dataOut.set(m_chunkHeader, position);
+  return Error::FLUSH_DATA_OUT;
 
 }
 
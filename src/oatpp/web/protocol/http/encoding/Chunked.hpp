@@ -31,17 +31,52 @@
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace encoding {
 
 /**
- * Chunked-encoding buffer processor. &id:oatpp::data::buffer::Processor;.
+ * Chunked-encoding buffer processor. &id:oatpp::data::buffer::Processor;. <br>
+ * Chunk headers are rendered into an inline buffer - no allocations per chunk.
+ * The trailing CRLF of each chunk is sent together with the header of the next chunk.
  */
 class EncoderChunked : public data::buffer::Processor {
+public:
+
+  /**
+   * Default suggested read size.
+   */
+  static constexpr v_io_size DEFAULT_READ_SIZE = 32767;
+
+private:
+
+  /*
+   * "\r\n" + max 16 hex digits + "\r\n".
+   */
+  static constexpr v_buff_size CHUNK_HEADER_MAX_SIZE = 20;
+
 private:
-  oatpp::String m_chunkHeader;
-  bool m_writeChunkHeader = true;
+  static v_buff_size writeChunkHeader(p_char8 buffer, v_buff_size chunkSize, bool firstChunk);
+private:
+  v_int32 flushChunk(const void* data, v_buff_size size, bool fromInput, data::buffer::InlineReadData& dataOut);
+private:
+  v_char8 m_chunkHeader[CHUNK_HEADER_MAX_SIZE];
   bool m_firstChunk = true;
   bool m_finished = false;
   v_io_size m_lastFlush = 0;
+private:
+  const void* m_chunkData = nullptr;
+  v_buff_size m_chunkDataSize = 0;
+  bool m_chunkFromInput = false;
+private:
+  v_buff_size m_minChunkSize;
+  std::unique_ptr<v_char8[]> m_aggregate;
+  v_buff_size m_aggregatedSize = 0;
 public:
 
+  /**
+   * Constructor.
+   * @param minChunkSize - aggregate input smaller than `minChunkSize` until at least `minChunkSize` bytes
+   * are available (or the input ends), so that fewer and bigger chunks are sent. <br>
+   * `0` - don't aggregate. Every portion of input data is sent as a separate chunk.
+   */
+  EncoderChunked(v_buff_size minChunkSize = 0);
+
   /**
    * If the client is using the input stream to read data and add it to the processor,
    * the client MAY ask the processor for a suggested read size.
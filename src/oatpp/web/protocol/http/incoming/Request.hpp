@@ -206,6 +206,15 @@ public:
    */
   oatpp::String getPathVariable(const oatpp::data::share::StringKeyLabel& name) const;
 
+  /**
+   * Get path variable by its position in path-pattern. <br>
+   * Ex. given request path="/sum/19/1" for path-pattern="/sum/{a}/{b}" <br>
+   * getPathVariable(0) == 19, getPathVariable(1) == 1.
+   * @param index - position of the variable in path-pattern.
+   * @return matched value for path-pattern or `nullptr` if index is out of range.
+   */
+  oatpp::String getPathVariable(v_int32 index) const;
+
   /**
    * Get path tail according to path-pattern
    * Ex. given request path="/hello/path/tail" for path-pattern="/hello/\*"
@@ -45,18 +45,16 @@ v_io_size RequestHeadersReader::readHeadersSectionIterative(ReadHeadersIteration
   auto res = stream->peek(bufferData, desiredToRead, action);
   if(res > 0) {
 
-    m_bufferStream->setCurrentPosition(m_bufferStream->getCurrentPosition() + res);
-
-    for(v_buff_size i = 0; i < res; i ++) {
-      iteration.accumulator <<= 8;
-      iteration.accumulator |= bufferData[i];
-      if(iteration.accumulator == SECTION_END) {
-        stream->commitReadOffset(i + 1);
-        iteration.done = true;
-        return res;
-      }
+    auto sectionEnd = utils::HeadersEndScanner::scan(iteration.accumulator, bufferData, res);
+    if(sectionEnd > 0) {
+      /* bytes past the headers section stay in the stream - keep only the head in the buffer */
+      m_bufferStream->setCurrentPosition(m_bufferStream->getCurrentPosition() + sectionEnd);
+      stream->commitReadOffset(sectionEnd);
+      iteration.done = true;
+      return res;
     }
 
+    m_bufferStream->setCurrentPosition(m_bufferStream->getCurrentPosition() + res);
     stream->commitReadOffset(res);
 
   }
@@ -64,6 +62,11 @@ v_io_size RequestHeadersReader::readHeadersSectionIterative(ReadHeadersIteration
   return res;
   
 }
+
+std::shared_ptr<std::string> RequestHeadersReader::captureHeadersText() const {
+  return std::make_shared<std::string>(reinterpret_cast<const char*>(m_bufferStream->getData()),
+                                       static_cast<size_t>(m_bufferStream->getCurrentPosition()));
+}
   
 RequestHeadersReader::Result RequestHeadersReader::readHeaders(data::stream::InputStreamBufferedProxy* stream,
                                                                http::HttpError::Info& error) {
@@ -94,11 +97,12 @@ RequestHeadersReader::Result RequestHeadersReader::readHeaders(data::stream::Inp
   }
   
   if(error.ioStatus > 0) {
-    oatpp::utils::parser::Caret caret (reinterpret_cast<const char*>(m_bufferStream->getData()), m_bufferStream->getCurrentPosition());
+    auto headersText = captureHeadersText();
+    oatpp::utils::parser::Caret caret (headersText->data(), static_cast<v_buff_size>(headersText->size()));
     http::Status status;
-    http::Parser::parseRequestStartingLine(result.startingLine, nullptr, caret, status);
+    http::Parser::parseRequestStartingLine(result.startingLine, headersText, caret, status);
     if(status.code == 0) {
-      http::Parser::parseHeaders(result.headers, nullptr, caret, status);
+      http::Parser::parseHeaders(result.headers, headersText, caret, status);
     }
   }
   
@@ -107,6 +111,30 @@ RequestHeadersReader::Result RequestHeadersReader::readHeaders(data::stream::Inp
 }
   
   
+bool RequestHeadersReader::hasBufferedHeaders(data::stream::InputStreamBufferedProxy* stream) {
+
+  auto available = stream->availableToRead();
+  if(available <= 0) {
+    return false;
+  }
+  if(available > m_maxHeadersSize) {
+    available = m_maxHeadersSize;
+  }
+
+  m_bufferStream->setCurrentPosition(0);
+  m_bufferStream->reserveBytesUpfront(available);
+
+  async::Action action;
+  auto res = stream->peek(m_bufferStream->getData(), available, action);
+  if(res <= 0) {
+    return false;
+  }
+
+  v_uint32 accumulator = 0;
+  return utils::HeadersEndScanner::scan(accumulator, m_bufferStream->getData(), res) > 0;
+
+}
+
 oatpp::async::CoroutineStarterForResult<const RequestHeadersReader::Result&>
 RequestHeadersReader::readHeadersAsync(const std::shared_ptr<data::stream::InputStreamBufferedProxy>& stream)
 {
@@ -154,11 +182,12 @@ RequestHeadersReader::readHeadersAsync(const std::shared_ptr<data::stream::Input
     
     Action parseHeaders() {
 
-      oatpp::utils::parser::Caret caret (reinterpret_cast<const char*>(m_this->m_bufferStream->getData()), m_this->m_bufferStream->getCurrentPosition());
+      auto headersText = m_this->captureHeadersText();
+      oatpp::utils::parser::Caret caret (headersText->data(), static_cast<v_buff_size>(headersText->size()));
       http::Status status;
-      http::Parser::parseRequestStartingLine(m_result.startingLine, nullptr, caret, status);
+      http::Parser::parseRequestStartingLine(m_result.startingLine, headersText, caret, status);
       if(status.code == 0) {
-        http::Parser::parseHeaders(m_result.headers, nullptr, caret, status);
+        http::Parser::parseHeaders(m_result.headers, headersText, caret, status);
         if(status.code == 0) {
           return _return(m_result);
         } else {
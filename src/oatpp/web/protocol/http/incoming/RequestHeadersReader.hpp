@@ -26,6 +26,7 @@
 #define oatpp_web_protocol_http_incoming_RequestHeadersReader_hpp
 
 #include "oatpp/web/protocol/http/Http.hpp"
+#include "oatpp/web/protocol/http/utils/HeadersEndScanner.hpp"
 #include "oatpp/async/Coroutine.hpp"
 #include "oatpp/data/stream/StreamBufferedProxy.hpp"
 #include "oatpp/data/stream/BufferStream.hpp"
@@ -41,8 +42,6 @@ public:
    * Convenience typedef for &id:oatpp::async::Action;.
    */
   typedef oatpp::async::Action Action;
-private:
-  static constexpr v_uint32 SECTION_END = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
 public:
 
   /**
@@ -72,6 +71,12 @@ private:
   v_io_size readHeadersSectionIterative(ReadHeadersIteration& iteration,
                                               data::stream::InputStreamBufferedProxy* stream,
                                               async::Action& action);
+
+  /*
+   * Copy the head accumulated in the buffer stream into a single string.
+   * Starting line and headers are parsed out of it, so all their labels share this one memory handle.
+   */
+  std::shared_ptr<std::string> captureHeadersText() const;
 private:
   oatpp::data::stream::BufferOutputStream* m_bufferStream;
   v_buff_size m_readChunkSize;
@@ -105,6 +110,15 @@ public:
    * @return - &id:oatpp::async::CoroutineStarterForResult;.
    */
   oatpp::async::CoroutineStarterForResult<const RequestHeadersReader::Result&> readHeadersAsync(const std::shared_ptr<data::stream::InputStreamBufferedProxy>& stream);
+
+  /**
+   * Check if the stream buffer already holds a complete headers section of the next request. <br>
+   * Only data already buffered by the stream is checked - this method never reads from the underlying stream.
+   * Used to detect pipelined requests.
+   * @param stream - &id:oatpp::data::stream::InputStreamBufferedProxy;.
+   * @return - `true` if complete request head is buffered.
+   */
+  bool hasBufferedHeaders(data::stream::InputStreamBufferedProxy* stream);
   
 };
   
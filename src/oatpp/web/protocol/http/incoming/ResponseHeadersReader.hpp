@@ -26,6 +26,7 @@
 #define oatpp_web_protocol_http_incoming_ResponseHeadersReader_hpp
 
 #include "oatpp/web/protocol/http/Http.hpp"
+#include "oatpp/web/protocol/http/utils/HeadersEndScanner.hpp"
 #include "oatpp/async/Coroutine.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
@@ -39,8 +40,6 @@ public:
    * Convenience typedef for &id:oatpp::async::Action;.
    */
   typedef oatpp::async::Action Action;
-private:
-  static constexpr v_uint32 SECTION_END = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
 public:
 
   /**
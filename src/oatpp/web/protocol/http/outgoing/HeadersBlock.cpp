@@ -0,0 +1,144 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HeadersBlock.hpp"
+
+#include "oatpp/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+HeadersBlock::HeadersBlock(const Headers& headers) {
+
+  data::stream::BufferOutputStream stream(256);
+  http::Utils::writeHeaders(headers, &stream);
+  m_text = stream.toString();
+
+  auto handle = m_text.getPtr();
+  auto data = m_text->data();
+  v_buff_size offset = 0;
+
+  auto& map = headers.getAll_Unsafe();
+  m_entries.reserve(map.size());
+
+  for(auto& pair : map) {
+    auto keySize = pair.first.getSize();
+    auto valueSize = pair.second.getSize();
+    auto lineSize = keySize + 2 + valueSize + 2;
+    m_entries.push_back({
+      data::share::StringKeyLabelCI(handle, data + offset, keySize),
+      data::share::StringKeyLabel(handle, data + offset + keySize + 2, valueSize),
+      offset,
+      lineSize
+    });
+    offset += lineSize;
+  }
+
+}
+
+std::shared_ptr<HeadersBlock> HeadersBlock::createShared(const Headers& headers) {
+  return std::make_shared<HeadersBlock>(headers);
+}
+
+oatpp::String HeadersBlock::get(const data::share::StringKeyLabelCI& headerName) const {
+  for(auto& entry : m_entries) {
+    if(entry.key == headerName) {
+      return entry.value.toString();
+    }
+  }
+  return nullptr;
+}
+
+const oatpp::String& HeadersBlock::getText() const {
+  return m_text;
+}
+
+bool HeadersBlock::has(const data::share::StringKeyLabelCI& headerName) const {
+  for(auto& entry : m_entries) {
+    if(entry.key == headerName) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool HeadersBlock::isOverridden(const Entry& entry,
+                                const Headers& responseHeaders,
+                                const std::shared_ptr<const HeadersBlock>* otherBlocks,
+                                v_int32 otherBlocksCount)
+{
+  auto& map = responseHeaders.getAll_Unsafe();
+  if(map.find(entry.key) != map.end()) {
+    return true;
+  }
+  for(v_int32 i = 0; i < otherBlocksCount; i ++) {
+    if(otherBlocks[i]->has(entry.key)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void HeadersBlock::writeTo(const Headers& responseHeaders,
+                           const std::shared_ptr<const HeadersBlock>* otherBlocks,
+                           v_int32 otherBlocksCount,
+                           data::stream::ConsistentOutputStream* stream) const
+{
+
+  bool overridden = false;
+  for(auto& entry : m_entries) {
+    if(isOverridden(entry, responseHeaders, otherBlocks, otherBlocksCount)) {
+      overridden = true;
+      break;
+    }
+  }
+
+  if(!overridden) {
+    stream->writeSimple(m_text->data(), static_cast<v_buff_size>(m_text->size()));
+    return;
+  }
+
+  for(auto& entry : m_entries) {
+    if(!isOverridden(entry, responseHeaders, otherBlocks, otherBlocksCount)) {
+      stream->writeSimple(m_text->data() + entry.offset, entry.size);
+    }
+  }
+
+}
+
+void HeadersBlock::putTo(Headers& responseHeaders,
+                         const std::shared_ptr<const HeadersBlock>* otherBlocks,
+                         v_int32 otherBlocksCount) const
+{
+  for(auto& entry : m_entries) {
+    bool overridden = false;
+    for(v_int32 i = 0; i < otherBlocksCount && !overridden; i ++) {
+      overridden = otherBlocks[i]->has(entry.key);
+    }
+    if(!overridden) {
+      responseHeaders.putIfNotExists(entry.key, entry.value);
+    }
+  }
+}
+
+}}}}}
@@ -0,0 +1,121 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_protocol_http_outgoing_HeadersBlock_hpp
+#define oatpp_web_protocol_http_outgoing_HeadersBlock_hpp
+
+#include "oatpp/web/protocol/http/Http.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+/**
+ * Immutable block of pre-serialized response headers. <br>
+ * Use it for headers which are the same for many responses - such as `Server`, `Connection` or CORS headers.
+ * Attach it to the response with &id:oatpp::web::protocol::http::outgoing::Response::addHeadersBlock;. <br>
+ * When the response is sent, the whole block is written with a single copy.
+ * Headers of the response take precedence - block headers which are already present in the response are skipped
+ * (same as `putHeaderIfNotExists`).
+ */
+class HeadersBlock {
+private:
+
+  struct Entry {
+    data::share::StringKeyLabelCI key;
+    data::share::StringKeyLabel value;
+    v_buff_size offset;
+    v_buff_size size;
+  };
+
+private:
+  oatpp::String m_text;
+  std::vector<Entry> m_entries;
+private:
+  static bool isOverridden(const Entry& entry,
+                           const Headers& responseHeaders,
+                           const std::shared_ptr<const HeadersBlock>* otherBlocks,
+                           v_int32 otherBlocksCount);
+public:
+
+  /**
+   * Constructor.
+   * @param headers - headers to pre-serialize. &id:oatpp::web::protocol::http::Headers;.
+   */
+  HeadersBlock(const Headers& headers);
+
+  /**
+   * Create shared HeadersBlock.
+   * @param headers - headers to pre-serialize. &id:oatpp::web::protocol::http::Headers;.
+   * @return - `std::shared_ptr` to HeadersBlock.
+   */
+  static std::shared_ptr<HeadersBlock> createShared(const Headers& headers);
+
+  /**
+   * Get value of the header in this block.
+   * @param headerName - &id:oatpp::data::share::StringKeyLabelCI;.
+   * @return - &id:oatpp::String;. `nullptr` if there is no such header in the block.
+   */
+  oatpp::String get(const data::share::StringKeyLabelCI& headerName) const;
+
+  /**
+   * Get pre-serialized text of the block - `Name: value\r\n` for each header.
+   * @return - &id:oatpp::String;.
+   */
+  const oatpp::String& getText() const;
+
+  /**
+   * Check if the block has header with the given name.
+   * @param headerName - &id:oatpp::data::share::StringKeyLabelCI;.
+   * @return - `true` if the block has such header.
+   */
+  bool has(const data::share::StringKeyLabelCI& headerName) const;
+
+  /**
+   * Write block to stream skipping headers which are present in `responseHeaders` or in one of `otherBlocks`.
+   * @param responseHeaders - headers of the response. &id:oatpp::web::protocol::http::Headers;.
+   * @param otherBlocks - blocks which take precedence over this one.
+   * @param otherBlocksCount - number of blocks in `otherBlocks`.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   */
+  void writeTo(const Headers& responseHeaders,
+               const std::shared_ptr<const HeadersBlock>* otherBlocks,
+               v_int32 otherBlocksCount,
+               data::stream::ConsistentOutputStream* stream) const;
+
+  /**
+   * Put headers of the block to `responseHeaders` (same as `putIfNotExists`) skipping headers present in one of `otherBlocks`.
+   * @param responseHeaders - headers of the response. &id:oatpp::web::protocol::http::Headers;.
+   * @param otherBlocks - blocks which take precedence over this one.
+   * @param otherBlocksCount - number of blocks in `otherBlocks`.
+   */
+  void putTo(Headers& responseHeaders,
+             const std::shared_ptr<const HeadersBlock>* otherBlocks,
+             v_int32 otherBlocksCount) const;
+
+};
+
+}}}}}
+
+#endif // oatpp_web_protocol_http_outgoing_HeadersBlock_hpp
@@ -27,11 +27,14 @@
 #include "oatpp/web/protocol/http/encoding/Chunked.hpp"
 #include "oatpp/utils/Conversion.hpp"
 
+#include <mutex>
+
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
 
 Response::Response(const Status& status,
                    const std::shared_ptr<Body>& body)
   : m_status(status)
+  , m_headersBlocksCount(0)
   , m_body(body)
 {}
 
@@ -78,7 +81,27 @@ bool Response::putHeaderIfNotExists_Unsafe(const oatpp::data::share::StringKeyLa
 }
 
 oatpp::String Response::getHeader(const oatpp::data::share::StringKeyLabelCI& headerName) const {
-  return m_headers.get(headerName);
+  auto value = m_headers.get(headerName);
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_headersBlocksLock);
+  for(v_int32 i = 0; i < m_headersBlocksCount && !value; i ++) {
+    value = m_headersBlocks[i]->get(headerName);
+  }
+  return value;
+}
+
+void Response::addHeadersBlock(const std::shared_ptr<const HeadersBlock>& block) {
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_headersBlocksLock);
+  for(v_int32 i = 0; i < m_headersBlocksCount; i ++) {
+    if(m_headersBlocks[i] == block) {
+      return;
+    }
+  }
+  if(m_headersBlocksCount < MAX_HEADERS_BLOCKS) {
+    m_headersBlocks[m_headersBlocksCount ++] = block;
+  } else {
+    /* No room for one more block - keep its headers anyway */
+    block->putTo(m_headers, m_headersBlocks, m_headersBlocksCount);
+  }
 }
 
 void Response::putBundleData(const oatpp::String& key, const oatpp::Void& polymorph) {
@@ -137,13 +160,14 @@ void Response::send(data::stream::OutputStream* stream,
 
   headersWriteBuffer->setCurrentPosition(0);
 
-  headersWriteBuffer->writeSimple("HTTP/1.1 ", 9);
-  headersWriteBuffer->writeAsString(m_status.code);
-  headersWriteBuffer->writeSimple(" ", 1);
-  headersWriteBuffer->writeSimple(m_status.description);
-  headersWriteBuffer->writeSimple("\r\n", 2);
-
+  http::Utils::writeStatusLine(m_status, headersWriteBuffer);
   http::Utils::writeHeaders(m_headers, headersWriteBuffer);
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_headersBlocksLock);
+    for(v_int32 i = 0; i < m_headersBlocksCount; i ++) {
+      m_headersBlocks[i]->writeTo(m_headers, m_headersBlocks, i, headersWriteBuffer);
+    }
+  }
 
   headersWriteBuffer->writeSimple("\r\n", 2);
 
@@ -158,14 +182,13 @@ void Response::send(data::stream::OutputStream* stream,
           /* Reuse headers buffer */
           /* Transfer without chunked encoder */
           data::stream::transfer(m_body, stream, 0, headersWriteBuffer->getData(), headersWriteBuffer->getCapacity());
-        } else { 
-          if (bodySize + headersWriteBuffer->getCurrentPosition() < headersWriteBuffer->getCapacity()) {
-            headersWriteBuffer->writeSimple(m_body->getKnownData(), bodySize);
-            headersWriteBuffer->flushToStream(stream);
-          } else {
-            headersWriteBuffer->flushToStream(stream);
-            stream->writeExactSizeDataSimple(m_body->getKnownData(), bodySize);
-          }
+        } else {
+          /* Headers and body in one write */
+          data::stream::WriteSegment segments[2] = {
+            {headersWriteBuffer->getData(), headersWriteBuffer->getCurrentPosition()},
+            {m_body->getKnownData(), bodySize}
+          };
+          stream->writevExactSizeDataSimple(segments, 2);
         }
       } else {
 
@@ -213,6 +236,7 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
     std::shared_ptr<data::stream::OutputStream> m_stream;
     std::shared_ptr<oatpp::data::stream::BufferOutputStream> m_headersWriteBuffer;
     std::shared_ptr<http::encoding::EncoderProvider> m_contentEncoderProvider;
+    data::stream::WriteSegment m_segments[2];
   public:
 
     SendAsyncCoroutine(const std::shared_ptr<Response>& _this,
@@ -254,13 +278,14 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
 
       m_headersWriteBuffer->setCurrentPosition(0);
 
-      m_headersWriteBuffer->writeSimple("HTTP/1.1 ", 9);
-      m_headersWriteBuffer->writeAsString(m_this->m_status.code);
-      m_headersWriteBuffer->writeSimple(" ", 1);
-      m_headersWriteBuffer->writeSimple(m_this->m_status.description);
-      m_headersWriteBuffer->writeSimple("\r\n", 2);
-
+      http::Utils::writeStatusLine(m_this->m_status, m_headersWriteBuffer.get());
       http::Utils::writeHeaders(m_this->m_headers, m_headersWriteBuffer.get());
+      {
+        std::lock_guard<oatpp::concurrency::SpinLock> lock(m_this->m_headersBlocksLock);
+        for(v_int32 i = 0; i < m_this->m_headersBlocksCount; i ++) {
+          m_this->m_headersBlocks[i]->writeTo(m_this->m_headers, m_this->m_headersBlocks, i, m_headersWriteBuffer.get());
+        }
+      }
 
       m_headersWriteBuffer->writeSimple("\r\n", 2);
 
@@ -270,18 +295,10 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
 
           if (bodySize >= 0) {
 
-            if (bodySize + m_headersWriteBuffer->getCurrentPosition() < m_headersWriteBuffer->getCapacity()) {
-
-              m_headersWriteBuffer->writeSimple(m_this->m_body->getKnownData(), bodySize);
-              return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-                .next(finish());
-
-            } else {
-
-              return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-                .next(m_stream->writeExactSizeDataAsync(m_this->m_body->getKnownData(), bodySize))
-                .next(finish());
-            }
+            /* Headers and body in one write */
+            m_segments[0] = {m_headersWriteBuffer->getData(), m_headersWriteBuffer->getCurrentPosition()};
+            m_segments[1] = {m_this->m_body->getKnownData(), bodySize};
+            return yieldTo(&SendAsyncCoroutine::writeHeadersAndBody);
 
           } else {
 
@@ -316,6 +333,10 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
 
     }
 
+    Action writeHeadersAndBody() {
+      return m_stream->writevExactSizeDataAsyncInline(m_segments, 2, finish());
+    }
+
   };
 
   return SendAsyncCoroutine::start(_this, stream, headersWriteBuffer, contentEncoder);
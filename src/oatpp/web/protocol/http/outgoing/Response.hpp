@@ -26,12 +26,14 @@
 #define oatpp_web_protocol_http_outgoing_Response_hpp
 
 #include "oatpp/web/protocol/http/outgoing/Body.hpp"
+#include "oatpp/web/protocol/http/outgoing/HeadersBlock.hpp"
 #include "oatpp/web/protocol/http/encoding/EncoderProvider.hpp"
 #include "oatpp/web/protocol/http/Http.hpp"
 
 #include "oatpp/network/ConnectionHandler.hpp"
 
 #include "oatpp/async/Coroutine.hpp"
+#include "oatpp/concurrency/SpinLock.hpp"
 #include "oatpp/data/stream/BufferStream.hpp"
 
 #include "oatpp/data/Bundle.hpp"
@@ -53,9 +55,17 @@ public:
    * Convenience typedef for &id:oatpp::network::ConnectionHandler;.
    */
   typedef oatpp::network::ConnectionHandler ConnectionHandler;
+public:
+  /**
+   * Max number of &id:oatpp::web::protocol::http::outgoing::HeadersBlock; attached to one response.
+   */
+  static constexpr v_int32 MAX_HEADERS_BLOCKS = 4;
 private:
   Status m_status;
   Headers m_headers;
+  std::shared_ptr<const HeadersBlock> m_headersBlocks[MAX_HEADERS_BLOCKS];
+  v_int32 m_headersBlocksCount;
+  mutable oatpp::concurrency::SpinLock m_headersBlocksLock;
   std::shared_ptr<Body> m_body;
   std::shared_ptr<ConnectionHandler> m_connectionUpgradeHandler;
   std::shared_ptr<const ConnectionHandler::ParameterMap> m_connectionUpgradeParameters;
@@ -142,12 +152,23 @@ public:
   bool putHeaderIfNotExists_Unsafe(const oatpp::data::share::StringKeyLabelCI& key, const oatpp::data::share::StringKeyLabel& value);
 
   /**
-   * Get header value
+   * Get header value. Headers of attached &id:oatpp::web::protocol::http::outgoing::HeadersBlock; are checked too.
    * @param headerName - &id:oatpp::data::share::StringKeyLabelCI;.
    * @return - &id:oatpp::String;.
    */
   oatpp::String getHeader(const oatpp::data::share::StringKeyLabelCI& headerName) const;
 
+  /**
+   * Attach block of pre-serialized headers. <br>
+   * Block headers are sent unless the response (or a block attached earlier) has a header with the same name
+   * (same as `putHeaderIfNotExists`). Attaching the same block again has no effect.
+   * Once &l:Response::MAX_HEADERS_BLOCKS; blocks are attached, headers of further blocks are copied to the response
+   * headers instead (same as `putHeaderIfNotExists`). <br>
+   * Thread-safe - the same response may be sent over several connections.
+   * @param block - &id:oatpp::web::protocol::http::outgoing::HeadersBlock;.
+   */
+  void addHeadersBlock(const std::shared_ptr<const HeadersBlock>& block);
+
   /**
    * Put data to bundle.
    * @param key
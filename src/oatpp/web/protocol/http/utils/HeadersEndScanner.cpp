@@ -0,0 +1,234 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "HeadersEndScanner.hpp"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define OATPP_HEADERS_SCANNER_SSE2
+  #include <emmintrin.h>
+  #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define OATPP_HEADERS_SCANNER_AVX2
+    #include <immintrin.h>
+  #endif
+#endif
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace utils {
+
+namespace {
+
+#if defined(OATPP_HEADERS_SCANNER_SSE2) || defined(OATPP_HEADERS_SCANNER_AVX2)
+
+inline v_int32 countTrailingZeros(v_uint32 mask) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctz(mask);
+#else
+  v_int32 result = 0;
+  while((mask & 1) == 0) {
+    mask >>= 1;
+    result ++;
+  }
+  return result;
+#endif
+}
+
+#endif
+
+#if defined(OATPP_HEADERS_SCANNER_SSE2)
+
+inline v_uint32 matchSSE2(const v_char8* data) {
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i lf = _mm_set1_epi8('\n');
+  __m128i m0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), cr);
+  __m128i m1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 1)), lf);
+  __m128i m2 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 2)), cr);
+  __m128i m3 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 3)), lf);
+  return static_cast<v_uint32>(_mm_movemask_epi8(_mm_and_si128(_mm_and_si128(m0, m1), _mm_and_si128(m2, m3))));
+}
+
+v_buff_size findSSE2(const v_char8* data, v_buff_size size) {
+
+  constexpr v_buff_size WINDOW = 16 + 3;
+
+  if(size < WINDOW) {
+    for(v_buff_size i = 0; i + 3 < size; i ++) {
+      if(data[i] == '\r' && data[i + 1] == '\n' && data[i + 2] == '\r' && data[i + 3] == '\n') {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  v_buff_size i = 0;
+  for(; i + WINDOW <= size; i += 16) {
+    auto mask = matchSSE2(data + i);
+    if(mask != 0) {
+      return i + countTrailingZeros(mask);
+    }
+  }
+
+  /* last window overlaps the already scanned data which is known to have no match */
+  if(i < size - 3) {
+    i = size - WINDOW;
+    auto mask = matchSSE2(data + i);
+    if(mask != 0) {
+      return i + countTrailingZeros(mask);
+    }
+  }
+
+  return -1;
+
+}
+
+#endif
+
+#if defined(OATPP_HEADERS_SCANNER_AVX2)
+
+__attribute__((target("avx2")))
+inline v_uint32 matchAVX2(const v_char8* data) {
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i lf = _mm256_set1_epi8('\n');
+  __m256i m0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), cr);
+  __m256i m1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 1)), lf);
+  __m256i m2 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 2)), cr);
+  __m256i m3 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 3)), lf);
+  return static_cast<v_uint32>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_and_si256(m0, m1), _mm256_and_si256(m2, m3))));
+}
+
+__attribute__((target("avx2")))
+v_buff_size findAVX2(const v_char8* data, v_buff_size size) {
+
+  constexpr v_buff_size WINDOW = 32 + 3;
+
+  /* no 256-bit registers touched yet - safe to run the legacy SSE code */
+  if(size < WINDOW) {
+    return findSSE2(data, size);
+  }
+
+  v_buff_size i = 0;
+  for(; i + WINDOW <= size; i += 32) {
+    auto mask = matchAVX2(data + i);
+    if(mask != 0) {
+      return i + countTrailingZeros(mask);
+    }
+  }
+
+  /* last window overlaps the already scanned data which is known to have no match */
+  if(i < size - 3) {
+    i = size - WINDOW;
+    auto mask = matchAVX2(data + i);
+    if(mask != 0) {
+      return i + countTrailingZeros(mask);
+    }
+  }
+
+  return -1;
+
+}
+
+#endif
+
+#if !defined(OATPP_HEADERS_SCANNER_SSE2)
+
+v_buff_size findScalar(const v_char8* data, v_buff_size size) {
+  v_buff_size i = 0;
+  while(i + 3 < size) {
+    auto cr = reinterpret_cast<const v_char8*>(std::memchr(data + i, '\r', static_cast<size_t>(size - i - 3)));
+    if(cr == nullptr) {
+      return -1;
+    }
+    i = cr - data;
+    if(data[i + 1] == '\n' && data[i + 2] == '\r' && data[i + 3] == '\n') {
+      return i;
+    }
+    i ++;
+  }
+  return -1;
+}
+
+#endif
+
+struct Kernel {
+  v_buff_size (*find)(const v_char8* data, v_buff_size size);
+  const char* name;
+};
+
+Kernel selectKernel() {
+#if defined(OATPP_HEADERS_SCANNER_AVX2)
+  if(__builtin_cpu_supports("avx2")) {
+    return {&findAVX2, "avx2"};
+  }
+#endif
+#if defined(OATPP_HEADERS_SCANNER_SSE2)
+  return {&findSSE2, "sse2"};
+#else
+  return {&findScalar, "scalar"};
+#endif
+}
+
+const Kernel& getKernel() {
+  static const Kernel kernel = selectKernel();
+  return kernel;
+}
+
+}
+
+v_buff_size HeadersEndScanner::scan(v_uint32& accumulator, const v_char8* data, v_buff_size size) {
+
+  if(size <= 0) {
+    return -1;
+  }
+
+  /* terminator split between the previous chunks and this one ends within the first three bytes */
+  v_uint32 acc = accumulator;
+  for(v_buff_size i = 0; i < 3 && i < size; i ++) {
+    acc = (acc << 8) | static_cast<v_uint32>(data[i]);
+    if(acc == SECTION_END) {
+      accumulator = acc;
+      return i + 1;
+    }
+  }
+
+  if(size >= 4) {
+    auto pos = getKernel().find(data, size);
+    if(pos >= 0) {
+      accumulator = SECTION_END;
+      return pos + 4;
+    }
+    acc = (static_cast<v_uint32>(data[size - 4]) << 24) | (static_cast<v_uint32>(data[size - 3]) << 16) |
+          (static_cast<v_uint32>(data[size - 2]) << 8) | static_cast<v_uint32>(data[size - 1]);
+  }
+
+  accumulator = acc;
+  return -1;
+
+}
+
+const char* HeadersEndScanner::getKernelName() {
+  return getKernel().name;
+}
+
+}}}}}
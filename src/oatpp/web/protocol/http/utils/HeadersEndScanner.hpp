@@ -0,0 +1,68 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_protocol_http_utils_HeadersEndScanner_hpp
+#define oatpp_web_protocol_http_utils_HeadersEndScanner_hpp
+
+#include "oatpp/Environment.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace utils {
+
+/**
+ * Finds the end of http headers section - `\r\n\r\n`. <br>
+ * Uses AVX2 or SSE2 kernel when available (chosen at runtime), and `memchr`-based scalar kernel otherwise.
+ */
+class HeadersEndScanner {
+public:
+
+  /**
+   * Last four bytes of the headers section.
+   */
+  static constexpr v_uint32 SECTION_END = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
+
+public:
+
+  /**
+   * Scan next chunk of data for the end of headers section. <br>
+   * Terminator split across chunks is found with the help of accumulator
+   * which holds the last four bytes of data scanned so far.
+   * @param accumulator - in/out. Last four bytes of previously scanned chunks. Should be `0` before the first chunk.
+   * @param data - chunk data.
+   * @param size - chunk size.
+   * @return - position in chunk right after the terminator, or `-1` if terminator is not found.
+   */
+  static v_buff_size scan(v_uint32& accumulator, const v_char8* data, v_buff_size size);
+
+  /**
+   * Name of the kernel chosen for this CPU. One of `"avx2"`, `"sse2"`, `"scalar"`.
+   * @return
+   */
+  static const char* getKernelName();
+
+};
+
+}}}}}
+
+#endif /* oatpp_web_protocol_http_utils_HeadersEndScanner_hpp */
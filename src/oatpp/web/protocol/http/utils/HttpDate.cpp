@@ -0,0 +1,109 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HttpDate.hpp"
+
+#include "oatpp/concurrency/SpinLock.hpp"
+
+#include <cstring>
+#include <mutex>
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace utils {
+
+namespace {
+
+  struct DateCache {
+    std::time_t time = -1;
+    oatpp::String value;
+  };
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  thread_local DateCache DATE_CACHE;
+#else
+  DateCache DATE_CACHE;
+  oatpp::concurrency::SpinLock DATE_CACHE_LOCK;
+#endif
+
+  void writeTwoDigits(char* buffer, v_int32 value) {
+    buffer[0] = static_cast<char>('0' + value / 10);
+    buffer[1] = static_cast<char>('0' + value % 10);
+  }
+
+}
+
+oatpp::String HttpDate::format(std::time_t time) {
+
+  static const char* const DAYS[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+  static const char* const MONTHS[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+  std::tm tm {};
+
+#if defined(WIN32) || defined(_WIN32)
+  gmtime_s(&tm, &time);
+#else
+  gmtime_r(&time, &tm);
+#endif
+
+  // "Sun, 06 Nov 1994 08:49:37 GMT"
+  char buffer[29];
+  std::memcpy(buffer, DAYS[tm.tm_wday], 3);
+  buffer[3] = ',';
+  buffer[4] = ' ';
+  writeTwoDigits(buffer + 5, tm.tm_mday);
+  buffer[7] = ' ';
+  std::memcpy(buffer + 8, MONTHS[tm.tm_mon], 3);
+  buffer[11] = ' ';
+  auto year = tm.tm_year + 1900;
+  writeTwoDigits(buffer + 12, year / 100);
+  writeTwoDigits(buffer + 14, year % 100);
+  buffer[16] = ' ';
+  writeTwoDigits(buffer + 17, tm.tm_hour);
+  buffer[19] = ':';
+  writeTwoDigits(buffer + 20, tm.tm_min);
+  buffer[22] = ':';
+  writeTwoDigits(buffer + 23, tm.tm_sec);
+  std::memcpy(buffer + 25, " GMT", 4);
+
+  return oatpp::String(buffer, 29);
+
+}
+
+oatpp::String HttpDate::getCurrent() {
+
+  auto now = std::time(nullptr);
+
+#if defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(DATE_CACHE_LOCK);
+#endif
+
+  if(DATE_CACHE.time != now) {
+    DATE_CACHE.value = format(now);
+    DATE_CACHE.time = now;
+  }
+
+  return DATE_CACHE.value;
+
+}
+
+}}}}}
@@ -0,0 +1,58 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_protocol_http_utils_HttpDate_hpp
+#define oatpp_web_protocol_http_utils_HttpDate_hpp
+
+#include "oatpp/Types.hpp"
+
+#include <ctime>
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace utils {
+
+/**
+ * Http date formatting - `Sun, 06 Nov 1994 08:49:37 GMT` (IMF-fixdate, RFC 7231).
+ */
+class HttpDate {
+public:
+
+  /**
+   * Format time as http date.
+   * @param time - `std::time_t`.
+   * @return - &id:oatpp::String;.
+   */
+  static oatpp::String format(std::time_t time);
+
+  /**
+   * Get current http date - value for the `Date` header. <br>
+   * The value is cached and formatted at most once per second (per thread).
+   * @return - &id:oatpp::String;.
+   */
+  static oatpp::String getCurrent();
+
+};
+
+}}}}}
+
+#endif // oatpp_web_protocol_http_utils_HttpDate_hpp
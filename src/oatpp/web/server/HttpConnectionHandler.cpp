@@ -71,10 +71,27 @@ HttpConnectionHandler::HttpConnectionHandler(const std::shared_ptr<HttpProcessor
   , m_continue(true)
 {}
 
+HttpConnectionHandler::HttpConnectionHandler(const std::shared_ptr<HttpProcessor::Components>& components,
+                                             const HttpWorkerPool::Config& workerPoolConfig)
+  : m_components(components)
+  , m_workerPool(HttpWorkerPool::createShared(workerPoolConfig))
+  , m_continue(true)
+{}
+
 std::shared_ptr<HttpConnectionHandler> HttpConnectionHandler::createShared(const std::shared_ptr<HttpRouter>& router){
   return std::make_shared<HttpConnectionHandler>(router);
 }
 
+std::shared_ptr<HttpConnectionHandler> HttpConnectionHandler::createShared(const std::shared_ptr<HttpRouter>& router,
+                                                                           const HttpWorkerPool::Config& workerPoolConfig)
+{
+  return std::make_shared<HttpConnectionHandler>(std::make_shared<HttpProcessor::Components>(router), workerPoolConfig);
+}
+
+std::shared_ptr<HttpWorkerPool> HttpConnectionHandler::getWorkerPool() const {
+  return m_workerPool;
+}
+
 void HttpConnectionHandler::setErrorHandler(const std::shared_ptr<handler::ErrorHandler>& errorHandler){
   m_components->errorHandler = errorHandler;
   if(!m_components->errorHandler) {
@@ -101,6 +118,15 @@ void HttpConnectionHandler::handleConnection(const provider::ResourceHandle<data
     connection.object->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
     connection.object->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
 
+    if(m_workerPool) {
+      HttpProcessor::Task task(m_components, connection, this);
+      if(!m_workerPool->submit(std::move(task))) {
+        /* Backlog is full or pool is stopped */
+        connection.invalidator->invalidate(connection.object);
+      }
+      return;
+    }
+
     /* Create working thread */
     std::thread thread(&HttpProcessor::Task::run, std::move(HttpProcessor::Task(m_components, connection, this)));
 
@@ -126,6 +152,11 @@ void HttpConnectionHandler::stop() {
   /* invalidate all connections */
   invalidateAllConnections();
 
+  /* Drop queued tasks and wait for pool workers */
+  if(m_workerPool) {
+    m_workerPool->stop();
+  }
+
   /* Wait until all connection-threads are done */
   while(getConnectionsCount() > 0) {
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
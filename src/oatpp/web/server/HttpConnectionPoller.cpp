@@ -0,0 +1,211 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "./HttpConnectionPoller.hpp"
+
+#include "oatpp/network/tcp/Connection.hpp"
+#include "oatpp/base/Log.hpp"
+
+#include <list>
+
+#if defined(__linux__)
+  #include <unistd.h>
+  #include <sys/epoll.h>
+  #include <sys/eventfd.h>
+#endif
+
+namespace oatpp { namespace web { namespace server {
+
+v_io_handle HttpConnectionPoller::getPollableHandle(data::stream::IOStream* connection) {
+  auto tcpConnection = dynamic_cast<network::tcp::Connection*>(connection);
+  if(tcpConnection == nullptr) {
+    return INVALID_IO_HANDLE;
+  }
+  return tcpConnection->getHandle();
+}
+
+#if defined(__linux__)
+
+HttpConnectionPoller::HttpConnectionPoller(const Dispatcher& dispatcher)
+  : m_dispatcher(dispatcher)
+  , m_eventQueue(::epoll_create1(EPOLL_CLOEXEC))
+  , m_wakeupHandle(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+  , m_running(true)
+{
+
+  if(m_eventQueue == -1 || m_wakeupHandle == -1) {
+    OATPP_LOGe("[oatpp::web::server::HttpConnectionPoller::HttpConnectionPoller()]", "Error. Can't create epoll. errno={}", errno)
+    if(m_eventQueue != -1) ::close(m_eventQueue);
+    if(m_wakeupHandle != -1) ::close(m_wakeupHandle);
+    throw std::runtime_error("[oatpp::web::server::HttpConnectionPoller::HttpConnectionPoller()]: Error. Can't create epoll.");
+  }
+
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.fd = m_wakeupHandle;
+  ::epoll_ctl(m_eventQueue, EPOLL_CTL_ADD, m_wakeupHandle, &event);
+
+  m_thread = std::thread(&HttpConnectionPoller::run, this);
+
+}
+
+HttpConnectionPoller::~HttpConnectionPoller() {
+  stop();
+  ::close(m_wakeupHandle);
+  ::close(m_eventQueue);
+}
+
+void HttpConnectionPoller::run() {
+
+  epoll_event events[MAX_EVENTS];
+  std::list<HttpProcessor::Task> ready;
+
+  while(true) {
+
+    auto count = ::epoll_wait(m_eventQueue, events, MAX_EVENTS, -1);
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      if(!m_running) {
+        break;
+      }
+
+      for(v_int32 i = 0; i < count; i ++) {
+        auto handle = events[i].data.fd;
+        if(handle == m_wakeupHandle) {
+          continue;
+        }
+        auto it = m_parked.find(handle);
+        if(it != m_parked.end()) {
+          ::epoll_ctl(m_eventQueue, EPOLL_CTL_DEL, handle, nullptr);
+          ready.push_back(std::move(it->second));
+          m_parked.erase(it);
+        }
+      }
+    }
+
+    /* Dispatch outside of the lock - dispatcher may park connections itself */
+    for(auto& task : ready) {
+      m_dispatcher(std::move(task));
+    }
+    ready.clear();
+
+  }
+
+}
+
+bool HttpConnectionPoller::park(HttpProcessor::Task&& task) {
+
+  auto handle = getPollableHandle(task.getConnection().object.get());
+  if(handle == INVALID_IO_HANDLE) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if(!m_running) {
+    return false;
+  }
+
+  auto it = m_parked.emplace(handle, std::move(task)).first;
+
+  epoll_event event{};
+  event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  event.data.fd = handle;
+
+  if(::epoll_ctl(m_eventQueue, EPOLL_CTL_ADD, handle, &event) != 0) {
+    /* give the task back */
+    task = std::move(it->second);
+    m_parked.erase(it);
+    return false;
+  }
+
+  return true;
+
+}
+
+void HttpConnectionPoller::stop() {
+
+  std::unordered_map<v_io_handle, HttpProcessor::Task> dropped;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(!m_running) {
+      return;
+    }
+    m_running = false;
+    for(auto& p : m_parked) {
+      ::epoll_ctl(m_eventQueue, EPOLL_CTL_DEL, p.first, nullptr);
+    }
+    dropped.swap(m_parked);
+  }
+
+  v_uint64 one = 1;
+  auto res = ::write(m_wakeupHandle, &one, sizeof(one));
+  (void) res;
+
+  if(m_thread.joinable()) {
+    m_thread.join();
+  }
+
+  /* Destroy dropped tasks outside of the lock */
+  dropped.clear();
+
+}
+
+#else
+
+HttpConnectionPoller::HttpConnectionPoller(const Dispatcher& dispatcher)
+  : m_dispatcher(dispatcher)
+  , m_eventQueue(INVALID_IO_HANDLE)
+  , m_wakeupHandle(INVALID_IO_HANDLE)
+  , m_running(false)
+{}
+
+HttpConnectionPoller::~HttpConnectionPoller() {
+  stop();
+}
+
+void HttpConnectionPoller::run() {
+  // DO NOTHING
+}
+
+bool HttpConnectionPoller::park(HttpProcessor::Task&& task) {
+  (void) task;
+  return false;
+}
+
+void HttpConnectionPoller::stop() {
+  // DO NOTHING
+}
+
+#endif
+
+v_int64 HttpConnectionPoller::getParkedCount() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return static_cast<v_int64>(m_parked.size());
+}
+
+}}}
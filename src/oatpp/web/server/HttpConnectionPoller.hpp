@@ -0,0 +1,102 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_server_HttpConnectionPoller_hpp
+#define oatpp_web_server_HttpConnectionPoller_hpp
+
+#include "oatpp/web/server/HttpProcessor.hpp"
+
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace oatpp { namespace web { namespace server {
+
+/**
+ * Poller of idle keep-alive connections. <br>
+ * Holds &id:oatpp::web::server::HttpProcessor::Task;s of idle connections without occupying a thread.
+ * When the connection becomes readable its task is handed back to the dispatcher. <br>
+ * Only plain tcp connections (&id:oatpp::network::tcp::Connection;) can be parked.
+ * Parking is supported on Linux (epoll) only - on other platforms &l:HttpConnectionPoller::park (); always returns `false`.
+ */
+class HttpConnectionPoller {
+public:
+
+  /**
+   * Called from the poller thread with the task of the connection which became readable.
+   */
+  typedef std::function<void(HttpProcessor::Task&& task)> Dispatcher;
+
+private:
+  static constexpr v_int32 MAX_EVENTS = 256;
+private:
+  static v_io_handle getPollableHandle(data::stream::IOStream* connection);
+private:
+  void run();
+private:
+  Dispatcher m_dispatcher;
+  v_io_handle m_eventQueue;
+  v_io_handle m_wakeupHandle;
+  bool m_running;
+  std::unordered_map<v_io_handle, HttpProcessor::Task> m_parked;
+  std::mutex m_mutex;
+  std::thread m_thread;
+public:
+
+  /**
+   * Constructor.
+   * @param dispatcher - &l:HttpConnectionPoller::Dispatcher;.
+   */
+  HttpConnectionPoller(const Dispatcher& dispatcher);
+
+  /**
+   * Destructor. Stops the poller.
+   */
+  ~HttpConnectionPoller();
+
+  /**
+   * Park idle connection until it becomes readable. <br>
+   * If the connection can't be parked the task is left untouched.
+   * @param task - &id:oatpp::web::server::HttpProcessor::Task;.
+   * @return - `true` if the task was parked.
+   */
+  bool park(HttpProcessor::Task&& task);
+
+  /**
+   * Stop the poller. Parked tasks are dropped.
+   */
+  void stop();
+
+  /**
+   * Get number of parked connections.
+   * @return - number of parked connections.
+   */
+  v_int64 getParkedCount();
+
+};
+
+}}}
+
+#endif /* oatpp_web_server_HttpConnectionPoller_hpp */
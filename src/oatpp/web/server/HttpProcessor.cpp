@@ -26,6 +26,7 @@
 
 #include "oatpp/web/server/HttpServerError.hpp"
 #include "oatpp/web/protocol/http/incoming/SimpleBodyDecoder.hpp"
+#include "oatpp/web/protocol/http/utils/HttpDate.hpp"
 #include "oatpp/data/stream/BufferStream.hpp"
 
 namespace oatpp { namespace web { namespace server {
@@ -47,7 +48,19 @@ HttpProcessor::Components::Components(const std::shared_ptr<HttpRouter>& pRouter
   , requestInterceptors(pRequestInterceptors)
   , responseInterceptors(pResponseInterceptors)
   , config(pConfig)
-{}
+{
+
+  protocol::http::Headers headers;
+  headers.put_LockFree(protocol::http::Header::SERVER, protocol::http::Header::Value::SERVER);
+  serverHeaders = protocol::http::outgoing::HeadersBlock::createShared(headers);
+
+  headers.put_LockFree(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_KEEP_ALIVE);
+  keepAliveHeaders = protocol::http::outgoing::HeadersBlock::createShared(headers);
+
+  headers.putOrReplace_LockFree(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_CLOSE);
+  closeHeaders = protocol::http::outgoing::HeadersBlock::createShared(headers);
+
+}
 
 HttpProcessor::Components::Components(const std::shared_ptr<HttpRouter>& pRouter)
   : Components(pRouter,
@@ -80,8 +93,49 @@ HttpProcessor::ProcessingResources::ProcessingResources(const std::shared_ptr<Co
   , headersOutBuffer(components->config->headersOutBufferInitial)
   , headersReader(&headersInBuffer, components->config->headersReaderChunkSize, components->config->headersReaderMaxSize)
   , inStream(data::stream::InputStreamBufferedProxy::createShared(connection.object, std::make_shared<std::string>(data::buffer::IOBuffer::BUFFER_SIZE, 0)))
+  , responsesBuffer(components->config->headersOutBufferInitial)
 {}
 
+void HttpProcessor::addServiceHeaders(const std::shared_ptr<Components>& components,
+                                      const std::shared_ptr<protocol::http::outgoing::Response>& response,
+                                      ConnectionState connectionState)
+{
+
+  switch(connectionState) {
+
+    case ConnectionState::ALIVE :
+      response->addHeadersBlock(components->keepAliveHeaders);
+      break;
+
+    case ConnectionState::CLOSING:
+    case ConnectionState::DEAD:
+      response->addHeadersBlock(components->closeHeaders);
+      break;
+
+    case ConnectionState::DELEGATED:
+    default:
+      response->addHeadersBlock(components->serverHeaders);
+      break;
+
+  }
+
+  if(components->config->sendDateHeader) {
+    response->putOrReplaceHeader(protocol::http::Header::DATE, protocol::http::utils::HttpDate::getCurrent());
+  }
+
+}
+
+bool HttpProcessor::canCoalesceResponse(const std::shared_ptr<Components>& components,
+                                        const std::shared_ptr<protocol::http::outgoing::Response>& response)
+{
+  if(components->config->pipelinedResponsesBufferMaxSize <= 0) {
+    return false;
+  }
+  /* Only in-memory bodies - streaming bodies are written to the connection directly */
+  auto body = response->getBody();
+  return !body || body->getKnownData() != nullptr;
+}
+
 std::shared_ptr<protocol::http::outgoing::Response>
 HttpProcessor::processNextRequest(ProcessingResources& resources,
                                   const std::shared_ptr<protocol::http::incoming::Request>& request,
@@ -172,32 +226,41 @@ HttpProcessor::ConnectionState HttpProcessor::processNextRequest(ProcessingResou
       connectionState = ConnectionState::CLOSING;
     }
 
-    response->putHeaderIfNotExists(protocol::http::Header::SERVER, protocol::http::Header::Value::SERVER);
     protocol::http::utils::CommunicationUtils::considerConnectionState(request, response, connectionState);
+    addServiceHeaders(resources.components, response, connectionState);
+
+  }
 
-    switch(connectionState) {
+  auto contentEncoderProvider =
+    protocol::http::utils::CommunicationUtils::selectEncoder(request, resources.components->contentEncodingProviders);
 
-      case ConnectionState::ALIVE :
-        response->putHeaderIfNotExists(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_KEEP_ALIVE);
-        break;
+  auto& responsesBuffer = resources.responsesBuffer;
+  bool coalesce = connectionState == ConnectionState::ALIVE && canCoalesceResponse(resources.components, response);
+  bool nextRequestBuffered = coalesce && resources.headersReader.hasBufferedHeaders(resources.inStream.get());
 
-      case ConnectionState::CLOSING:
-      case ConnectionState::DEAD:
-        response->putHeaderIfNotExists(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_CLOSE);
-        break;
+  if(coalesce && (nextRequestBuffered || responsesBuffer.getCurrentPosition() > 0)) {
 
-      case ConnectionState::DELEGATED:
-      default:
-        break;
+    response->send(&responsesBuffer, &resources.headersOutBuffer, contentEncoderProvider.get());
 
+    /* Next pipelined request is already in the buffer - its response will be written together with this one */
+    if(nextRequestBuffered && responsesBuffer.getCurrentPosition() < resources.components->config->pipelinedResponsesBufferMaxSize) {
+      return connectionState;
     }
 
-  }
+    responsesBuffer.flushToStream(resources.connection.object.get());
+    responsesBuffer.setCurrentPosition(0);
 
-  auto contentEncoderProvider =
-    protocol::http::utils::CommunicationUtils::selectEncoder(request, resources.components->contentEncodingProviders);
+  } else {
 
-  response->send(resources.connection.object.get(), &resources.headersOutBuffer, contentEncoderProvider.get());
+    /* Keep responses order - write coalesced responses first */
+    if(responsesBuffer.getCurrentPosition() > 0) {
+      responsesBuffer.flushToStream(resources.connection.object.get());
+      responsesBuffer.setCurrentPosition(0);
+    }
+
+    response->send(resources.connection.object.get(), &resources.headersOutBuffer, contentEncoderProvider.get());
+
+  }
 
   /* Delegate connection handling to another handler only after the response is sent to the client */
   if(connectionState == ConnectionState::DELEGATED) {
@@ -250,7 +313,7 @@ HttpProcessor::Task &HttpProcessor::Task::operator=(HttpProcessor::Task &&other)
   return *this;
 }
 
-void HttpProcessor::Task::run(){
+bool HttpProcessor::Task::serve(bool stopWhenIdle) {
 
   m_connection.object->initContexts();
 
@@ -264,12 +327,33 @@ void HttpProcessor::Task::run(){
 
       connectionState = HttpProcessor::processNextRequest(resources);
 
+      if(stopWhenIdle && connectionState == ConnectionState::ALIVE &&
+         resources.responsesBuffer.getCurrentPosition() == 0 &&
+         resources.inStream->availableToRead() == 0)
+      {
+        return true;
+      }
+
     } while (connectionState == ConnectionState::ALIVE);
 
   } catch (...) {
     // DO NOTHING
   }
 
+  return false;
+
+}
+
+void HttpProcessor::Task::run(){
+  serve(false);
+}
+
+bool HttpProcessor::Task::runUntilIdle() {
+  return serve(true);
+}
+
+const provider::ResourceHandle<oatpp::data::stream::IOStream>& HttpProcessor::Task::getConnection() const {
+  return m_connection;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +368,7 @@ HttpProcessor::Coroutine::Coroutine(const std::shared_ptr<Components>& component
   , m_headersReader(&m_headersInBuffer, components->config->headersReaderChunkSize, components->config->headersReaderMaxSize)
   , m_headersOutBuffer(std::make_shared<oatpp::data::stream::BufferOutputStream>(components->config->headersOutBufferInitial))
   , m_inStream(data::stream::InputStreamBufferedProxy::createShared(m_connection.object, std::make_shared<std::string>(data::buffer::IOBuffer::BUFFER_SIZE, 0)))
+  , m_responsesBuffer(std::make_shared<oatpp::data::stream::BufferOutputStream>(components->config->headersOutBufferInitial))
   , m_connectionState(ConnectionState::ALIVE)
   , m_taskListener(taskListener)
   , m_shouldInterceptResponse(false)
@@ -319,7 +404,7 @@ oatpp::async::Action HttpProcessor::Coroutine::onHeadersParsed(const RequestHead
     }
   }
 
-  m_currentRoute = m_components->router->getRoute(headersReadResult.startingLine.method.toString(), headersReadResult.startingLine.path.toString());
+  m_currentRoute = m_components->router->getRoute(headersReadResult.startingLine.method, headersReadResult.startingLine.path);
 
   if(!m_currentRoute) {
 
@@ -363,33 +448,55 @@ HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onResponseFormed() {
     }
   }
 
-  m_currentResponse->putHeaderIfNotExists(protocol::http::Header::SERVER, protocol::http::Header::Value::SERVER);
   oatpp::web::protocol::http::utils::CommunicationUtils::considerConnectionState(m_currentRequest, m_currentResponse, m_connectionState);
+  addServiceHeaders(m_components, m_currentResponse, m_connectionState);
 
-  switch(m_connectionState) {
+  return yieldTo(&HttpProcessor::Coroutine::sendResponse);
 
-    case ConnectionState::ALIVE :
-      m_currentResponse->putHeaderIfNotExists(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_KEEP_ALIVE);
-      break;
+}
 
-    case ConnectionState::CLOSING:
-    case ConnectionState::DEAD:
-      m_currentResponse->putHeaderIfNotExists(protocol::http::Header::CONNECTION, protocol::http::Header::Value::CONNECTION_CLOSE);
-      break;
+HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::sendResponse() {
 
-    case ConnectionState::DELEGATED:
-    default:
-      break;
+  auto contentEncoderProvider =
+    protocol::http::utils::CommunicationUtils::selectEncoder(m_currentRequest, m_components->contentEncodingProviders);
+
+  bool coalesce = m_connectionState == ConnectionState::ALIVE && canCoalesceResponse(m_components, m_currentResponse);
 
+  if(coalesce && (m_responsesBuffer->getCurrentPosition() > 0 || m_headersReader.hasBufferedHeaders(m_inStream.get()))) {
+    return protocol::http::outgoing::Response::sendAsync(m_currentResponse, m_responsesBuffer, m_headersOutBuffer, contentEncoderProvider)
+           .next(yieldTo(&HttpProcessor::Coroutine::onResponseBuffered));
   }
 
-  auto contentEncoderProvider =
-    protocol::http::utils::CommunicationUtils::selectEncoder(m_currentRequest, m_components->contentEncodingProviders);
+  /* Keep responses order - write coalesced responses first */
+  if(m_responsesBuffer->getCurrentPosition() > 0) {
+    return data::stream::BufferOutputStream::flushToStreamAsync(m_responsesBuffer, m_connection.object)
+           .next(protocol::http::outgoing::Response::sendAsync(m_currentResponse, m_connection.object, m_headersOutBuffer, contentEncoderProvider))
+           .next(yieldTo(&HttpProcessor::Coroutine::onResponsesFlushed));
+  }
 
   return protocol::http::outgoing::Response::sendAsync(m_currentResponse, m_connection.object, m_headersOutBuffer, contentEncoderProvider)
          .next(yieldTo(&HttpProcessor::Coroutine::onRequestDone));
 
 }
+
+HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onResponseBuffered() {
+
+  /* Next pipelined request is already in the buffer - its response will be written together with this one */
+  if(m_responsesBuffer->getCurrentPosition() < m_components->config->pipelinedResponsesBufferMaxSize &&
+     m_headersReader.hasBufferedHeaders(m_inStream.get()))
+  {
+    return yieldTo(&HttpProcessor::Coroutine::onRequestDone);
+  }
+
+  return data::stream::BufferOutputStream::flushToStreamAsync(m_responsesBuffer, m_connection.object)
+         .next(yieldTo(&HttpProcessor::Coroutine::onResponsesFlushed));
+
+}
+
+HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onResponsesFlushed() {
+  m_responsesBuffer->setCurrentPosition(0);
+  return yieldTo(&HttpProcessor::Coroutine::onRequestDone);
+}
   
 HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onRequestDone() {
 
@@ -83,6 +83,22 @@ public:
      */
     v_buff_size headersReaderMaxSize = 4096;
 
+    /**
+     * Maximum size of the buffer used to coalesce responses to pipelined requests. <br>
+     * When the next request is already buffered, the response is serialized to this buffer,
+     * and accumulated responses are written to the connection with a single write once the pipeline drains,
+     * or once the buffer grows past this size. <br>
+     * Set to `0` to write every response separately.
+     */
+    v_buff_size pipelinedResponsesBufferMaxSize = 16384;
+
+    /**
+     * Add `Date` header to responses. The header value is formatted at most once per second. <br>
+     * The current date replaces the `Date` header already set on the response,
+     * so a response object sent several times always carries the date of the last send.
+     */
+    bool sendDateHeader = false;
+
   };
 
 public:
@@ -157,6 +173,22 @@ public:
      */
     std::shared_ptr<Config> config;
 
+    /**
+     * Pre-serialized `Server` and `Connection: keep-alive` headers. &id:oatpp::web::protocol::http::outgoing::HeadersBlock;.
+     */
+    std::shared_ptr<const protocol::http::outgoing::HeadersBlock> keepAliveHeaders;
+
+    /**
+     * Pre-serialized `Server` and `Connection: close` headers. &id:oatpp::web::protocol::http::outgoing::HeadersBlock;.
+     */
+    std::shared_ptr<const protocol::http::outgoing::HeadersBlock> closeHeaders;
+
+    /**
+     * Pre-serialized `Server` header. Used when connection is delegated to another handler.
+     * &id:oatpp::web::protocol::http::outgoing::HeadersBlock;.
+     */
+    std::shared_ptr<const protocol::http::outgoing::HeadersBlock> serverHeaders;
+
   };
 
 private:
@@ -172,9 +204,17 @@ private:
     oatpp::data::stream::BufferOutputStream headersOutBuffer;
     RequestHeadersReader headersReader;
     std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy> inStream;
+    oatpp::data::stream::BufferOutputStream responsesBuffer;
 
   };
 
+  static void addServiceHeaders(const std::shared_ptr<Components>& components,
+                                const std::shared_ptr<protocol::http::outgoing::Response>& response,
+                                ConnectionState connectionState);
+
+  static bool canCoalesceResponse(const std::shared_ptr<Components>& components,
+                                  const std::shared_ptr<protocol::http::outgoing::Response>& response);
+
   static
   std::shared_ptr<protocol::http::outgoing::Response>
   processNextRequest(ProcessingResources& resources,
@@ -205,6 +245,8 @@ public:
     std::shared_ptr<Components> m_components;
     provider::ResourceHandle<oatpp::data::stream::IOStream> m_connection;
     TaskProcessingListener* m_taskListener;
+  private:
+    bool serve(bool stopWhenIdle);
   public:
 
     /**
@@ -243,6 +285,21 @@ public:
      */
     void run();
 
+    /**
+     * Run loop until the connection becomes idle. <br>
+     * Connection is idle when the response is sent, connection is kept alive, and there is no buffered input left.
+     * The task may then be resumed with &l:HttpProcessor::Task::run (); or &l:HttpProcessor::Task::runUntilIdle ();
+     * once the connection is readable again.
+     * @return - `true` if the connection is idle, `false` if the connection is closed or delegated.
+     */
+    bool runUntilIdle();
+
+    /**
+     * Get connection served by this task.
+     * @return - &id:oatpp::provider::ResourceHandle; of &id:oatpp::data::stream::IOStream;.
+     */
+    const provider::ResourceHandle<oatpp::data::stream::IOStream>& getConnection() const;
+
   };
   
 public:
@@ -258,6 +315,7 @@ public:
     RequestHeadersReader m_headersReader;
     std::shared_ptr<oatpp::data::stream::BufferOutputStream> m_headersOutBuffer;
     std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy> m_inStream;
+    std::shared_ptr<oatpp::data::stream::BufferOutputStream> m_responsesBuffer;
     ConnectionState m_connectionState;
   private:
     oatpp::web::server::HttpRouter::BranchRouter::Route m_currentRoute;
@@ -288,6 +346,9 @@ public:
     Action onRequestFormed();
     Action onResponse(const std::shared_ptr<protocol::http::outgoing::Response>& response);
     Action onResponseFormed();
+    Action sendResponse();
+    Action onResponseBuffered();
+    Action onResponsesFlushed();
     Action onRequestDone();
     
     Action handleError(Error* error) override;
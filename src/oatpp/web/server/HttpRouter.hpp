@@ -83,7 +83,8 @@ public:
   }
 
   /**
-   * Route URL to Endpoint by method, and pathPattern.
+   * Route URL to Endpoint by method, and pathPattern. <br>
+   * Patterns having no `{var}` and no `*` parts are resolved by the exact match of the normalized path.
    * @param method - http method like ["GET", "POST", etc.].
    * @param pathPattern - url path pattern. ex.: `"/path/to/resource/with/{param1}/{param2}"`.
    * @param endpoint - router endpoint.
@@ -101,7 +102,7 @@ public:
   typename BranchRouter::Route getRoute(const StringKeyLabel& method, const StringKeyLabel& path){
     auto it = m_branchMap.find(method);
     if(it != m_branchMap.end()) {
-      return m_branchMap[method]->getRoute(path);
+      return it->second->getRoute(path);
     }
     return typename BranchRouter::Route();
   }
@@ -0,0 +1,303 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "./HttpWorkerPool.hpp"
+
+#include "oatpp/concurrency/Utils.hpp"
+
+namespace oatpp { namespace web { namespace server {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// HttpWorkerPool::Stats
+
+v_float64 HttpWorkerPool::Stats::getUtilization() const {
+  if(threads == 0) {
+    return 0;
+  }
+  return static_cast<v_float64>(busyThreads) / static_cast<v_float64>(threads);
+}
+
+v_float64 HttpWorkerPool::Stats::getAverageQueueWaitMicro() const {
+  if(tasksExecuted == 0) {
+    return 0;
+  }
+  return static_cast<v_float64>(queueWaitTotalMicro) / static_cast<v_float64>(tasksExecuted);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// HttpWorkerPool
+
+HttpWorkerPool::HttpWorkerPool(const Config& config)
+  : m_config(config)
+  , m_running(true)
+  , m_idleWorkers(0)
+  , m_busyWorkers(0)
+  , m_tasksExecuted(0)
+  , m_tasksRejected(0)
+  , m_queueWaitTotal(0)
+  , m_queueWaitMax(0)
+  , m_parkCount(0)
+{
+
+  if(m_config.maxThreads < 1) {
+    m_config.maxThreads = 1;
+  }
+
+  if(m_config.minThreads < 0) {
+    m_config.minThreads = 0;
+  } else if(m_config.minThreads > m_config.maxThreads) {
+    m_config.minThreads = m_config.maxThreads;
+  }
+
+  if(m_config.parkIdleConnections) {
+    m_poller.reset(new HttpConnectionPoller([this](HttpProcessor::Task&& task) {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      enqueue(std::move(task), lock, true);
+    }));
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for(v_int32 i = 0; i < m_config.minThreads; i ++) {
+    spawnWorker();
+  }
+
+}
+
+HttpWorkerPool::~HttpWorkerPool() {
+  stop();
+}
+
+std::shared_ptr<HttpWorkerPool> HttpWorkerPool::createShared(const Config& config) {
+  return std::make_shared<HttpWorkerPool>(config);
+}
+
+void HttpWorkerPool::spawnWorker() {
+
+  std::thread thread(&HttpWorkerPool::runWorker, this);
+
+  /* Get hardware concurrency -1 in order to have 1cpu free of workers. */
+  v_int32 concurrency = oatpp::concurrency::Utils::getHardwareConcurrency();
+  if (concurrency > 1) {
+    concurrency -= 1;
+  }
+
+  /* Set thread affinity group CPUs [0..cpu_count - 1]. Leave one cpu free of workers */
+  oatpp::concurrency::Utils::setThreadAffinityToCpuRange(thread.native_handle(),
+                                                         0,
+                                                         concurrency - 1 /* -1 because 0-based index */);
+
+  auto id = thread.get_id();
+  m_workers.insert({id, std::move(thread)});
+
+}
+
+void HttpWorkerPool::reapWorkers() {
+  std::list<std::thread> finished;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    finished.swap(m_finishedWorkers);
+  }
+  for(auto& thread : finished) {
+    thread.join();
+  }
+}
+
+void HttpWorkerPool::runWorker() {
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  while(m_running) {
+
+    if(m_queue.empty()) {
+
+      m_idleWorkers ++;
+      auto deadline = std::chrono::steady_clock::now() + m_config.idleTimeout;
+      bool timeout = !m_queueCV.wait_until(lock, deadline, [this]{
+        return !m_running || !m_queue.empty();
+      });
+      m_idleWorkers --;
+
+      if(timeout && static_cast<v_int32>(m_workers.size()) > m_config.minThreads) {
+        break;
+      }
+
+      continue;
+
+    }
+
+    QueueItem item = std::move(m_queue.front());
+    m_queue.pop_front();
+
+    auto wait = static_cast<v_uint64>(oatpp::Environment::getMicroTickCount() - item.enqueueTime);
+    m_queueWaitTotal += wait;
+    if(wait > m_queueWaitMax) {
+      m_queueWaitMax = wait;
+    }
+    m_tasksExecuted ++;
+    m_busyWorkers ++;
+    m_backlogCV.notify_one();
+
+    lock.unlock();
+    runTask(std::move(item.task));
+    lock.lock();
+
+    m_busyWorkers --;
+
+  }
+
+  /* Hand own thread object over to be joined - thread can't join itself */
+  auto it = m_workers.find(std::this_thread::get_id());
+  if(it != m_workers.end()) {
+    m_finishedWorkers.push_back(std::move(it->second));
+    m_workers.erase(it);
+  }
+
+}
+
+void HttpWorkerPool::runTask(HttpProcessor::Task&& task) {
+
+  HttpProcessor::Task t(std::move(task));
+
+  if(!m_poller) {
+    t.run();
+    return;
+  }
+
+  if(t.runUntilIdle()) {
+    if(m_poller->park(std::move(t))) {
+      m_parkCount ++;
+    } else {
+      t.run();
+    }
+  }
+
+}
+
+bool HttpWorkerPool::enqueue(HttpProcessor::Task&& task, std::unique_lock<std::mutex>& lock, bool resumed) {
+
+  /* Resumed connections were already accepted - they are not subject to backlog limits */
+  if(!resumed) {
+
+    if(m_config.rejectionPolicy == RejectionPolicy::BLOCK) {
+      m_backlogCV.wait(lock, [this]{
+        return !m_running || static_cast<v_int64>(m_queue.size()) < m_config.backlog;
+      });
+    }
+
+    if(m_running && static_cast<v_int64>(m_queue.size()) >= m_config.backlog) {
+      m_tasksRejected ++;
+      return false;
+    }
+
+  }
+
+  if(!m_running) {
+    return false;
+  }
+
+  m_queue.push_back({std::move(task), oatpp::Environment::getMicroTickCount()});
+
+  if(static_cast<v_int64>(m_queue.size()) > m_idleWorkers && static_cast<v_int32>(m_workers.size()) < m_config.maxThreads) {
+    spawnWorker();
+  } else {
+    m_queueCV.notify_one();
+  }
+
+  return true;
+
+}
+
+bool HttpWorkerPool::submit(HttpProcessor::Task&& task) {
+  reapWorkers();
+  std::unique_lock<std::mutex> lock(m_mutex);
+  return enqueue(std::move(task), lock, false);
+}
+
+void HttpWorkerPool::stop() {
+
+  std::list<QueueItem> dropped;
+  std::list<std::thread> workers;
+
+  /* Drop parked connections first - so that they are not resumed after the queue is cleared */
+  if(m_poller) {
+    m_poller->stop();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running = false;
+    dropped.swap(m_queue);
+  }
+
+  m_queueCV.notify_all();
+  m_backlogCV.notify_all();
+
+  /* Destroy dropped tasks outside of the lock */
+  dropped.clear();
+
+  while(true) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      for(auto& w : m_workers) {
+        workers.push_back(std::move(w.second));
+      }
+      m_workers.clear();
+      for(auto& w : m_finishedWorkers) {
+        workers.push_back(std::move(w));
+      }
+      m_finishedWorkers.clear();
+    }
+    if(workers.empty()) {
+      break;
+    }
+    for(auto& thread : workers) {
+      if(thread.joinable()) {
+        thread.join();
+      }
+    }
+    workers.clear();
+  }
+
+}
+
+HttpWorkerPool::Stats HttpWorkerPool::getStats() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Stats stats;
+  stats.threads = static_cast<v_int32>(m_workers.size());
+  stats.busyThreads = m_busyWorkers;
+  stats.queueSize = static_cast<v_int64>(m_queue.size());
+  stats.tasksExecuted = m_tasksExecuted;
+  stats.tasksRejected = m_tasksRejected;
+  stats.queueWaitTotalMicro = m_queueWaitTotal;
+  stats.queueWaitMaxMicro = m_queueWaitMax;
+  stats.parkedConnections = m_poller ? m_poller->getParkedCount() : 0;
+  stats.parkCount = m_parkCount.load();
+  return stats;
+}
+
+const HttpWorkerPool::Config& HttpWorkerPool::getConfig() const {
+  return m_config;
+}
+
+}}}
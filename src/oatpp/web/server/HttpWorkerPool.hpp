@@ -0,0 +1,255 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_server_HttpWorkerPool_hpp
+#define oatpp_web_server_HttpWorkerPool_hpp
+
+#include "oatpp/web/server/HttpConnectionPoller.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace oatpp { namespace web { namespace server {
+
+/**
+ * Bounded pool of worker threads serving &id:oatpp::web::server::HttpProcessor::Task;s. <br>
+ * Used by &id:oatpp::web::server::HttpConnectionHandler; instead of thread-per-connection. <br>
+ * Each worker takes a task from the queue and serves the connection until it is closed.
+ * The pool grows from `minThreads` to `maxThreads` when there are no idle workers,
+ * and extra workers exit after staying idle for `idleTimeout`. <br>
+ * With `parkIdleConnections` enabled, idle keep-alive connections are parked in
+ * &id:oatpp::web::server::HttpConnectionPoller; and their workers are released until the next request arrives.
+ */
+class HttpWorkerPool : public base::Countable {
+public:
+
+  /**
+   * What to do with a new task when the queue is full.
+   */
+  enum class RejectionPolicy : v_int32 {
+
+    /**
+     * Reject the task. The connection is closed by the caller.
+     */
+    REJECT = 0,
+
+    /**
+     * Block the caller until there is a free slot in the queue (or the pool is stopped). <br>
+     * Applies backpressure to the accepting thread.
+     */
+    BLOCK = 1
+
+  };
+
+public:
+
+  /**
+   * Worker pool config.
+   */
+  struct Config {
+
+    /**
+     * Number of worker threads which are always running.
+     */
+    v_int32 minThreads = 1;
+
+    /**
+     * Max number of worker threads.
+     */
+    v_int32 maxThreads = 64;
+
+    /**
+     * Max number of tasks waiting in the queue for a free worker.
+     */
+    v_int64 backlog = 1024;
+
+    /**
+     * Policy for tasks which don't fit into the backlog.
+     */
+    RejectionPolicy rejectionPolicy = RejectionPolicy::REJECT;
+
+    /**
+     * Workers above `minThreads` exit after being idle for this long.
+     */
+    std::chrono::milliseconds idleTimeout = std::chrono::seconds(60);
+
+    /**
+     * Park idle keep-alive connections in &id:oatpp::web::server::HttpConnectionPoller; instead of
+     * blocking a worker until the next request. <br>
+     * Connections which can't be polled are served in blocking mode.
+     */
+    bool parkIdleConnections = false;
+
+  };
+
+  /**
+   * Pool utilization statistics.
+   */
+  struct Stats {
+
+    /**
+     * Number of running worker threads.
+     */
+    v_int32 threads;
+
+    /**
+     * Number of workers currently serving a connection.
+     */
+    v_int32 busyThreads;
+
+    /**
+     * Number of tasks waiting in the queue.
+     */
+    v_int64 queueSize;
+
+    /**
+     * Total number of tasks taken by workers.
+     */
+    v_uint64 tasksExecuted;
+
+    /**
+     * Total number of rejected tasks.
+     */
+    v_uint64 tasksRejected;
+
+    /**
+     * Sum of the time tasks spent in the queue. In microseconds.
+     */
+    v_uint64 queueWaitTotalMicro;
+
+    /**
+     * Max time a task spent in the queue. In microseconds.
+     */
+    v_uint64 queueWaitMaxMicro;
+
+    /**
+     * Number of idle connections currently parked in the poller.
+     */
+    v_int64 parkedConnections;
+
+    /**
+     * Total number of times idle connections were parked.
+     */
+    v_uint64 parkCount;
+
+    /**
+     * Ratio of busy workers to running workers - [0..1].
+     * @return - utilization.
+     */
+    v_float64 getUtilization() const;
+
+    /**
+     * Average time a task spent in the queue. In microseconds.
+     * @return - average queue wait time.
+     */
+    v_float64 getAverageQueueWaitMicro() const;
+
+  };
+
+private:
+
+  struct QueueItem {
+    HttpProcessor::Task task;
+    v_int64 enqueueTime;
+  };
+
+private:
+  void spawnWorker();
+  void reapWorkers();
+  void runWorker();
+  void runTask(HttpProcessor::Task&& task);
+  bool enqueue(HttpProcessor::Task&& task, std::unique_lock<std::mutex>& lock, bool resumed);
+private:
+  Config m_config;
+  std::unique_ptr<HttpConnectionPoller> m_poller;
+  bool m_running;
+  std::list<QueueItem> m_queue;
+  std::unordered_map<std::thread::id, std::thread> m_workers;
+  std::list<std::thread> m_finishedWorkers;
+  v_int32 m_idleWorkers;
+  v_int32 m_busyWorkers;
+  v_uint64 m_tasksExecuted;
+  v_uint64 m_tasksRejected;
+  v_uint64 m_queueWaitTotal;
+  v_uint64 m_queueWaitMax;
+  std::atomic<v_uint64> m_parkCount;
+  std::mutex m_mutex;
+  std::condition_variable m_queueCV;
+  std::condition_variable m_backlogCV;
+public:
+
+  /**
+   * Constructor.
+   * @param config - &l:HttpWorkerPool::Config;.
+   */
+  HttpWorkerPool(const Config& config);
+
+  /**
+   * Destructor. Stops the pool.
+   */
+  ~HttpWorkerPool() override;
+
+  /**
+   * Create shared HttpWorkerPool.
+   * @param config - &l:HttpWorkerPool::Config;.
+   * @return - `std::shared_ptr` to HttpWorkerPool.
+   */
+  static std::shared_ptr<HttpWorkerPool> createShared(const Config& config);
+
+  /**
+   * Submit task to the pool. <br>
+   * If the task is rejected it is left untouched.
+   * @param task - &id:oatpp::web::server::HttpProcessor::Task;.
+   * @return - `true` if task was accepted, `false` if it was rejected.
+   */
+  bool submit(HttpProcessor::Task&& task);
+
+  /**
+   * Stop the pool. Tasks remaining in the queue are dropped. <br>
+   * Blocks until all workers are finished - connections of running tasks should be invalidated beforehand.
+   */
+  void stop();
+
+  /**
+   * Get pool statistics.
+   * @return - &l:HttpWorkerPool::Stats;.
+   */
+  Stats getStats();
+
+  /**
+   * Get pool config.
+   * @return - &l:HttpWorkerPool::Config;.
+   */
+  const Config& getConfig() const;
+
+};
+
+}}}
+
+#endif /* oatpp_web_server_HttpWorkerPool_hpp */
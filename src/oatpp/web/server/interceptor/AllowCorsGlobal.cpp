@@ -42,19 +42,19 @@ AllowCorsGlobal::AllowCorsGlobal(const oatpp::String &origin,
                                  const oatpp::String &methods,
                                  const oatpp::String &headers,
                                  const oatpp::String &maxAge)
-  : m_origin(origin)
-  , m_methods(methods)
-  , m_headers(headers)
-  , m_maxAge(maxAge)
-{}
+{
+  protocol::http::Headers corsHeaders;
+  corsHeaders.put_LockFree(protocol::http::Header::CORS_ORIGIN, origin);
+  corsHeaders.put_LockFree(protocol::http::Header::CORS_METHODS, methods);
+  corsHeaders.put_LockFree(protocol::http::Header::CORS_HEADERS, headers);
+  corsHeaders.put_LockFree(protocol::http::Header::CORS_MAX_AGE, maxAge);
+  m_headersBlock = protocol::http::outgoing::HeadersBlock::createShared(corsHeaders);
+}
 
 std::shared_ptr<protocol::http::outgoing::Response> AllowCorsGlobal::intercept(const std::shared_ptr<IncomingRequest>& request,
                                                                                const std::shared_ptr<OutgoingResponse>& response)
 {
-  response->putHeaderIfNotExists(protocol::http::Header::CORS_ORIGIN, m_origin);
-  response->putHeaderIfNotExists(protocol::http::Header::CORS_METHODS, m_methods);
-  response->putHeaderIfNotExists(protocol::http::Header::CORS_HEADERS, m_headers);
-  response->putHeaderIfNotExists(protocol::http::Header::CORS_MAX_AGE, m_maxAge);
+  response->addHeadersBlock(m_headersBlock);
   return response;
 }
 
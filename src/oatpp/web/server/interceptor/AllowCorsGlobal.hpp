@@ -35,12 +35,15 @@ public:
   std::shared_ptr<OutgoingResponse> intercept(const std::shared_ptr<IncomingRequest>& request) override;
 };
 
+/**
+ * Response interceptor adding CORS headers to every response. <br>
+ * The headers are attached as a shared &id:oatpp::web::protocol::http::outgoing::HeadersBlock; -
+ * they are visible via &id:oatpp::web::protocol::http::outgoing::Response::getHeader;,
+ * but not via `Response::getHeaders()`. CORS headers put on the response take precedence over the block.
+ */
 class AllowCorsGlobal : public ResponseInterceptor {
 private:
-  oatpp::String m_origin;
-  oatpp::String m_methods;
-  oatpp::String m_headers;
-  oatpp::String m_maxAge;
+  std::shared_ptr<const protocol::http::outgoing::HeadersBlock> m_headersBlock;
 public:
 
   AllowCorsGlobal(const oatpp::String &origin = "*",
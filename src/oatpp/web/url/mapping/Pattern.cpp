@@ -26,12 +26,140 @@
 
 #include "oatpp/data/stream/BufferStream.hpp"
 
+#include <algorithm>
+
 namespace oatpp { namespace web { namespace url { namespace mapping {
 
 const char* Pattern::Part::FUNCTION_CONST = "const";
 const char* Pattern::Part::FUNCTION_VAR = "var";
 const char* Pattern::Part::FUNCTION_ANY_END = "tail";
 
+Pattern::MatchMap::MatchMap()
+  : m_values()
+  , m_count(0)
+  , m_tail({nullptr, 0})
+{}
+
+Pattern::MatchMap::MatchMap(const Variables& vars, const StringKeyLabel& urlTail)
+  : MatchMap()
+{
+
+  /* Copy all values to a single buffer so that one memory handle covers them all */
+  v_buff_size size = urlTail.getSize();
+  for(auto& pair : vars) {
+    size += pair.second.getSize();
+  }
+
+  m_memoryHandle = std::make_shared<std::string>();
+  m_memoryHandle->reserve(static_cast<size_t>(size));
+
+  auto names = std::make_shared<std::vector<oatpp::String>>();
+  std::vector<std::pair<v_buff_size, v_buff_size>> positions;
+
+  for(auto& pair : vars) {
+    names->push_back(pair.first.toString());
+    positions.push_back({static_cast<v_buff_size>(m_memoryHandle->size()), pair.second.getSize()});
+    m_memoryHandle->append(reinterpret_cast<const char*>(pair.second.getData()), static_cast<size_t>(pair.second.getSize()));
+  }
+
+  auto tailPosition = static_cast<v_buff_size>(m_memoryHandle->size());
+  m_memoryHandle->append(reinterpret_cast<const char*>(urlTail.getData()), static_cast<size_t>(urlTail.getSize()));
+
+  for(auto& p : positions) {
+    pushVariable(m_memoryHandle->data() + p.first, p.second);
+  }
+
+  if(urlTail) {
+    m_tail = {m_memoryHandle->data() + tailPosition, urlTail.getSize()};
+  }
+
+  m_names = names;
+
+}
+
+void Pattern::MatchMap::pushVariable(const char* data, v_buff_size size) {
+  if(m_count < INLINE_CAPACITY) {
+    m_values[m_count] = {data, size};
+  } else {
+    m_extraValues.push_back({data, size});
+  }
+  m_count ++;
+}
+
+void Pattern::MatchMap::popVariable() {
+  m_count --;
+  if(m_count >= INLINE_CAPACITY) {
+    m_extraValues.pop_back();
+  }
+}
+
+void Pattern::MatchMap::setValues(const MatchMap& other) {
+  m_count = other.m_count;
+  for(v_int32 i = 0; i < m_count && i < INLINE_CAPACITY; i ++) {
+    m_values[i] = other.m_values[i];
+  }
+  if(m_count > INLINE_CAPACITY || !m_extraValues.empty()) {
+    m_extraValues = other.m_extraValues;
+  }
+}
+
+const Pattern::MatchMap::Label& Pattern::MatchMap::getValue(v_int32 index) const {
+  if(index < INLINE_CAPACITY) {
+    return m_values[index];
+  }
+  return m_extraValues[static_cast<size_t>(index - INLINE_CAPACITY)];
+}
+
+v_int32 Pattern::MatchMap::getVariablesCount() const {
+  return m_count;
+}
+
+oatpp::String Pattern::MatchMap::getVariableName(v_int32 index) const {
+  if(index < 0 || index >= m_count || !m_names || index >= static_cast<v_int32>(m_names->size())) {
+    return nullptr;
+  }
+  return m_names->at(static_cast<size_t>(index));
+}
+
+oatpp::String Pattern::MatchMap::getVariable(v_int32 index) const {
+  if(index < 0 || index >= m_count) {
+    return nullptr;
+  }
+  const auto& value = getValue(index);
+  return oatpp::String(value.data, value.size);
+}
+
+oatpp::String Pattern::MatchMap::getVariable(const StringKeyLabel& key) const {
+  if(!m_names) {
+    return nullptr;
+  }
+  /* Search from the end - the last variable with the same name wins */
+  auto count = std::min(m_count, static_cast<v_int32>(m_names->size()));
+  for(v_int32 i = count - 1; i >= 0; i --) {
+    const auto& name = m_names->at(static_cast<size_t>(i));
+    if(key.equals(name->data(), static_cast<v_buff_size>(name->size()))) {
+      return getVariable(i);
+    }
+  }
+  return nullptr;
+}
+
+oatpp::String Pattern::MatchMap::getTail() const {
+  return oatpp::String(m_tail.data, m_tail.size);
+}
+
+Pattern::MatchMap::Variables Pattern::MatchMap::getVariables() const {
+  Variables result;
+  if(m_names) {
+    auto count = std::min(m_count, static_cast<v_int32>(m_names->size()));
+    for(v_int32 i = 0; i < count; i ++) {
+      const auto& value = getValue(i);
+      result[m_names->at(static_cast<size_t>(i))] = StringKeyLabel(m_memoryHandle, value.data, value.size);
+    }
+  }
+  return result;
+}
+
 std::shared_ptr<Pattern> Pattern::parse(p_char8 data, v_buff_size size){
   
   if(size <= 0){
@@ -77,9 +205,11 @@ std::shared_ptr<Pattern> Pattern::parse(p_char8 data, v_buff_size size){
       if(i > lastPos){
         auto part = Part::createShared(Part::FUNCTION_VAR, oatpp::String(reinterpret_cast<const char*>(&data[lastPos]), i - lastPos));
         result->m_parts->push_back(part);
+        result->m_variables->push_back(part->text);
       }else{
         auto part = Part::createShared(Part::FUNCTION_VAR, oatpp::String(0));
         result->m_parts->push_back(part);
+        result->m_variables->push_back(part->text);
       }
       
       lastPos = i + 1;
@@ -122,6 +252,9 @@ v_char8 Pattern::findSysChar(oatpp::utils::parser::Caret& caret) const {
 bool Pattern::match(const StringKeyLabel& url, MatchMap& matchMap) const {
   
   oatpp::utils::parser::Caret caret(reinterpret_cast<const char*>(url.getData()), url.getSize());
+
+  matchMap.m_memoryHandle = url.getMemoryHandle();
+  matchMap.m_names = m_variables;
   
   if (m_parts->empty()) {
     return !caret.skipChar('/');    
@@ -142,7 +275,7 @@ bool Pattern::match(const StringKeyLabel& url, MatchMap& matchMap) const {
       
       if(caret.canContinue() && !caret.isAtChar('/')){
         if(caret.isAtChar('?') && (curr == end || (*curr)->function == Part::FUNCTION_ANY_END)) {
-          matchMap.m_tail = StringKeyLabel(url.getMemoryHandle(), caret.getCurrData(), caret.getDataSize() - caret.getPosition());
+          matchMap.m_tail = {caret.getCurrData(), caret.getDataSize() - caret.getPosition()};
           return true;
         }
         return false;
@@ -150,7 +283,7 @@ bool Pattern::match(const StringKeyLabel& url, MatchMap& matchMap) const {
       
     }else if(part->function == Part::FUNCTION_ANY_END){
       if(caret.getDataSize() > caret.getPosition()){
-        matchMap.m_tail = StringKeyLabel(url.getMemoryHandle(), caret.getCurrData(), caret.getDataSize() - caret.getPosition());
+        matchMap.m_tail = {caret.getCurrData(), caret.getDataSize() - caret.getPosition()};
       }
       return true;
     }else if(part->function == Part::FUNCTION_VAR){
@@ -163,14 +296,14 @@ bool Pattern::match(const StringKeyLabel& url, MatchMap& matchMap) const {
       v_char8 a = findSysChar(caret);
       if(a == '?') {
         if(curr == end || (*curr)->function == Part::FUNCTION_ANY_END) {
-          matchMap.m_variables[part->text] = StringKeyLabel(url.getMemoryHandle(), label.getData(), label.getSize());
-          matchMap.m_tail = StringKeyLabel(url.getMemoryHandle(), caret.getCurrData(), caret.getDataSize() - caret.getPosition());
+          matchMap.pushVariable(label.getData(), label.getSize());
+          matchMap.m_tail = {caret.getCurrData(), caret.getDataSize() - caret.getPosition()};
           return true;
         }
         caret.findChar('/');
       }
       
-      matchMap.m_variables[part->text] = StringKeyLabel(url.getMemoryHandle(), label.getData(), label.getSize());
+      matchMap.pushVariable(label.getData(), label.getSize());
       
     }
     
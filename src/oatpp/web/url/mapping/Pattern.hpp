@@ -30,46 +30,110 @@
 
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 namespace oatpp { namespace web { namespace url { namespace mapping {
-  
+
+class PatternTrie;
+class StaticRouteTable;
+
 class Pattern : public base::Countable{
+  friend PatternTrie;
+  friend StaticRouteTable;
 private:
   typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
 public:
   
+  /**
+   * Variables and tail of the url resolved by pattern. <br>
+   * Values are kept as pointers into the url buffer - the buffer is retained once per map,
+   * and the first &l:Pattern::MatchMap::INLINE_CAPACITY; values are stored inline. <br>
+   * Variables are addressable by their position in the pattern.
+   */
   class MatchMap {
     friend Pattern;
+    friend PatternTrie;
   public:
     typedef std::unordered_map<StringKeyLabel, StringKeyLabel> Variables;
+  public:
+
+    /**
+     * Number of variables stored without heap allocation.
+     */
+    static constexpr v_int32 INLINE_CAPACITY = 8;
+
+  private:
+
+    struct Label {
+      const char* data;
+      v_buff_size size;
+    };
+
   private:
-    Variables m_variables;
-    StringKeyLabel m_tail;
+    std::shared_ptr<std::string> m_memoryHandle;
+    std::shared_ptr<const std::vector<oatpp::String>> m_names;
+    Label m_values[INLINE_CAPACITY];
+    std::vector<Label> m_extraValues;
+    v_int32 m_count;
+    Label m_tail;
+  private:
+    void pushVariable(const char* data, v_buff_size size);
+    void popVariable();
+    void setValues(const MatchMap& other);
+    const Label& getValue(v_int32 index) const;
   public:
-    
-    MatchMap() {}
-    
-    MatchMap(const Variables& vars, const StringKeyLabel& urlTail)
-      : m_variables(vars)
-      , m_tail(urlTail)
-    {}
-    
-    oatpp::String getVariable(const StringKeyLabel& key) const {
-      auto it = m_variables.find(key);
-      if(it != m_variables.end()) {
-        return it->second.toString();
-      }
-      return nullptr;
-    }
-    
-    oatpp::String getTail() const {
-      return m_tail.toString();
-    }
 
-    const Variables& getVariables() const {
-      return m_variables;
-    }
-    
+    /**
+     * Default constructor.
+     */
+    MatchMap();
+
+    /**
+     * Constructor.
+     * @param vars - variables map.
+     * @param urlTail - url tail.
+     */
+    MatchMap(const Variables& vars, const StringKeyLabel& urlTail);
+
+    /**
+     * Get number of resolved variables.
+     * @return
+     */
+    v_int32 getVariablesCount() const;
+
+    /**
+     * Get variable name by its position in the pattern.
+     * @param index - position of the variable in the pattern.
+     * @return - variable name or `nullptr` if index is out of range.
+     */
+    oatpp::String getVariableName(v_int32 index) const;
+
+    /**
+     * Get variable value by its position in the pattern.
+     * @param index - position of the variable in the pattern.
+     * @return - variable value or `nullptr` if index is out of range.
+     */
+    oatpp::String getVariable(v_int32 index) const;
+
+    /**
+     * Get variable value by name.
+     * @param key - variable name.
+     * @return - variable value or `nullptr` if no such variable.
+     */
+    oatpp::String getVariable(const StringKeyLabel& key) const;
+
+    /**
+     * Get url tail.
+     * @return
+     */
+    oatpp::String getTail() const;
+
+    /**
+     * Get all variables as a map. Creates a new map on each call.
+     * @return - &l:Pattern::MatchMap::Variables;.
+     */
+    Variables getVariables() const;
+
   };
   
 private:
@@ -97,6 +161,7 @@ private:
   
 private:
   std::shared_ptr<std::list<std::shared_ptr<Part>>> m_parts{std::make_shared<std::list<std::shared_ptr<Part>>>()};
+  std::shared_ptr<std::vector<oatpp::String>> m_variables{std::make_shared<std::vector<oatpp::String>>()};
 private:
   v_char8 findSysChar(oatpp::utils::parser::Caret& caret) const;
 public:
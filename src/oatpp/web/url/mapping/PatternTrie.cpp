@@ -0,0 +1,209 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "PatternTrie.hpp"
+
+#include <limits>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+PatternTrie::Node::Node()
+  : index(-1)
+  , minIndex(std::numeric_limits<v_int64>::max())
+{}
+
+PatternTrie::MatchState::MatchState(const StringKeyLabel& pUrl, Pattern::MatchMap& pBestVariables)
+  : url(pUrl)
+  , data(reinterpret_cast<const char*>(pUrl.getData()))
+  , size(pUrl.getSize())
+  , best(nullptr)
+  , bestIndex(std::numeric_limits<v_int64>::max())
+  , bestVariables(pBestVariables)
+  , bestTailPosition(-1)
+{}
+
+void PatternTrie::insert(const std::shared_ptr<Pattern>& pattern, v_int64 index) {
+
+  Node* node = &m_root;
+
+  if(node->minIndex > index) {
+    node->minIndex = index;
+  }
+
+  if(pattern) {
+    for(const std::shared_ptr<Pattern::Part>& part : *pattern->m_parts) {
+
+      std::unique_ptr<Node>* child;
+
+      if(part->function == Pattern::Part::FUNCTION_CONST) {
+        child = &node->constChildren[StringKeyLabel(part->text)];
+      } else if(part->function == Pattern::Part::FUNCTION_VAR) {
+        child = &node->varChild;
+      } else {
+        child = &node->tailChild;
+      }
+
+      if(!*child) {
+        child->reset(new Node());
+      }
+      node = child->get();
+
+      if(node->minIndex > index) {
+        node->minIndex = index;
+      }
+
+      if(part->function == Pattern::Part::FUNCTION_ANY_END) {
+        break;
+      }
+
+    }
+  }
+
+  /* Pattern inserted earlier shadows the same pattern inserted later */
+  if(node->index < 0) {
+    node->index = index;
+    if(pattern) {
+      node->variables = pattern->m_variables;
+    }
+  }
+
+}
+
+v_buff_size PatternTrie::skipSlashes(const MatchState& state, v_buff_size pos) {
+  while(pos < state.size && state.data[pos] == '/') {
+    pos ++;
+  }
+  return pos;
+}
+
+void PatternTrie::setCandidate(MatchState& state, const Node* node, v_buff_size tailPosition) {
+  if(node->index >= 0 && node->index < state.bestIndex) {
+    state.best = node;
+    state.bestIndex = node->index;
+    state.bestVariables.setValues(state.variables);
+    state.bestTailPosition = tailPosition;
+  }
+}
+
+void PatternTrie::matchTerminals(const Node* node, v_buff_size pos, MatchState& state) const {
+
+  auto p = skipSlashes(state, pos);
+
+  if(p == state.size) {
+    setCandidate(state, node, -1);
+  }
+
+  if(node->tailChild) {
+    setCandidate(state, node->tailChild.get(), p < state.size ? p : -1);
+  }
+
+}
+
+void PatternTrie::matchChildren(const Node* node, v_buff_size pos, MatchState& state) const {
+
+  auto p = skipSlashes(state, pos);
+  if(p == state.size) {
+    return;
+  }
+
+  auto end = p;
+  while(end < state.size && state.data[end] != '/' && state.data[end] != '?') {
+    end ++;
+  }
+
+  if(!node->constChildren.empty()) {
+    auto it = node->constChildren.find(StringKeyLabel(nullptr, state.data + p, end - p));
+    if(it != node->constChildren.end()) {
+      matchSegment(it->second.get(), end, false, state);
+    }
+  }
+
+  if(node->varChild) {
+    state.variables.pushVariable(state.data + p, end - p);
+    matchSegment(node->varChild.get(), end, true, state);
+    state.variables.popVariable();
+  }
+
+}
+
+void PatternTrie::matchSegment(const Node* child, v_buff_size end, bool isVar, MatchState& state) const {
+
+  if(child->minIndex >= state.bestIndex) {
+    return;
+  }
+
+  if(end < state.size && state.data[end] == '?') {
+
+    /* Query string terminates the path for the patterns ending here or followed by the tail */
+    setCandidate(state, child, end);
+    if(child->tailChild) {
+      setCandidate(state, child->tailChild.get(), end);
+    }
+
+    /* Path variable followed by other parts skips the rest of the segment */
+    if(isVar) {
+      auto p = end;
+      while(p < state.size && state.data[p] != '/') {
+        p ++;
+      }
+      matchChildren(child, p, state);
+    }
+
+    return;
+
+  }
+
+  matchTerminals(child, end, state);
+  matchChildren(child, end, state);
+
+}
+
+v_int64 PatternTrie::match(const StringKeyLabel& url, Pattern::MatchMap& matchMap) const {
+
+  if(m_root.minIndex == std::numeric_limits<v_int64>::max()) {
+    return -1;
+  }
+
+  MatchState state(url, matchMap);
+
+  matchTerminals(&m_root, 0, state);
+  matchChildren(&m_root, 0, state);
+
+  if(state.best == nullptr) {
+    return -1;
+  }
+
+  matchMap.m_memoryHandle = url.getMemoryHandle();
+  matchMap.m_names = state.best->variables;
+
+  if(state.bestTailPosition >= 0) {
+    matchMap.m_tail = {state.data + state.bestTailPosition, state.size - state.bestTailPosition};
+  }
+
+  return state.bestIndex;
+
+}
+
+}}}}
@@ -0,0 +1,126 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_url_mapping_PatternTrie_hpp
+#define oatpp_web_url_mapping_PatternTrie_hpp
+
+#include "./Pattern.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+/**
+ * Trie of &id:oatpp::web::url::mapping::Pattern; parts. <br>
+ * Each const part of a pattern is a single edge keyed by the whole path segment,
+ * `{var}` and `*` parts are the dedicated var and tail edges of a node. <br>
+ * Lookup cost depends on the depth of the path, not on the number of patterns. <br>
+ * When several patterns match the same path the one inserted first wins - same as sequential &l:Pattern::match ();.
+ */
+class PatternTrie {
+private:
+  typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+private:
+
+  struct Node {
+
+    /**
+     * Index of the pattern ending at this node. `-1` if no pattern ends here.
+     */
+    v_int64 index;
+
+    /**
+     * Minimal index of patterns in this subtree. Used to prune the search.
+     */
+    v_int64 minIndex;
+
+    /**
+     * Names of path variables of the pattern ending at this node, in order of their appearance in the pattern.
+     */
+    std::shared_ptr<const std::vector<oatpp::String>> variables;
+
+    std::unordered_map<StringKeyLabel, std::unique_ptr<Node>> constChildren;
+    std::unique_ptr<Node> varChild;
+    std::unique_ptr<Node> tailChild;
+
+    Node();
+
+  };
+
+private:
+
+  struct MatchState {
+
+    MatchState(const StringKeyLabel& pUrl, Pattern::MatchMap& pBestVariables);
+
+    const StringKeyLabel& url;
+    const char* data;
+    v_buff_size size;
+
+    /**
+     * Variables resolved on the current path of the search.
+     */
+    Pattern::MatchMap variables;
+
+    const Node* best;
+    v_int64 bestIndex;
+    Pattern::MatchMap& bestVariables;
+    v_buff_size bestTailPosition;
+
+  };
+
+private:
+  static v_buff_size skipSlashes(const MatchState& state, v_buff_size pos);
+  static void setCandidate(MatchState& state, const Node* node, v_buff_size tailPosition);
+  void matchTerminals(const Node* node, v_buff_size pos, MatchState& state) const;
+  void matchChildren(const Node* node, v_buff_size pos, MatchState& state) const;
+  void matchSegment(const Node* child, v_buff_size end, bool isVar, MatchState& state) const;
+private:
+  Node m_root;
+public:
+
+  /**
+   * Insert pattern.
+   * @param pattern - &id:oatpp::web::url::mapping::Pattern;.
+   * @param index - index of the pattern. Returned by &l:PatternTrie::match (); when pattern matches. <br>
+   * Must be greater than index of any previously inserted pattern.
+   */
+  void insert(const std::shared_ptr<Pattern>& pattern, v_int64 index);
+
+  /**
+   * Find first inserted pattern matching the url.
+   * @param url - url path.
+   * @param matchMap - &id:oatpp::web::url::mapping::Pattern::MatchMap; to put resolved path variables and tail to.
+   * @return - index of the matched pattern or `-1` if no pattern matches.
+   */
+  v_int64 match(const StringKeyLabel& url, Pattern::MatchMap& matchMap) const;
+
+};
+
+}}}}
+
+#endif /* oatpp_web_url_mapping_PatternTrie_hpp */
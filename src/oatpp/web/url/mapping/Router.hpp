@@ -25,13 +25,14 @@
 #ifndef oatpp_web_url_mapping_Router_hpp
 #define oatpp_web_url_mapping_Router_hpp
 
-#include "./Pattern.hpp"
+#include "./PatternTrie.hpp"
+#include "./StaticRouteTable.hpp"
 
 #include "oatpp/Types.hpp"
 #include "oatpp/base/Log.hpp"
 
 #include <utility>
-#include <list>
+#include <vector>
 
 namespace oatpp { namespace web { namespace url { namespace mapping {
 
@@ -79,7 +80,7 @@ public:
     Route(const Endpoint& endpoint, Pattern::MatchMap&& matchMap)
       : m_valid(true)
       , m_endpoint(endpoint)
-      , m_matchMap(matchMap)
+      , m_matchMap(std::move(matchMap))
     {}
 
     /**
@@ -111,7 +112,9 @@ public:
   };
   
 private:
-  std::list<Pair> m_endpointsByPattern;
+  std::vector<Pair> m_endpointsByPattern;
+  PatternTrie m_trie;
+  StaticRouteTable m_staticRoutes;
 public:
   
   static std::shared_ptr<Router> createShared(){
@@ -125,21 +128,38 @@ public:
    */
   void route(const oatpp::String& pathPattern, const Endpoint& endpoint) {
     auto pattern = Pattern::parse(pathPattern);
+    auto index = static_cast<v_int64>(m_endpointsByPattern.size());
+
+    /* Static route goes to the fast path only if no route added earlier matches the same path */
+    auto staticPath = StaticRouteTable::getNormalizedPath(pattern);
+    if(staticPath) {
+      Pattern::MatchMap matchMap;
+      if(m_trie.match(staticPath, matchMap) < 0) {
+        m_staticRoutes.put(staticPath, index);
+      }
+    }
+
+    m_trie.insert(pattern, index);
     m_endpointsByPattern.push_back({pattern, endpoint});
   }
 
   /**
-   * Resolve path to corresponding endpoint.
+   * Resolve path to corresponding endpoint. <br>
+   * If several patterns match the path, the endpoint routed first is returned.
    * @param path
    * @return - &id:Router::Route;.
    */
   Route getRoute(const StringKeyLabel& path) const {
 
-    for(auto& pair : m_endpointsByPattern) {
-      Pattern::MatchMap matchMap;
-      if(pair.first->match(path, matchMap)) {
-        return Route(pair.second, std::move(matchMap));
-      }
+    auto index = m_staticRoutes.find(path);
+    if(index >= 0) {
+      return Route(m_endpointsByPattern[static_cast<size_t>(index)].second, Pattern::MatchMap());
+    }
+
+    Pattern::MatchMap matchMap;
+    index = m_trie.match(path, matchMap);
+    if(index >= 0) {
+      return Route(m_endpointsByPattern[static_cast<size_t>(index)].second, std::move(matchMap));
     }
 
     return Route();
@@ -0,0 +1,190 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "StaticRouteTable.hpp"
+
+#include "oatpp/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+StaticRouteTable::StaticRouteTable()
+  : m_count(0)
+{}
+
+v_uint64 StaticRouteTable::hashPath(const char* data, v_buff_size size, bool& isStatic) {
+
+  /* FNV-1a over path segments joined with a single '/' */
+  v_uint64 hash = 14695981039346656037ULL;
+  bool started = false;
+  bool separator = false;
+
+  for(v_buff_size i = 0; i < size; i ++) {
+    auto c = data[i];
+    if(c == '/') {
+      separator = started;
+      continue;
+    }
+    if(c == '?') {
+      isStatic = false;
+      return 0;
+    }
+    if(separator) {
+      hash = (hash ^ static_cast<v_uint8>('/')) * 1099511628211ULL;
+      separator = false;
+    }
+    hash = (hash ^ static_cast<v_uint8>(c)) * 1099511628211ULL;
+    started = true;
+  }
+
+  isStatic = true;
+  return hash;
+
+}
+
+bool StaticRouteTable::pathEquals(const char* data, v_buff_size size, const oatpp::String& key) {
+
+  auto keyData = key->data();
+  auto keySize = static_cast<v_buff_size>(key->size());
+  v_buff_size k = 0;
+  bool separator = false;
+
+  for(v_buff_size i = 0; i < size; i ++) {
+    auto c = data[i];
+    if(c == '/') {
+      separator = k > 0;
+      continue;
+    }
+    if(separator) {
+      if(k >= keySize || keyData[k] != '/') {
+        return false;
+      }
+      k ++;
+      separator = false;
+    }
+    if(k >= keySize || keyData[k] != c) {
+      return false;
+    }
+    k ++;
+  }
+
+  return k == keySize;
+
+}
+
+oatpp::String StaticRouteTable::getNormalizedPath(const std::shared_ptr<Pattern>& pattern) {
+
+  if(!pattern) {
+    return "";
+  }
+
+  data::stream::BufferOutputStream stream(256);
+  for(const std::shared_ptr<Pattern::Part>& part : *pattern->m_parts) {
+    if(part->function != Pattern::Part::FUNCTION_CONST) {
+      return nullptr;
+    }
+    if(stream.getCurrentPosition() > 0) {
+      stream.writeCharSimple('/');
+    }
+    stream.writeSimple(part->text);
+  }
+
+  return stream.toString();
+
+}
+
+void StaticRouteTable::rehash(size_t capacity) {
+  std::vector<Entry> entries(capacity, Entry{0, -1, nullptr});
+  v_uint64 mask = capacity - 1;
+  for(auto& entry : m_entries) {
+    if(entry.index >= 0) {
+      v_uint64 i = entry.hash & mask;
+      while(entries[i].index >= 0) {
+        i = (i + 1) & mask;
+      }
+      entries[i] = std::move(entry);
+    }
+  }
+  m_entries = std::move(entries);
+}
+
+void StaticRouteTable::put(const oatpp::String& normalizedPath, v_int64 index) {
+
+  /* keep load factor under 1/2 so that misses terminate quickly */
+  if((m_count + 1) * 2 > m_entries.size()) {
+    rehash(m_entries.empty() ? 16 : m_entries.size() * 2);
+  }
+
+  bool isStatic;
+  auto hash = hashPath(normalizedPath->data(), static_cast<v_buff_size>(normalizedPath->size()), isStatic);
+  if(!isStatic) {
+    return;
+  }
+
+  v_uint64 mask = m_entries.size() - 1;
+  v_uint64 i = hash & mask;
+  while(m_entries[i].index >= 0) {
+    if(m_entries[i].hash == hash && m_entries[i].key == normalizedPath) {
+      return;
+    }
+    i = (i + 1) & mask;
+  }
+
+  m_entries[i] = Entry{hash, index, normalizedPath};
+  m_count ++;
+
+}
+
+v_int64 StaticRouteTable::find(const StringKeyLabel& path) const {
+
+  if(m_count == 0) {
+    return -1;
+  }
+
+  auto data = reinterpret_cast<const char*>(path.getData());
+  bool isStatic;
+  auto hash = hashPath(data, path.getSize(), isStatic);
+  if(!isStatic) {
+    return -1;
+  }
+
+  v_uint64 mask = m_entries.size() - 1;
+  v_uint64 i = hash & mask;
+  while(m_entries[i].index >= 0) {
+    const auto& entry = m_entries[i];
+    if(entry.hash == hash && pathEquals(data, path.getSize(), entry.key)) {
+      return entry.index;
+    }
+    i = (i + 1) & mask;
+  }
+
+  return -1;
+
+}
+
+v_buff_size StaticRouteTable::getCount() const {
+  return static_cast<v_buff_size>(m_count);
+}
+
+}}}}
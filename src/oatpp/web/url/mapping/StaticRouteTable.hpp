@@ -0,0 +1,98 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_url_mapping_StaticRouteTable_hpp
+#define oatpp_web_url_mapping_StaticRouteTable_hpp
+
+#include "./Pattern.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+/**
+ * Open-addressing hash table of routes having const parts only. <br>
+ * Keys are normalized paths - path segments joined with a single `/` with no leading or trailing slashes,
+ * so `"//api///health/"` and `"api/health"` resolve to the same route. <br>
+ * Lookup costs one hash of the path and one compare.
+ */
+class StaticRouteTable {
+private:
+  typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+private:
+
+  struct Entry {
+    v_uint64 hash;
+    v_int64 index;
+    oatpp::String key;
+  };
+
+private:
+  static v_uint64 hashPath(const char* data, v_buff_size size, bool& isStatic);
+  static bool pathEquals(const char* data, v_buff_size size, const oatpp::String& key);
+private:
+  void rehash(size_t capacity);
+private:
+  std::vector<Entry> m_entries;
+  size_t m_count;
+public:
+
+  /**
+   * Constructor.
+   */
+  StaticRouteTable();
+
+  /**
+   * Normalize path of the static pattern.
+   * @param pattern - &id:oatpp::web::url::mapping::Pattern;.
+   * @return - normalized path or `nullptr` if pattern has non-const parts.
+   */
+  static oatpp::String getNormalizedPath(const std::shared_ptr<Pattern>& pattern);
+
+  /**
+   * Put normalized path to the table. If path is already in the table - does nothing.
+   * @param normalizedPath - path as returned by &l:StaticRouteTable::getNormalizedPath ();.
+   * @param index - route index.
+   */
+  void put(const oatpp::String& normalizedPath, v_int64 index);
+
+  /**
+   * Find route index by url path.
+   * @param path - url path. Paths containing query string are never found.
+   * @return - route index or `-1` if not found.
+   */
+  v_int64 find(const StringKeyLabel& path) const;
+
+  /**
+   * Number of routes in the table.
+   * @return
+   */
+  v_buff_size getCount() const;
+
+};
+
+}}}}
+
+#endif /* oatpp_web_url_mapping_StaticRouteTable_hpp */
@@ -1,4 +1,5 @@
 
+#include "oatpp/web/AsyncAllocationPerfTest.hpp"
 #include "oatpp/web/ClientRetryTest.hpp"
 #include "oatpp/web/FullTest.hpp"
 #include "oatpp/web/FullAsyncTest.hpp"
@@ -6,9 +7,18 @@
 #include "oatpp/web/PipelineTest.hpp"
 #include "oatpp/web/PipelineAsyncTest.hpp"
 #include "oatpp/web/protocol/http/encoding/ChunkedTest.hpp"
+#include "oatpp/web/protocol/http/HeadersMapTest.hpp"
+#include "oatpp/web/protocol/http/HeadersMapPerfTest.hpp"
+#include "oatpp/web/protocol/http/incoming/RequestHeadersReaderTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/HeadersBlockTest.hpp"
+#include "oatpp/web/protocol/http/utils/HeadersEndScannerTest.hpp"
+#include "oatpp/web/protocol/http/utils/HeadersEndScannerPerfTest.hpp"
 #include "oatpp/web/server/api/ApiControllerTest.hpp"
 #include "oatpp/web/server/handler/AuthorizationHandlerTest.hpp"
 #include "oatpp/web/server/HttpRouterTest.hpp"
+#include "oatpp/web/server/HttpWorkerPoolTest.hpp"
+#include "oatpp/web/server/HttpProcessorPipelineTest.hpp"
+#include "oatpp/web/server/HttpRouterPerfTest.hpp"
 #include "oatpp/web/server/ServerStopTest.hpp"
 #include "oatpp/web/mime/multipart/StatefulParserTest.hpp"
 #include "oatpp/web/mime/ContentMappersTest.hpp"
@@ -18,6 +28,8 @@
 #include "oatpp/network/UrlTest.hpp"
 #include "oatpp/network/ConnectionPoolTest.hpp"
 #include "oatpp/network/monitor/ConnectionMonitorTest.hpp"
+#include "oatpp/network/tcp/server/ConnectionProviderTest.hpp"
+#include "oatpp/network/tcp/server/ShardedServerTest.hpp"
 
 #include "oatpp/json/DeserializerTest.hpp"
 #include "oatpp/json/DTOMapperPerfTest.hpp"
@@ -36,6 +48,21 @@
 #include "oatpp/provider/PoolTemplateTest.hpp"
 #include "oatpp/async/ConditionVariableTest.hpp"
 #include "oatpp/async/LockTest.hpp"
+#include "oatpp/async/PriorityPerfTest.hpp"
+#include "oatpp/async/PriorityTest.hpp"
+#include "oatpp/async/TaskPerfTest.hpp"
+#include "oatpp/async/TaskTest.hpp"
+#include "oatpp/async/WaitListTimeoutPerfTest.hpp"
+#include "oatpp/async/WaitListTimeoutTest.hpp"
+#include "oatpp/async/WorkStealingTest.hpp"
+#include "oatpp/async/utils/MPSCQueueTest.hpp"
+#include "oatpp/async/utils/SlabAllocatorTest.hpp"
+#include "oatpp/async/utils/TimerWheelPerfTest.hpp"
+#include "oatpp/async/utils/TimerWheelTest.hpp"
+#include "oatpp/async/worker/BlockingWorkerPerfTest.hpp"
+#include "oatpp/async/worker/BlockingWorkerTest.hpp"
+#include "oatpp/async/worker/IOUringWorkerTest.hpp"
+#include "oatpp/async/worker/LocalRunTest.hpp"
 
 #include "oatpp/data/type/UnorderedMapTest.hpp"
 #include "oatpp/data/type/PairListTest.hpp"
@@ -55,6 +82,7 @@
 #include "oatpp/data/resource/InMemoryDataTest.hpp"
 
 #include "oatpp/data/stream/BufferStreamTest.hpp"
+#include "oatpp/data/stream/WritevTest.hpp"
 
 #include "oatpp/data/mapping/TreeTest.hpp"
 #include "oatpp/data/mapping/ObjectToTreeMapperTest.hpp"
@@ -116,6 +144,7 @@ void runTests() {
 
   OATPP_RUN_TEST(oatpp::data::buffer::ProcessorTest);
   OATPP_RUN_TEST(oatpp::data::stream::BufferStreamTest);
+  OATPP_RUN_TEST(oatpp::data::stream::WritevTest);
 
   OATPP_RUN_TEST(oatpp::data::mapping::TreeTest);
   OATPP_RUN_TEST(oatpp::data::mapping::ObjectToTreeMapperTest);
@@ -145,6 +174,21 @@ void runTests() {
 
   OATPP_RUN_TEST(oatpp::async::ConditionVariableTest);
   OATPP_RUN_TEST(oatpp::async::LockTest);
+  OATPP_RUN_TEST(oatpp::async::PriorityTest);
+  OATPP_RUN_TEST(oatpp::async::PriorityPerfTest);
+  OATPP_RUN_TEST(oatpp::async::TaskTest);
+  OATPP_RUN_TEST(oatpp::async::TaskPerfTest);
+  OATPP_RUN_TEST(oatpp::async::WaitListTimeoutTest);
+  OATPP_RUN_TEST(oatpp::async::WaitListTimeoutPerfTest);
+  OATPP_RUN_TEST(oatpp::async::WorkStealingTest);
+  OATPP_RUN_TEST(oatpp::async::utils::MPSCQueueTest);
+  OATPP_RUN_TEST(oatpp::async::utils::SlabAllocatorTest);
+  OATPP_RUN_TEST(oatpp::async::utils::TimerWheelTest);
+  OATPP_RUN_TEST(oatpp::async::utils::TimerWheelPerfTest);
+  OATPP_RUN_TEST(oatpp::async::worker::BlockingWorkerTest);
+  OATPP_RUN_TEST(oatpp::async::worker::BlockingWorkerPerfTest);
+  OATPP_RUN_TEST(oatpp::async::worker::IOUringWorkerTest);
+  OATPP_RUN_TEST(oatpp::async::worker::LocalRunTest);
 
   OATPP_RUN_TEST(oatpp::utils::parser::CaretTest);
 
@@ -169,15 +213,26 @@ void runTests() {
   OATPP_RUN_TEST(oatpp::test::network::UrlTest);
   OATPP_RUN_TEST(oatpp::test::network::ConnectionPoolTest);
   OATPP_RUN_TEST(oatpp::test::network::monitor::ConnectionMonitorTest);
+  OATPP_RUN_TEST(oatpp::test::network::tcp::server::ConnectionProviderTest);
+  OATPP_RUN_TEST(oatpp::test::network::tcp::server::ShardedServerTest);
   OATPP_RUN_TEST(oatpp::test::network::virtual_::PipeTest);
   OATPP_RUN_TEST(oatpp::test::network::virtual_::InterfaceTest);
 
   OATPP_RUN_TEST(oatpp::test::web::protocol::http::encoding::ChunkedTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::HeadersMapTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::HeadersMapPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::incoming::RequestHeadersReaderTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::HeadersBlockTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::utils::HeadersEndScannerTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::utils::HeadersEndScannerPerfTest);
 
   OATPP_RUN_TEST(oatpp::test::web::mime::multipart::StatefulParserTest);
   OATPP_RUN_TEST(oatpp::web::mime::ContentMappersTest);
 
   OATPP_RUN_TEST(oatpp::test::web::server::HttpRouterTest);
+  OATPP_RUN_TEST(oatpp::test::web::server::HttpProcessorPipelineTest);
+  OATPP_RUN_TEST(oatpp::test::web::server::HttpRouterPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::server::HttpWorkerPoolTest);
   OATPP_RUN_TEST(oatpp::test::web::server::api::ApiControllerTest);
   OATPP_RUN_TEST(oatpp::test::web::server::handler::AuthorizationHandlerTest);
 
@@ -241,6 +296,13 @@ void runTests() {
 
   }
 
+  {
+
+    oatpp::test::web::AsyncAllocationPerfTest test_virtual(1000);
+    test_virtual.run();
+
+  }
+
   {
 
     oatpp::test::web::ClientRetryTest test_virtual(0);
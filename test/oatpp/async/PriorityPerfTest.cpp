@@ -0,0 +1,131 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "PriorityPerfTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include <thread>
+
+namespace oatpp { namespace async {
+
+namespace {
+
+static constexpr v_int32 BACKGROUND_TASKS = 1000;
+static constexpr v_int32 PROBES = 1000;
+
+class BackgroundCoroutine : public oatpp::async::Coroutine<BackgroundCoroutine> {
+private:
+  std::atomic<bool>* m_stop;
+  volatile v_int64 m_value;
+public:
+
+  BackgroundCoroutine(std::atomic<bool>* stop)
+    : m_stop(stop)
+    , m_value(0)
+  {}
+
+  Action act() override {
+    if(*m_stop) {
+      return finish();
+    }
+    for(v_int32 i = 0; i < 100; i ++) {
+      m_value = m_value + i;
+    }
+    return repeat();
+  }
+
+};
+
+class ProbeCoroutine : public oatpp::async::Coroutine<ProbeCoroutine> {
+public:
+
+  Action act() override {
+    return finish();
+  }
+
+};
+
+Processor::QueueLatencyStats runProbes(Priority backgroundPriority, Priority probePriority) {
+
+  oatpp::async::Executor executor(1, 1, 1);
+  std::atomic<bool> stop(false);
+
+  for(v_int32 i = 0; i < BACKGROUND_TASKS; i ++) {
+    executor.execute<BackgroundCoroutine>(backgroundPriority, &stop);
+  }
+
+  // let background tasks get their first dispatch so that probes' stats are not mixed with it
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  auto before = executor.getQueueLatencyStats()[static_cast<size_t>(probePriority)];
+
+  for(v_int32 i = 0; i < PROBES; i ++) {
+    executor.execute<ProbeCoroutine>(probePriority);
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  while(executor.getTasksCount() > BACKGROUND_TASKS) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  auto after = executor.getQueueLatencyStats()[static_cast<size_t>(probePriority)];
+
+  stop = true;
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  return {after.count - before.count, after.totalMicroseconds - before.totalMicroseconds, after.maxMicroseconds};
+
+}
+
+}
+
+void PriorityPerfTest::onRun() {
+
+  {
+    Processor::QueueLatencyStats stats;
+    {
+      oatpp::test::PerformanceChecker checker("NORMAL probes among 1000 busy NORMAL coroutines");
+      stats = runProbes(Priority::NORMAL, Priority::NORMAL);
+    }
+    OATPP_LOGd(TAG, "probes queueing latency: count={}, avg={}us, max={}us",
+               stats.count, stats.totalMicroseconds / (stats.count > 0 ? stats.count : 1), stats.maxMicroseconds)
+  }
+
+  {
+    Processor::QueueLatencyStats stats;
+    {
+      oatpp::test::PerformanceChecker checker("HIGH probes among 1000 busy LOW coroutines");
+      stats = runProbes(Priority::LOW, Priority::HIGH);
+    }
+    OATPP_LOGd(TAG, "probes queueing latency: count={}, avg={}us, max={}us",
+               stats.count, stats.totalMicroseconds / (stats.count > 0 ? stats.count : 1), stats.maxMicroseconds)
+  }
+
+}
+
+}}
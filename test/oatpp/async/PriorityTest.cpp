@@ -0,0 +1,275 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "PriorityTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+
+#include <functional>
+#include <thread>
+
+namespace oatpp { namespace async {
+
+namespace {
+
+static constexpr v_int32 STRICT_TASKS = 20;
+static constexpr v_int32 STRICT_STEPS = 3;
+
+static constexpr v_int32 FAIR_TASKS = 10;
+static constexpr v_int32 FAIR_STEPS = 1000;
+static constexpr v_int32 FAIR_WINDOW = 2100;
+
+/*
+ * Blocks processor thread till released - so that all test tasks are queued before any of them runs.
+ */
+class GateCoroutine : public oatpp::async::Coroutine<GateCoroutine> {
+private:
+  std::atomic<bool>* m_started;
+  std::atomic<bool>* m_released;
+public:
+
+  GateCoroutine(std::atomic<bool>* started, std::atomic<bool>* released)
+    : m_started(started)
+    , m_released(released)
+  {}
+
+  Action act() override {
+    *m_started = true;
+    while(!*m_released) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return finish();
+  }
+
+};
+
+/*
+ * Records priority class of each step. Journal is written by the processor thread only.
+ */
+class StepCoroutine : public oatpp::async::Coroutine<StepCoroutine> {
+private:
+  v_int32 m_steps;
+  std::vector<v_int32>* m_journal;
+public:
+
+  StepCoroutine(v_int32 steps, std::vector<v_int32>* journal)
+    : m_steps(steps)
+    , m_journal(journal)
+  {}
+
+  Action act() override {
+    m_journal->push_back(static_cast<v_int32>(Processor::getCurrentPriority()));
+    if(-- m_steps > 0) {
+      return repeat();
+    }
+    return finish();
+  }
+
+};
+
+class ProbeCoroutine : public oatpp::async::Coroutine<ProbeCoroutine> {
+private:
+  std::atomic<v_int32>* m_result;
+public:
+
+  ProbeCoroutine(std::atomic<v_int32>* result)
+    : m_result(result)
+  {}
+
+  Action act() override {
+    *m_result = static_cast<v_int32>(Processor::getCurrentPriority());
+    return finish();
+  }
+
+};
+
+class ParentCoroutine : public oatpp::async::Coroutine<ParentCoroutine> {
+private:
+  Executor* m_executor;
+  std::atomic<v_int32>* m_nested;
+  std::atomic<v_int32>* m_spawned;
+public:
+
+  ParentCoroutine(Executor* executor, std::atomic<v_int32>* nested, std::atomic<v_int32>* spawned)
+    : m_executor(executor)
+    , m_nested(nested)
+    , m_spawned(spawned)
+  {}
+
+  Action act() override {
+    return ProbeCoroutine::start(m_nested).next(yieldTo(&ParentCoroutine::spawn));
+  }
+
+  Action spawn() {
+    m_executor->execute<ProbeCoroutine>(m_spawned);
+    return finish();
+  }
+
+};
+
+void runGated(Executor& executor, const std::function<void()>& submit) {
+
+  std::atomic<bool> started(false);
+  std::atomic<bool> released(false);
+
+  executor.execute<GateCoroutine>(&started, &released);
+  while(!started) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  submit();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  released = true;
+
+  executor.waitTasksFinished();
+
+}
+
+void testStrictPriority(const char* tag) {
+
+  Processor::Scheduling scheduling;
+  scheduling.policy = Processor::SCHEDULING_STRICT_PRIORITY;
+
+  oatpp::async::Executor executor(1, 1, 1, Executor::VALUE_SUGGESTED, worker::Worker::LocalRunBudget(), scheduling);
+  std::vector<v_int32> journal;
+
+  runGated(executor, [&executor, &journal]{
+    // submit least urgent first
+    for(v_int32 p = Processor::PRIORITY_CLASSES - 1; p >= 0; p --) {
+      for(v_int32 i = 0; i < STRICT_TASKS; i ++) {
+        executor.execute<StepCoroutine>(static_cast<Priority>(p), STRICT_STEPS, &journal);
+      }
+    }
+  });
+
+  OATPP_ASSERT(journal.size() == static_cast<size_t>(Processor::PRIORITY_CLASSES * STRICT_TASKS * STRICT_STEPS))
+  for(size_t i = 0; i < journal.size(); i ++) {
+    OATPP_ASSERT(journal[i] == static_cast<v_int32>(i / (STRICT_TASKS * STRICT_STEPS)))
+  }
+
+  auto stats = executor.getQueueLatencyStats();
+  OATPP_ASSERT(stats.size() == static_cast<size_t>(Processor::PRIORITY_CLASSES))
+  for(auto& s : stats) {
+    OATPP_LOGd(tag, "count={}, avg={}us, max={}us", s.count, s.totalMicroseconds / (s.count > 0 ? s.count : 1), s.maxMicroseconds)
+    OATPP_ASSERT(s.count >= static_cast<v_uint64>(STRICT_TASKS))
+  }
+
+  // low class was submitted earlier and dispatched later
+  OATPP_ASSERT(stats[static_cast<size_t>(Priority::LOW)].maxMicroseconds >= stats[static_cast<size_t>(Priority::HIGH)].maxMicroseconds)
+
+  executor.stop();
+  executor.join();
+
+}
+
+void testWeightedFair(const char* tag) {
+
+  Processor::Scheduling scheduling;
+  oatpp::async::Executor executor(1, 1, 1, Executor::VALUE_SUGGESTED, worker::Worker::LocalRunBudget(), scheduling);
+  std::vector<v_int32> journal;
+
+  runGated(executor, [&executor, &journal]{
+    for(v_int32 p = Processor::PRIORITY_CLASSES - 1; p >= 0; p --) {
+      for(v_int32 i = 0; i < FAIR_TASKS; i ++) {
+        executor.execute<StepCoroutine>(static_cast<Priority>(p), FAIR_STEPS, &journal);
+      }
+    }
+  });
+
+  OATPP_ASSERT(journal.size() == static_cast<size_t>(Processor::PRIORITY_CLASSES * FAIR_TASKS * FAIR_STEPS))
+
+  // all classes are backlogged during the window - steps are shared proportionally to weights
+  v_uint64 totalWeight = 0;
+  for(v_int32 p = 0; p < Processor::PRIORITY_CLASSES; p ++) {
+    totalWeight += scheduling.weights[p];
+  }
+
+  for(v_int32 p = 0; p < Processor::PRIORITY_CLASSES; p ++) {
+    v_int64 count = 0;
+    for(v_int32 i = 0; i < FAIR_WINDOW; i ++) {
+      if(journal[static_cast<size_t>(i)] == p) {
+        count ++;
+      }
+    }
+    auto expected = static_cast<v_int64>(FAIR_WINDOW * scheduling.weights[p] / totalWeight);
+    OATPP_LOGd(tag, "class {}: {} steps of {}, expected {}", p, count, FAIR_WINDOW, expected)
+    OATPP_ASSERT(count > 0)
+    OATPP_ASSERT(count >= expected - expected / 10 - 2 && count <= expected + expected / 10 + 2)
+  }
+
+  executor.stop();
+  executor.join();
+
+}
+
+void testInheritance() {
+
+  oatpp::async::Executor executor(2, 1, 1);
+
+  std::atomic<v_int32> nested(-1);
+  std::atomic<v_int32> spawned(-1);
+  std::atomic<v_int32> external(-1);
+
+  executor.execute<ParentCoroutine>(Priority::LOW, &executor, &nested, &spawned);
+  executor.execute<ProbeCoroutine>(&external);
+  executor.waitTasksFinished();
+
+  OATPP_ASSERT(nested == static_cast<v_int32>(Priority::LOW))
+  OATPP_ASSERT(spawned == static_cast<v_int32>(Priority::LOW))
+  OATPP_ASSERT(external == static_cast<v_int32>(Priority::NORMAL))
+
+  bool thrown = false;
+  try {
+    executor.execute<ProbeCoroutine>(static_cast<Priority>(Processor::PRIORITY_CLASSES), &external);
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  OATPP_ASSERT(thrown)
+  OATPP_ASSERT(executor.getTasksCount() == 0)
+
+  executor.stop();
+  executor.join();
+
+}
+
+}
+
+void PriorityTest::onRun() {
+
+  OATPP_LOGd(TAG, "Test strict priority...")
+  testStrictPriority(TAG);
+  OATPP_LOGd(TAG, "OK")
+
+  OATPP_LOGd(TAG, "Test weighted-fair...")
+  testWeightedFair(TAG);
+  OATPP_LOGd(TAG, "OK")
+
+  OATPP_LOGd(TAG, "Test priority inheritance...")
+  testInheritance();
+  OATPP_LOGd(TAG, "OK")
+
+}
+
+}}
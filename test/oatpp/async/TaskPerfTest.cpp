@@ -0,0 +1,198 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "TaskPerfTest.hpp"
+
+#include "oatpp/async/Task.hpp"
+#include "oatpp/async/Executor.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include <thread>
+
+namespace oatpp { namespace async {
+
+#ifdef OATPP_ASYNC_TASK
+
+namespace {
+
+static constexpr v_int32 COROUTINES = 100;
+static constexpr v_int32 SWITCHES = 10000;
+
+std::atomic<v_int64> CHECKSUM(0);
+std::atomic<v_int32> FINISHED(0);
+
+class YieldCoroutine : public oatpp::async::Coroutine<YieldCoroutine> {
+private:
+  v_int32 m_counter = 0;
+public:
+
+  Action act() override {
+    if(m_counter < SWITCHES) {
+      m_counter ++;
+      return yieldTo(&YieldCoroutine::act);
+    }
+    CHECKSUM += m_counter;
+    ++ FINISHED;
+    return finish();
+  }
+
+};
+
+class AddCoroutine : public oatpp::async::CoroutineWithResult<AddCoroutine, const v_int32&> {
+private:
+  v_int32 m_a;
+  v_int32 m_b;
+public:
+
+  AddCoroutine(v_int32 a, v_int32 b)
+    : m_a(a)
+    , m_b(b)
+  {}
+
+  Action act() override {
+    return _return(m_a + m_b);
+  }
+
+};
+
+class CallCoroutine : public oatpp::async::Coroutine<CallCoroutine> {
+private:
+  v_int32 m_counter = 0;
+public:
+
+  Action act() override {
+    if(m_counter < SWITCHES) {
+      return AddCoroutine::startForResult(m_counter, 1).callbackTo(&CallCoroutine::onResult);
+    }
+    CHECKSUM += m_counter;
+    ++ FINISHED;
+    return finish();
+  }
+
+  Action onResult(const v_int32& value) {
+    m_counter = value;
+    return yieldTo(&CallCoroutine::act);
+  }
+
+};
+
+Task<> yieldTask() {
+  v_int32 counter = 0;
+  while(counter < SWITCHES) {
+    counter ++;
+    co_await AbstractCoroutine::repeat();
+  }
+  CHECKSUM += counter;
+  ++ FINISHED;
+}
+
+Task<> callTask() {
+  v_int32 counter = 0;
+  while(counter < SWITCHES) {
+    counter = co_await AddCoroutine::startForResult(counter, 1);
+  }
+  CHECKSUM += counter;
+  ++ FINISHED;
+}
+
+Task<v_int32> addTask(v_int32 a, v_int32 b) {
+  co_return a + b;
+}
+
+Task<> callNestedTask() {
+  v_int32 counter = 0;
+  while(counter < SWITCHES) {
+    counter = co_await addTask(counter, 1);
+  }
+  CHECKSUM += counter;
+  ++ FINISHED;
+}
+
+template<class F>
+void runBenchmark(const char* tag, const char* name, F&& submit) {
+
+  oatpp::async::Executor executor(1, 1, 1);
+  CHECKSUM = 0;
+  FINISHED = 0;
+
+  v_int64 ticks;
+  {
+    oatpp::test::PerformanceChecker checker(name);
+    for(v_int32 i = 0; i < COROUTINES; i ++) {
+      submit(executor);
+    }
+    // waitTasksFinished() polls too rarely for this benchmark
+    while(FINISHED < COROUTINES) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ticks = checker.getElapsedTicks();
+  }
+
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  OATPP_ASSERT(CHECKSUM == static_cast<v_int64>(COROUTINES) * SWITCHES)
+
+  v_int64 switches = static_cast<v_int64>(COROUTINES) * SWITCHES;
+  OATPP_LOGi(tag, "{}: {} switches, {}(micro), {}(nano) per switch", name, switches, ticks, ticks * 1000 / switches)
+
+}
+
+}
+
+#endif
+
+void TaskPerfTest::onRun() {
+
+#ifdef OATPP_ASYNC_TASK
+
+  runBenchmark(TAG, "Coroutine yieldTo", [](Executor& executor) {
+    executor.execute<YieldCoroutine>();
+  });
+
+  runBenchmark(TAG, "Task co_await repeat", [](Executor& executor) {
+    executor.execute<TaskCoroutine<>>([]{ return yieldTask(); });
+  });
+
+  runBenchmark(TAG, "Coroutine calls CoroutineWithResult", [](Executor& executor) {
+    executor.execute<CallCoroutine>();
+  });
+
+  runBenchmark(TAG, "Task co_await CoroutineWithResult", [](Executor& executor) {
+    executor.execute<TaskCoroutine<>>([]{ return callTask(); });
+  });
+
+  runBenchmark(TAG, "Task co_await nested Task", [](Executor& executor) {
+    executor.execute<TaskCoroutine<>>([]{ return callNestedTask(); });
+  });
+
+#else
+  OATPP_LOGi(TAG, "C++20 coroutines are not available in this build - skipped.")
+#endif
+
+}
+
+}}
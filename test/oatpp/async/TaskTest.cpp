@@ -0,0 +1,301 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "TaskTest.hpp"
+
+#include "oatpp/async/Task.hpp"
+#include "oatpp/async/Executor.hpp"
+
+#include <thread>
+
+#if defined(OATPP_ASYNC_TASK) && !defined(WIN32) && !defined(_WIN32)
+  #include <fcntl.h>
+  #include <unistd.h>
+  #define OATPP_TEST_TASK_PIPE
+#endif
+
+namespace oatpp { namespace async {
+
+#ifdef OATPP_ASYNC_TASK
+
+namespace {
+
+class CountCoroutine : public oatpp::async::Coroutine<CountCoroutine> {
+private:
+  std::atomic<v_int32>* m_counter;
+  v_int32 m_steps;
+public:
+
+  CountCoroutine(std::atomic<v_int32>* counter, v_int32 steps)
+    : m_counter(counter)
+    , m_steps(steps)
+  {}
+
+  Action act() override {
+    if(m_steps -- > 0) {
+      return yieldTo(&CountCoroutine::act);
+    }
+    ++ (*m_counter);
+    return finish();
+  }
+
+};
+
+class AddCoroutine : public oatpp::async::CoroutineWithResult<AddCoroutine, const v_int32&> {
+private:
+  v_int32 m_a;
+  v_int32 m_b;
+public:
+
+  AddCoroutine(v_int32 a, v_int32 b)
+    : m_a(a)
+    , m_b(b)
+  {}
+
+  Action act() override {
+    return _return(m_a + m_b);
+  }
+
+};
+
+class FailingCoroutine : public oatpp::async::Coroutine<FailingCoroutine> {
+public:
+
+  Action act() override {
+    return error<oatpp::async::Error>("child failed");
+  }
+
+};
+
+Task<v_int32> add(v_int32 a, v_int32 b) {
+  v_int32 result = co_await AddCoroutine::startForResult(a, b);
+  co_return result;
+}
+
+Task<v_int32> sum(v_int32 n) {
+  v_int32 result = 0;
+  for(v_int32 i = 1; i <= n; i ++) {
+    result = co_await add(result, i);
+  }
+  co_return result;
+}
+
+Task<> countTask(std::atomic<v_int32>* counter) {
+  co_await CountCoroutine::start(counter, 10);
+  co_await CountCoroutine::start(counter, 0);
+}
+
+Task<> sumTask(v_int32 n, std::atomic<v_int32>* result) {
+  *result = co_await sum(n);
+}
+
+Task<> childErrorTask(std::atomic<v_int32>* result) {
+  try {
+    co_await FailingCoroutine::start();
+    *result = -1;
+  } catch (const std::runtime_error& e) {
+    *result = e.what() == std::string("child failed") ? 1 : -2;
+  }
+}
+
+Task<v_int32> throwingTask() {
+  throw std::runtime_error("task failed");
+  co_return 0;
+}
+
+Task<> sleepTask(std::atomic<v_int64>* elapsed) {
+  auto start = std::chrono::steady_clock::now();
+  co_await AbstractCoroutine::waitRepeat(std::chrono::milliseconds(20));
+  *elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+#ifdef OATPP_TEST_TASK_PIPE
+
+Task<> readPipeTask(v_io_handle fd, std::atomic<v_int32>* result) {
+  char ch = 0;
+  while(true) {
+    auto res = ::read(fd, &ch, 1);
+    if(res == 1) {
+      break;
+    }
+    co_await AbstractCoroutine::ioWait(fd, Action::IOEventType::IO_EVENT_READ);
+  }
+  *result = ch;
+}
+
+#endif
+
+/*
+ * Classic coroutine awaiting task for result.
+ */
+class AwaitTaskCoroutine : public oatpp::async::Coroutine<AwaitTaskCoroutine> {
+private:
+  std::atomic<v_int32>* m_result;
+public:
+
+  AwaitTaskCoroutine(std::atomic<v_int32>* result)
+    : m_result(result)
+  {}
+
+  Action act() override {
+    return sum(10).startForResult().callbackTo(&AwaitTaskCoroutine::onResult);
+  }
+
+  Action onResult(const v_int32& value) {
+    *m_result = value;
+    return finish();
+  }
+
+};
+
+/*
+ * Classic coroutine receiving unhandled exception of the task.
+ */
+class AwaitThrowingTaskCoroutine : public oatpp::async::Coroutine<AwaitThrowingTaskCoroutine> {
+private:
+  std::atomic<v_int32>* m_result;
+public:
+
+  AwaitThrowingTaskCoroutine(std::atomic<v_int32>* result)
+    : m_result(result)
+  {}
+
+  Action act() override {
+    return throwingTask().startForResult().callbackTo(&AwaitThrowingTaskCoroutine::onResult);
+  }
+
+  Action onResult(const v_int32& value) {
+    (void)value;
+    *m_result = -1;
+    return finish();
+  }
+
+  Action handleError(Error* error) override {
+    *m_result = -2;
+    try {
+      std::rethrow_exception(error->getExceptionPtr());
+    } catch (const std::runtime_error& e) {
+      if(e.what() == std::string("task failed")) {
+        *m_result = 1;
+      }
+    }
+    return finish();
+  }
+
+};
+
+}
+
+#endif
+
+void TaskTest::onRun() {
+
+#ifdef OATPP_ASYNC_TASK
+
+  oatpp::async::Executor executor(1, 1, 1);
+
+  {
+    OATPP_LOGi(TAG, "co_await CoroutineStarter...")
+    std::atomic<v_int32> counter(0);
+    executor.execute<TaskCoroutine<>>([&counter]{ return countTask(&counter); });
+    executor.waitTasksFinished();
+    OATPP_ASSERT(counter == 2)
+    OATPP_LOGi(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGi(TAG, "co_await CoroutineStarterForResult and nested tasks...")
+    auto before = utils::SlabAllocator::getStats();
+    std::atomic<v_int32> result(0);
+    executor.execute<TaskCoroutine<>>([&result]{ return sumTask(100, &result); });
+    executor.waitTasksFinished();
+    OATPP_ASSERT(result == 5050)
+    auto after = utils::SlabAllocator::getStats();
+    // 100 frames of add() and 100 AddCoroutines - all allocated on processor thread
+    OATPP_ASSERT(after.poolAllocations - before.poolAllocations >= 200)
+    OATPP_LOGi(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGi(TAG, "Classic coroutine awaits task...")
+    std::atomic<v_int32> result(0);
+    executor.execute<AwaitTaskCoroutine>(&result);
+    executor.waitTasksFinished();
+    OATPP_ASSERT(result == 55)
+    OATPP_LOGi(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGi(TAG, "Errors...")
+    std::atomic<v_int32> childResult(0);
+    std::atomic<v_int32> taskResult(0);
+    executor.execute<TaskCoroutine<>>([&childResult]{ return childErrorTask(&childResult); });
+    executor.execute<AwaitThrowingTaskCoroutine>(&taskResult);
+    executor.waitTasksFinished();
+    OATPP_ASSERT(childResult == 1)
+    OATPP_ASSERT(taskResult == 1)
+    OATPP_LOGi(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGi(TAG, "co_await wait action...")
+    std::atomic<v_int64> elapsed(0);
+    executor.execute<TaskCoroutine<>>([&elapsed]{ return sleepTask(&elapsed); });
+    executor.waitTasksFinished();
+    OATPP_LOGi(TAG, "elapsed={}(micro)", elapsed.load())
+    OATPP_ASSERT(elapsed >= 20 * 1000)
+    OATPP_LOGi(TAG, "OK")
+  }
+
+#ifdef OATPP_TEST_TASK_PIPE
+  {
+    OATPP_LOGi(TAG, "co_await I/O readiness...")
+    int fds[2];
+    OATPP_ASSERT(::pipe(fds) == 0)
+    OATPP_ASSERT(::fcntl(fds[0], F_SETFL, ::fcntl(fds[0], F_GETFL) | O_NONBLOCK) == 0)
+    std::atomic<v_int32> result(0);
+    v_io_handle readFd = fds[0];
+    executor.execute<TaskCoroutine<>>([readFd, &result]{ return readPipeTask(readFd, &result); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    OATPP_ASSERT(result == 0)
+    char ch = 'x';
+    OATPP_ASSERT(::write(fds[1], &ch, 1) == 1)
+    executor.waitTasksFinished();
+    OATPP_ASSERT(result == 'x')
+    ::close(fds[0]);
+    ::close(fds[1]);
+    OATPP_LOGi(TAG, "OK")
+  }
+#endif
+
+  executor.stop();
+  executor.join();
+
+#else
+  OATPP_LOGi(TAG, "C++20 coroutines are not available in this build - skipped.")
+#endif
+
+}
+
+}}
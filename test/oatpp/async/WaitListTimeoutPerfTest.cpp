@@ -0,0 +1,159 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "WaitListTimeoutPerfTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+#include "oatpp/async/ConditionVariable.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace async {
+
+namespace {
+
+static constexpr v_int32 TIMED_WAITERS = 100;
+static constexpr v_int32 TIMED_WAITS = 20;
+
+static constexpr v_int32 NOTIFIED_WAITERS = 100;
+static constexpr v_int32 NOTIFIED_WAITS = 100;
+
+class TimedWaitCoroutine : public oatpp::async::Coroutine<TimedWaitCoroutine> {
+private:
+  oatpp::async::LockGuard m_lockGuard;
+  oatpp::async::ConditionVariable* m_cv;
+  v_int32 m_waits;
+public:
+
+  TimedWaitCoroutine(oatpp::async::Lock* lock, oatpp::async::ConditionVariable* cv)
+    : m_lockGuard(lock)
+    , m_cv(cv)
+    , m_waits(0)
+  {}
+
+  Action act() override {
+    if(m_waits == TIMED_WAITS) {
+      return finish();
+    }
+    m_waits ++;
+    return m_cv->waitFor(m_lockGuard, []() noexcept {return false;}, std::chrono::milliseconds(1))
+      .next(yieldTo(&TimedWaitCoroutine::act));
+  }
+
+};
+
+struct Counter {
+  oatpp::async::Lock lock;
+  oatpp::async::ConditionVariable cv;
+  v_int64 value = 0;
+};
+
+class NotifiedWaitCoroutine : public oatpp::async::Coroutine<NotifiedWaitCoroutine> {
+private:
+  Counter* m_counter;
+  v_int64 m_seen;
+  v_int32 m_waits;
+  oatpp::async::LockGuard m_lockGuard;
+public:
+
+  NotifiedWaitCoroutine(Counter* counter)
+    : m_counter(counter)
+    , m_seen(0)
+    , m_waits(0)
+    , m_lockGuard(&counter->lock)
+  {}
+
+  Action act() override {
+    if(m_waits == NOTIFIED_WAITS) {
+      return finish();
+    }
+    return m_counter->cv.waitFor(m_lockGuard, [this]() noexcept {return m_counter->value != m_seen;}, std::chrono::seconds(10))
+      .next(yieldTo(&NotifiedWaitCoroutine::onNotified));
+  }
+
+  Action onNotified() {
+    OATPP_ASSERT(m_lockGuard.owns_lock())
+    m_seen = m_counter->value;
+    m_waits ++;
+    m_lockGuard.unlock();
+    return yieldTo(&NotifiedWaitCoroutine::act);
+  }
+
+};
+
+}
+
+void WaitListTimeoutPerfTest::onRun() {
+
+  {
+    oatpp::async::Executor executor(2, 1, 1);
+    oatpp::async::Lock lock;
+    oatpp::async::ConditionVariable cv;
+
+    v_int64 ticks;
+    {
+      oatpp::test::PerformanceChecker checker("CV waitFor(1ms) timing out: 100 coroutines x 20 waits");
+      for(v_int32 i = 0; i < TIMED_WAITERS; i ++) {
+        executor.execute<TimedWaitCoroutine>(&lock, &cv);
+      }
+      while(executor.getTasksCount() != 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      ticks = checker.getElapsedTicks();
+    }
+    OATPP_LOGd(TAG, "timed out waits per second: {}", static_cast<v_int64>(TIMED_WAITERS) * TIMED_WAITS * 1000000 / (ticks > 0 ? ticks : 1))
+
+    executor.stop();
+    executor.join();
+  }
+
+  {
+    oatpp::async::Executor executor(2, 1, 1);
+    Counter counter;
+
+    v_int64 ticks;
+    {
+      oatpp::test::PerformanceChecker checker("CV waitFor(10s) notified: 100 coroutines x 100 waits");
+      for(v_int32 i = 0; i < NOTIFIED_WAITERS; i ++) {
+        executor.execute<NotifiedWaitCoroutine>(&counter);
+      }
+      while(executor.getTasksCount() != 0) {
+        {
+          std::lock_guard<oatpp::async::Lock> guard(counter.lock);
+          counter.value ++;
+        }
+        counter.cv.notifyAll();
+        std::this_thread::yield();
+      }
+      ticks = checker.getElapsedTicks();
+    }
+    OATPP_LOGd(TAG, "notified waits per second: {}", static_cast<v_int64>(NOTIFIED_WAITERS) * NOTIFIED_WAITS * 1000000 / (ticks > 0 ? ticks : 1))
+
+    executor.stop();
+    executor.join();
+  }
+
+}
+
+}}
@@ -0,0 +1,179 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "WaitListTimeoutTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+#include "oatpp/async/ConditionVariable.hpp"
+
+#include <limits>
+
+namespace oatpp { namespace async {
+
+namespace {
+
+/*
+ * Wait-list timeouts used to be checked every 100ms.
+ */
+static constexpr v_int64 MAX_LATENESS_MICROSECONDS = 30 * 1000;
+
+v_int64 getSteadyMicroseconds() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct Stats {
+  std::atomic<v_int64> minLateness{std::numeric_limits<v_int64>::max()};
+  std::atomic<v_int64> maxLateness{0};
+  std::atomic<v_int32> finished{0};
+};
+
+class TimedWaitCoroutine : public oatpp::async::Coroutine<TimedWaitCoroutine> {
+private:
+  oatpp::async::LockGuard m_lockGuard;
+  oatpp::async::ConditionVariable* m_cv;
+  v_int64 m_timeout;
+  Stats* m_stats;
+  v_int64 m_startTime;
+public:
+
+  TimedWaitCoroutine(oatpp::async::Lock* lock, oatpp::async::ConditionVariable* cv, v_int64 timeout, Stats* stats)
+    : m_lockGuard(lock)
+    , m_cv(cv)
+    , m_timeout(timeout)
+    , m_stats(stats)
+    , m_startTime(0)
+  {}
+
+  Action act() override {
+    m_startTime = getSteadyMicroseconds();
+    return m_cv->waitFor(m_lockGuard, []() noexcept {return false;}, std::chrono::microseconds(m_timeout))
+      .next(yieldTo(&TimedWaitCoroutine::onTimeout));
+  }
+
+  Action onTimeout() {
+
+    v_int64 lateness = getSteadyMicroseconds() - m_startTime - m_timeout;
+
+    v_int64 value = m_stats->minLateness;
+    while(lateness < value && !m_stats->minLateness.compare_exchange_weak(value, lateness)) {}
+    value = m_stats->maxLateness;
+    while(lateness > value && !m_stats->maxLateness.compare_exchange_weak(value, lateness)) {}
+
+    ++ m_stats->finished;
+    return finish();
+
+  }
+
+};
+
+class NotifiedWaitCoroutine : public oatpp::async::Coroutine<NotifiedWaitCoroutine> {
+private:
+  oatpp::async::LockGuard m_lockGuard;
+  oatpp::async::ConditionVariable* m_cv;
+  std::atomic<bool>* m_flag;
+public:
+
+  NotifiedWaitCoroutine(oatpp::async::Lock* lock, oatpp::async::ConditionVariable* cv, std::atomic<bool>* flag)
+    : m_lockGuard(lock)
+    , m_cv(cv)
+    , m_flag(flag)
+  {}
+
+  Action act() override {
+    return m_cv->waitFor(m_lockGuard, [this]() noexcept {return m_flag->load();}, std::chrono::seconds(10))
+      .next(yieldTo(&NotifiedWaitCoroutine::onReady));
+  }
+
+  Action onReady() {
+    OATPP_ASSERT(m_lockGuard.owns_lock())
+    return finish();
+  }
+
+};
+
+}
+
+void WaitListTimeoutTest::onRun() {
+
+  {
+    OATPP_LOGd(TAG, "Timeout precision...")
+
+    oatpp::async::Executor executor(2, 1, 1);
+    oatpp::async::Lock lock;
+    oatpp::async::ConditionVariable cv;
+    Stats stats;
+
+    v_int32 count = 0;
+    for(v_int64 timeout = 5000; timeout <= 80000; timeout *= 2) {
+      for(v_int32 i = 0; i < 10; i ++) {
+        executor.execute<TimedWaitCoroutine>(&lock, &cv, timeout, &stats);
+        count ++;
+      }
+    }
+
+    executor.waitTasksFinished();
+    OATPP_ASSERT(stats.finished == count)
+
+    OATPP_LOGd(TAG, "lateness: min={}us, max={}us", stats.minLateness.load(), stats.maxLateness.load())
+    OATPP_ASSERT(stats.minLateness >= 0)
+    OATPP_ASSERT(stats.maxLateness < MAX_LATENESS_MICROSECONDS)
+
+    executor.stop();
+    executor.join();
+    OATPP_LOGd(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGd(TAG, "Notify before timeout...")
+
+    oatpp::async::Executor executor(2, 1, 1);
+    oatpp::async::Lock lock;
+    oatpp::async::ConditionVariable cv;
+    std::atomic<bool> flag(false);
+
+    for(v_int32 i = 0; i < 100; i ++) {
+      executor.execute<NotifiedWaitCoroutine>(&lock, &cv, &flag);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    {
+      std::lock_guard<oatpp::async::Lock> guard(lock);
+      flag = true;
+    }
+    cv.notifyAll();
+
+    auto startTime = getSteadyMicroseconds();
+    executor.waitTasksFinished();
+    OATPP_ASSERT(executor.getTasksCount() == 0)
+    // must not wait for the 10s timeout
+    OATPP_ASSERT(getSteadyMicroseconds() - startTime < 5 * 1000 * 1000)
+
+    executor.stop();
+    executor.join();
+    OATPP_LOGd(TAG, "OK")
+  }
+
+}
+
+}}
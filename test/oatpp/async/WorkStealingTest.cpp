@@ -0,0 +1,167 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "WorkStealingTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+#include "oatpp/async/utils/WorkStealingDeque.hpp"
+
+#include <thread>
+#include <list>
+
+namespace oatpp { namespace async {
+
+namespace {
+
+static constexpr v_int32 DEQUE_ENTRIES = 100000;
+static constexpr v_int32 DEQUE_THIEVES = 3;
+
+static constexpr v_int32 HEAVY_TASKS = 40;
+static constexpr v_int32 HEAVY_STEPS = 10000;
+
+struct Entry {
+  std::atomic<v_int32> consumed{0};
+};
+
+class TestCoroutine : public oatpp::async::Coroutine<TestCoroutine> {
+private:
+  v_int32 m_steps;
+  std::atomic<v_int64>* m_counter;
+public:
+
+  TestCoroutine(v_int32 steps, std::atomic<v_int64>* counter)
+    : m_steps(steps)
+    , m_counter(counter)
+  {}
+
+  Action act() override {
+    if(m_steps > 0) {
+      -- m_steps;
+      ++ (*m_counter);
+      return repeat();
+    }
+    return finish();
+  }
+
+};
+
+void testDeque() {
+
+  std::vector<Entry> entries(DEQUE_ENTRIES);
+  utils::WorkStealingDeque<Entry> deque(64);
+  std::atomic<bool> done(false);
+
+  std::list<std::thread> thieves;
+  for(v_int32 i = 0; i < DEQUE_THIEVES; i ++) {
+    thieves.push_back(std::thread([&deque, &done]{
+      while(!done || !deque.empty()) {
+        Entry* entry = deque.steal();
+        if(entry != nullptr) {
+          ++ entry->consumed;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+
+  for(v_int32 i = 0; i < DEQUE_ENTRIES; i ++) {
+    while(!deque.push(&entries[static_cast<size_t>(i)])) {
+      Entry* entry = deque.pop();
+      if(entry != nullptr) {
+        ++ entry->consumed;
+      }
+    }
+    if(i % 3 == 0) {
+      Entry* entry = deque.pop();
+      if(entry != nullptr) {
+        ++ entry->consumed;
+      }
+    }
+  }
+
+  done = true;
+
+  for(auto& thread : thieves) {
+    thread.join();
+  }
+
+  Entry* entry;
+  while((entry = deque.pop()) != nullptr) {
+    ++ entry->consumed;
+  }
+
+  for(auto& e : entries) {
+    OATPP_ASSERT(e.consumed == 1)
+  }
+
+}
+
+}
+
+void WorkStealingTest::onRun() {
+
+  OATPP_LOGd(TAG, "Test deque...")
+  testDeque();
+  OATPP_LOGd(TAG, "OK")
+
+  std::atomic<v_int64> counter(0);
+
+  {
+
+    oatpp::async::Executor executor(2, 1, 1);
+
+    // Executor distributes tasks round-robin - all heavy tasks land on one processor.
+    for(v_int32 i = 0; i < HEAVY_TASKS; i ++) {
+      executor.execute<TestCoroutine>(HEAVY_STEPS, &counter);
+      executor.execute<TestCoroutine>(0, &counter);
+    }
+
+    executor.waitTasksFinished();
+
+    OATPP_ASSERT(executor.getTasksCount() == 0)
+    OATPP_ASSERT(counter == static_cast<v_int64>(HEAVY_TASKS) * HEAVY_STEPS)
+
+    auto stats = executor.getStealStats();
+    OATPP_ASSERT(stats.size() == 2)
+
+    v_uint64 stolenFromPeers = 0;
+    v_uint64 stolenByPeers = 0;
+    for(auto& s : stats) {
+      OATPP_LOGd(TAG, "stolenFromPeers={}, stolenByPeers={}", s.stolenFromPeers, s.stolenByPeers)
+      stolenFromPeers += s.stolenFromPeers;
+      stolenByPeers += s.stolenByPeers;
+    }
+
+    OATPP_ASSERT(stolenFromPeers == stolenByPeers)
+    OATPP_ASSERT(stolenFromPeers > 0)
+
+    executor.stop();
+    executor.join();
+
+  }
+
+}
+
+}}
@@ -0,0 +1,123 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "MPSCQueueTest.hpp"
+
+#include "oatpp/async/utils/MPSCQueue.hpp"
+#include "oatpp/concurrency/Parker.hpp"
+
+#include <thread>
+#include <list>
+#include <vector>
+
+namespace oatpp { namespace async { namespace utils {
+
+namespace {
+
+static constexpr v_int32 PRODUCERS = 4;
+static constexpr v_int32 ENTRIES_PER_PRODUCER = 20000;
+static constexpr v_int32 BATCH_SIZE = 7;
+
+struct Entry {
+  v_int32 producer;
+  v_int32 index;
+  Entry* _ref;
+};
+
+}
+
+void MPSCQueueTest::onRun() {
+
+  std::vector<Entry> entries(static_cast<size_t>(PRODUCERS * ENTRIES_PER_PRODUCER));
+
+  MPSCQueue<Entry> queue;
+  oatpp::concurrency::Parker parker;
+
+  std::list<std::thread> producers;
+  for(v_int32 p = 0; p < PRODUCERS; p ++) {
+    producers.push_back(std::thread([p, &entries, &queue, &parker]{
+
+      FastQueue<Entry> batch;
+
+      for(v_int32 i = 0; i < ENTRIES_PER_PRODUCER; i ++) {
+
+        auto& entry = entries[static_cast<size_t>(p * ENTRIES_PER_PRODUCER + i)];
+        entry.producer = p;
+        entry.index = i;
+
+        if(p % 2 == 0) {
+          queue.push(&entry);
+          parker.unpark();
+        } else {
+          batch.pushBack(&entry);
+          if(batch.count == BATCH_SIZE || i == ENTRIES_PER_PRODUCER - 1) {
+            queue.pushAll(batch);
+            OATPP_ASSERT(batch.first == nullptr && batch.count == 0)
+            parker.unpark();
+          }
+        }
+
+      }
+
+    }));
+  }
+
+  std::vector<v_int32> nextIndex(PRODUCERS, 0);
+  v_int32 received = 0;
+
+  FastQueue<Entry> result;
+  while(received < PRODUCERS * ENTRIES_PER_PRODUCER) {
+
+    if(queue.empty()) {
+      parker.prepare();
+      if(queue.empty()) {
+        parker.park();
+      } else {
+        parker.cancel();
+      }
+    }
+
+    queue.popAll(result);
+    while(result.first != nullptr) {
+      Entry* entry = result.popFront();
+      // order of each producer's entries is preserved
+      OATPP_ASSERT(entry->index == nextIndex[static_cast<size_t>(entry->producer)])
+      nextIndex[static_cast<size_t>(entry->producer)] ++;
+      received ++;
+    }
+
+  }
+
+  for(auto& thread : producers) {
+    thread.join();
+  }
+
+  OATPP_ASSERT(queue.empty())
+  for(auto index : nextIndex) {
+    OATPP_ASSERT(index == ENTRIES_PER_PRODUCER)
+  }
+
+}
+
+}}}
@@ -0,0 +1,211 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "SlabAllocatorTest.hpp"
+
+#include "oatpp/async/utils/SlabAllocator.hpp"
+#include "oatpp/async/Executor.hpp"
+
+#include <cstring>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace oatpp { namespace async { namespace utils {
+
+namespace {
+
+/*
+ * Blocks of 48 bytes + header fill whole slabs - no spare blocks are left in the owner's free list.
+ */
+static constexpr std::size_t BLOCK_SIZE = 48;
+static constexpr v_int32 BLOCKS_COUNT = static_cast<v_int32>(8 * SlabAllocator::SLAB_SIZE / (static_cast<v_buff_size>(BLOCK_SIZE) + SlabAllocator::SIZE_CLASS_STEP));
+static constexpr v_int32 COROUTINES_COUNT = 1000;
+
+std::atomic<v_int32> COUNTER(0);
+
+class TestCoroutine : public oatpp::async::Coroutine<TestCoroutine> {
+private:
+  v_int32 m_steps;
+public:
+
+  TestCoroutine(v_int32 steps)
+    : m_steps(steps)
+  {}
+
+  Action act() override {
+    if(m_steps -- > 0) {
+      return yieldTo(&TestCoroutine::act);
+    }
+    ++ COUNTER;
+    return finish();
+  }
+
+};
+
+}
+
+void SlabAllocatorTest::onRun() {
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+
+  {
+    OATPP_LOGi(TAG, "No pool bound - heap fallback...")
+    auto before = SlabAllocator::getStats();
+    void* ptr = SlabAllocator::allocate(64);
+    std::memset(ptr, 0xAB, 64);
+    SlabAllocator::deallocate(ptr);
+    auto after = SlabAllocator::getStats();
+    OATPP_ASSERT(after.heapAllocations == before.heapAllocations + 1)
+    OATPP_ASSERT(after.poolAllocations == before.poolAllocations)
+    OATPP_LOGi(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGi(TAG, "Size classes and reuse...")
+
+    auto pool = SlabAllocator::createPool();
+    SlabAllocator::setThreadPool(pool);
+
+    auto before = SlabAllocator::getStats();
+
+    std::vector<void*> blocks;
+    for(v_int32 size = 1; size <= SlabAllocator::MAX_BLOCK_SIZE - SlabAllocator::SIZE_CLASS_STEP; size ++) {
+      void* ptr = SlabAllocator::allocate(static_cast<std::size_t>(size));
+      OATPP_ASSERT(reinterpret_cast<std::uintptr_t>(ptr) % SlabAllocator::SIZE_CLASS_STEP == 0)
+      std::memset(ptr, size & 0xFF, static_cast<size_t>(size));
+      blocks.push_back(ptr);
+    }
+
+    // blocks must not overlap
+    for(size_t i = 0; i < blocks.size(); i ++) {
+      auto size = static_cast<v_int32>(i + 1);
+      auto data = static_cast<v_uint8*>(blocks[i]);
+      for(v_int32 j = 0; j < size; j ++) {
+        OATPP_ASSERT(data[j] == (size & 0xFF))
+      }
+    }
+
+    auto stats = SlabAllocator::getStats();
+    OATPP_ASSERT(stats.poolAllocations == before.poolAllocations + static_cast<v_int64>(blocks.size()))
+    OATPP_ASSERT(stats.heapAllocations == before.heapAllocations)
+
+    for(void* ptr : blocks) {
+      SlabAllocator::deallocate(ptr);
+    }
+
+    // freed block is reused by the next allocation of the same size class
+    void* a = SlabAllocator::allocate(100);
+    SlabAllocator::deallocate(a);
+    void* b = SlabAllocator::allocate(110);
+    OATPP_ASSERT(a == b)
+    SlabAllocator::deallocate(b);
+
+    // too big for pool
+    void* big = SlabAllocator::allocate(static_cast<std::size_t>(SlabAllocator::MAX_BLOCK_SIZE));
+    SlabAllocator::deallocate(big);
+    stats = SlabAllocator::getStats();
+    OATPP_ASSERT(stats.heapAllocations == before.heapAllocations + 1)
+
+    SlabAllocator::setThreadPool(nullptr);
+    SlabAllocator::releasePool(pool);
+
+    OATPP_LOGi(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGi(TAG, "Cross-thread free...")
+
+    auto pool = SlabAllocator::createPool();
+    SlabAllocator::setThreadPool(pool);
+
+    auto before = SlabAllocator::getStats();
+
+    std::vector<void*> blocks;
+    for(v_int32 i = 0; i < BLOCKS_COUNT; i ++) {
+      blocks.push_back(SlabAllocator::allocate(BLOCK_SIZE));
+    }
+
+    std::thread freeThread([&blocks]{
+      for(void* ptr : blocks) {
+        SlabAllocator::deallocate(ptr);
+      }
+    });
+    freeThread.join();
+
+    auto stats = SlabAllocator::getStats();
+    OATPP_ASSERT(stats.remoteFrees == before.remoteFrees + BLOCKS_COUNT)
+
+    // remotely freed blocks come back to the owner
+    std::unordered_set<void*> freed(blocks.begin(), blocks.end());
+    blocks.clear();
+    for(v_int32 i = 0; i < BLOCKS_COUNT; i ++) {
+      void* ptr = SlabAllocator::allocate(BLOCK_SIZE);
+      OATPP_ASSERT(freed.find(ptr) != freed.end())
+      blocks.push_back(ptr);
+    }
+
+    // pool released by owner stays alive till the last block is freed
+    SlabAllocator::setThreadPool(nullptr);
+    SlabAllocator::releasePool(pool);
+
+    std::thread lateFreeThread([&blocks]{
+      for(void* ptr : blocks) {
+        SlabAllocator::deallocate(ptr);
+      }
+    });
+    lateFreeThread.join();
+
+    OATPP_LOGi(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGi(TAG, "Executor coroutines...")
+
+    COUNTER = 0;
+    auto before = SlabAllocator::getStats();
+
+    {
+      oatpp::async::Executor executor(2, 1, 1);
+      for(v_int32 i = 0; i < COROUTINES_COUNT; i ++) {
+        executor.execute<TestCoroutine>(10);
+      }
+      executor.waitTasksFinished();
+      executor.stop();
+      executor.join();
+    }
+
+    auto after = SlabAllocator::getStats();
+    OATPP_ASSERT(COUNTER == COROUTINES_COUNT)
+    // coroutine + coroutine handle per task
+    OATPP_ASSERT(after.poolAllocations - before.poolAllocations >= 2 * COROUTINES_COUNT)
+
+    OATPP_LOGi(TAG, "OK")
+  }
+
+#endif
+
+}
+
+}}}
@@ -0,0 +1,107 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "TimerWheelPerfTest.hpp"
+
+#include "oatpp/async/utils/TimerWheel.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include <random>
+#include <vector>
+
+namespace oatpp { namespace async { namespace utils {
+
+namespace {
+
+static constexpr v_int64 TIMERS_COUNT = 1000000;
+static constexpr v_int64 MAX_DEADLINE = 100000;
+static constexpr v_int64 LINEAR_SCAN_TICKS = 100;
+
+struct Entry {
+  v_int64 deadline;
+  TimerWheel<Entry>::Timer* timer;
+};
+
+}
+
+void TimerWheelPerfTest::onRun() {
+
+  std::mt19937_64 random(1);
+  std::uniform_int_distribution<v_int64> distribution(1, MAX_DEADLINE);
+
+  std::vector<Entry> entries(static_cast<size_t>(TIMERS_COUNT));
+  for(auto& e : entries) {
+    e.deadline = distribution(random);
+  }
+
+  TimerWheel<Entry> wheel;
+  v_int64 expired = 0;
+  v_int64 canceled = 0;
+
+  {
+    oatpp::test::PerformanceChecker checker("TimerWheel: schedule 1M timers");
+    for(auto& e : entries) {
+      e.timer = wheel.schedule(&e, e.deadline);
+    }
+  }
+
+  {
+    oatpp::test::PerformanceChecker checker("TimerWheel: cancel 100K timers");
+    for(size_t i = 0; i < entries.size(); i += 10) {
+      wheel.cancel(entries[i].timer);
+      canceled ++;
+    }
+  }
+
+  {
+    oatpp::test::PerformanceChecker checker("TimerWheel: expire all timers tick by tick");
+    for(v_int64 tick = 1; tick <= MAX_DEADLINE; tick ++) {
+      wheel.advance(tick, [tick, &expired](Entry* e) {
+        OATPP_ASSERT(e->deadline == tick)
+        expired ++;
+      });
+    }
+  }
+
+  OATPP_ASSERT(wheel.empty())
+  OATPP_ASSERT(expired + canceled == TIMERS_COUNT)
+
+  {
+    // what TimerWorker did before the wheel - every tick scans all waiting timers
+    v_int64 scanned = 0;
+    oatpp::test::PerformanceChecker checker("Linear scan: 100 ticks over 1M timers");
+    for(v_int64 tick = 1; tick <= LINEAR_SCAN_TICKS; tick ++) {
+      for(auto& e : entries) {
+        if(e.deadline <= tick) {
+          scanned ++;
+        }
+      }
+    }
+    OATPP_ASSERT(scanned > 0)
+  }
+
+}
+
+}}}
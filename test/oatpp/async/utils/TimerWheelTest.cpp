@@ -0,0 +1,130 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "TimerWheelTest.hpp"
+
+#include "oatpp/async/utils/TimerWheel.hpp"
+
+#include <random>
+#include <vector>
+
+namespace oatpp { namespace async { namespace utils {
+
+namespace {
+
+struct Entry {
+  v_int64 deadline = 0;
+  v_int64 expiredAt = -1;
+  bool canceled = false;
+  TimerWheel<Entry>::Timer* timer = nullptr;
+};
+
+void testRandomDeadlines(v_int64 startTick, v_int64 maxDelay, v_int64 step) {
+
+  std::mt19937_64 random(static_cast<std::mt19937_64::result_type>(maxDelay));
+  std::uniform_int_distribution<v_int64> distribution(0, maxDelay);
+
+  TimerWheel<Entry> wheel(startTick);
+  std::vector<Entry> entries(5000);
+
+  for(size_t i = 0; i < entries.size(); i ++) {
+    auto& e = entries[i];
+    e.deadline = startTick + 1 + distribution(random);
+    e.timer = wheel.schedule(&e, e.deadline);
+  }
+
+  for(size_t i = 0; i < entries.size(); i += 7) {
+    wheel.cancel(entries[i].timer);
+    entries[i].canceled = true;
+  }
+
+  v_int64 tick = startTick;
+  while(!wheel.empty()) {
+    tick += step;
+    wheel.advance(tick, [tick](Entry* e) {
+      e->expiredAt = tick;
+    });
+    OATPP_ASSERT(wheel.getCurrentTick() == tick)
+  }
+
+  for(auto& e : entries) {
+    if(e.canceled) {
+      OATPP_ASSERT(e.expiredAt == -1)
+    } else {
+      // expires at the first advance that passes the deadline
+      OATPP_ASSERT(e.expiredAt >= e.deadline)
+      OATPP_ASSERT(e.expiredAt - e.deadline < step)
+    }
+  }
+
+}
+
+}
+
+void TimerWheelTest::onRun() {
+
+  OATPP_LOGd(TAG, "Random deadlines...")
+  testRandomDeadlines(0, 100, 1);
+  testRandomDeadlines(12345, 100000, 1);
+  testRandomDeadlines(64 * 64 - 3, 1000000, 17);
+  testRandomDeadlines(0, TimerWheel<Entry>::MAX_SPAN * 3, TimerWheel<Entry>::MAX_SPAN / 1000);
+  OATPP_LOGd(TAG, "OK")
+
+  OATPP_LOGd(TAG, "Due and rescheduled timers...")
+  {
+    TimerWheel<Entry> wheel(100);
+    Entry e;
+
+    // deadline in the past expires on the next tick
+    wheel.schedule(&e, 50);
+    wheel.advance(100, [](Entry*) { OATPP_ASSERT(false) });
+    v_int32 count = 0;
+    wheel.advance(101, [&count](Entry*) { count ++; });
+    OATPP_ASSERT(count == 1)
+
+    // reschedule from the callback
+    count = 0;
+    wheel.schedule(&e, 105);
+    wheel.advance(200, [&wheel, &count](Entry* entry) {
+      count ++;
+      if(count < 10) {
+        wheel.schedule(entry, wheel.getCurrentTick() + 3);
+      }
+    });
+    OATPP_ASSERT(count == 10)
+    OATPP_ASSERT(wheel.empty())
+
+    // clear
+    wheel.schedule(&e, 1000);
+    wheel.schedule(&e, 1000000000);
+    count = 0;
+    wheel.clear([&count](Entry*) { count ++; });
+    OATPP_ASSERT(count == 2)
+    OATPP_ASSERT(wheel.empty())
+  }
+  OATPP_LOGd(TAG, "OK")
+
+}
+
+}}}
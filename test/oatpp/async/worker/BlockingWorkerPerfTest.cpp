@@ -0,0 +1,97 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "BlockingWorkerPerfTest.hpp"
+
+#include "oatpp/async/BlockingCall.hpp"
+#include "oatpp/async/Executor.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace async { namespace worker {
+
+namespace {
+
+constexpr v_int32 CALLERS_COUNT = 100;
+constexpr v_int32 CALLS_COUNT = 100;
+
+class CallerCoroutine : public oatpp::async::Coroutine<CallerCoroutine> {
+private:
+  v_int32 m_calls;
+  v_int64 m_sum;
+public:
+
+  CallerCoroutine()
+    : m_calls(0)
+    , m_sum(0)
+  {}
+
+  Action act() override {
+    if(m_calls == CALLS_COUNT) {
+      OATPP_ASSERT(m_sum == static_cast<v_int64>(CALLS_COUNT) * (CALLS_COUNT - 1) / 2)
+      return finish();
+    }
+    auto value = m_calls;
+    return BlockingCall<v_int32>::startForResult([value]() noexcept {
+      return value;
+    }).callbackTo(&CallerCoroutine::onResult);
+  }
+
+  Action onResult(const v_int32& result) {
+    m_sum += result;
+    m_calls ++;
+    return yieldTo(&CallerCoroutine::act);
+  }
+
+};
+
+}
+
+void BlockingWorkerPerfTest::onRun() {
+
+  oatpp::async::Executor executor(1, 1, 1);
+
+  v_int64 ticks;
+  {
+    oatpp::test::PerformanceChecker checker("Blocking calls: 100 coroutines x 100 calls");
+    for(v_int32 i = 0; i < CALLERS_COUNT; i ++) {
+      executor.execute<CallerCoroutine>();
+    }
+    while(executor.getTasksCount() != 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ticks = checker.getElapsedTicks();
+  }
+
+  auto stats = executor.getBlockingStats();
+  OATPP_LOGd(TAG, "calls per second: {}", static_cast<v_int64>(CALLERS_COUNT) * CALLS_COUNT * 1000000 / (ticks > 0 ? ticks : 1))
+  OATPP_LOGd(TAG, "completed={}, maxQueueDepth={}, threads={}", stats.completedCalls, stats.maxQueueDepth, stats.threads)
+  OATPP_ASSERT(stats.completedCalls == static_cast<v_uint64>(CALLERS_COUNT) * CALLS_COUNT)
+
+  executor.stop();
+  executor.join();
+
+}
+
+}}}
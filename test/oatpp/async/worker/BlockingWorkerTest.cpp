@@ -0,0 +1,184 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "BlockingWorkerTest.hpp"
+
+#include "oatpp/async/BlockingCall.hpp"
+#include "oatpp/async/Executor.hpp"
+
+namespace oatpp { namespace async { namespace worker {
+
+namespace {
+
+constexpr v_int32 CALLERS_COUNT = 50;
+constexpr v_int32 MAX_THREADS = 4;
+
+struct State {
+  std::atomic<v_int32> running{0};
+  std::atomic<v_int32> maxRunning{0};
+  std::atomic<v_int64> sum{0};
+  std::atomic<v_int32> voidCalls{0};
+  std::atomic<v_int32> errorsCaught{0};
+  std::atomic<bool> quickDone{false};
+};
+
+class CallerCoroutine : public oatpp::async::Coroutine<CallerCoroutine> {
+private:
+  v_int32 m_index;
+  std::shared_ptr<State> m_state;
+public:
+
+  CallerCoroutine(v_int32 index, const std::shared_ptr<State>& state)
+    : m_index(index)
+    , m_state(state)
+  {}
+
+  Action act() override {
+    auto state = m_state;
+    auto index = m_index;
+    return BlockingCall<v_int32>::startForResult([state, index]() {
+      v_int32 running = ++ state->running;
+      v_int32 maxRunning = state->maxRunning;
+      while(running > maxRunning && !state->maxRunning.compare_exchange_weak(maxRunning, running)) {}
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      -- state->running;
+      return index * 2;
+    }).callbackTo(&CallerCoroutine::onResult);
+  }
+
+  Action onResult(const v_int32& result) {
+    OATPP_ASSERT(result == m_index * 2)
+    m_state->sum += result;
+    auto state = m_state;
+    return BlockingCall<void>::start([state]() noexcept {
+      ++ state->voidCalls;
+    }).next(finish());
+  }
+
+};
+
+class ErrorCoroutine : public oatpp::async::Coroutine<ErrorCoroutine> {
+private:
+  std::shared_ptr<State> m_state;
+public:
+
+  ErrorCoroutine(const std::shared_ptr<State>& state)
+    : m_state(state)
+  {}
+
+  Action act() override {
+    return BlockingCall<v_int32>::startForResult([]() -> v_int32 {
+      throw std::runtime_error("blocking-error");
+    }).callbackTo(&ErrorCoroutine::onResult);
+  }
+
+  Action onResult(const v_int32& result) {
+    (void) result;
+    OATPP_ASSERT(false)
+    return finish();
+  }
+
+  Action handleError(Error* error) override {
+    try {
+      std::rethrow_exception(error->getExceptionPtr());
+    } catch (const std::runtime_error& e) {
+      if(std::string(e.what()) == "blocking-error") {
+        ++ m_state->errorsCaught;
+      }
+    }
+    return finish();
+  }
+
+};
+
+class QuickCoroutine : public oatpp::async::Coroutine<QuickCoroutine> {
+private:
+  std::shared_ptr<State> m_state;
+public:
+
+  QuickCoroutine(const std::shared_ptr<State>& state)
+    : m_state(state)
+  {}
+
+  Action act() override {
+    m_state->quickDone = true;
+    return finish();
+  }
+
+};
+
+}
+
+void BlockingWorkerTest::onRun() {
+
+  BlockingWorker::Config config;
+  config.minThreads = 1;
+  config.maxThreads = MAX_THREADS;
+  config.keepAlive = std::chrono::milliseconds(50);
+
+  oatpp::async::Executor executor(1, 1, 1, Executor::VALUE_SUGGESTED, Worker::LocalRunBudget(), Processor::Scheduling(), config);
+  auto state = std::make_shared<State>();
+
+  for(v_int32 i = 0; i < CALLERS_COUNT; i ++) {
+    executor.execute<CallerCoroutine>(i, state);
+  }
+  executor.execute<ErrorCoroutine>(state);
+
+  // processor is not blocked by pending blocking calls
+  executor.execute<QuickCoroutine>(state);
+  for(v_int32 i = 0; i < 1000 && !state->quickDone; i ++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  OATPP_ASSERT(state->quickDone)
+  OATPP_ASSERT(state->voidCalls < CALLERS_COUNT)
+
+  executor.waitTasksFinished();
+
+  OATPP_ASSERT(state->sum == static_cast<v_int64>(CALLERS_COUNT) * (CALLERS_COUNT - 1))
+  OATPP_ASSERT(state->voidCalls == CALLERS_COUNT)
+  OATPP_ASSERT(state->errorsCaught == 1)
+  OATPP_ASSERT(state->maxRunning <= MAX_THREADS)
+  OATPP_ASSERT(state->maxRunning > 1)
+
+  auto stats = executor.getBlockingStats();
+  OATPP_LOGd(TAG, "completed={}, maxQueueDepth={}, threads={}", stats.completedCalls, stats.maxQueueDepth, stats.threads)
+  OATPP_ASSERT(stats.completedCalls == static_cast<v_uint64>(CALLERS_COUNT * 2 + 1))
+  OATPP_ASSERT(stats.maxQueueDepth > MAX_THREADS)
+  OATPP_ASSERT(stats.queueDepth == 0)
+  OATPP_ASSERT(stats.threads <= MAX_THREADS)
+
+  // idle threads above minThreads stop after keepAlive
+  for(v_int32 i = 0; i < 200 && executor.getBlockingStats().threads > config.minThreads; i ++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  stats = executor.getBlockingStats();
+  OATPP_ASSERT(stats.threads == config.minThreads)
+  OATPP_ASSERT(stats.activeThreads == 0)
+
+  executor.stop();
+  executor.join();
+
+}
+
+}}}
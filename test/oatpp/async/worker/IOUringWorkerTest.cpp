@@ -0,0 +1,195 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOUringWorkerTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+#include "oatpp/async/worker/IOUringWorker.hpp"
+#include "oatpp/network/tcp/Connection.hpp"
+
+#if !defined(WIN32) && !defined(_WIN32)
+  #include <sys/socket.h>
+#endif
+
+namespace oatpp { namespace async { namespace worker {
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+namespace {
+
+constexpr v_buff_size DATA_SIZE = 4 * 1024 * 1024;
+constexpr v_buff_size CHUNK_SIZE = 64 * 1024;
+
+v_char8 patternAt(v_buff_size offset) {
+  return static_cast<v_char8>((offset * 31) % 251);
+}
+
+struct Result {
+  std::atomic<v_buff_size> written{0};
+  std::atomic<v_buff_size> read{0};
+  std::atomic<v_buff_size> mismatches{0};
+};
+
+class WriterCoroutine : public oatpp::async::Coroutine<WriterCoroutine> {
+private:
+  std::shared_ptr<oatpp::network::tcp::Connection> m_connection;
+  std::shared_ptr<Result> m_result;
+  v_buff_size m_position;
+  v_char8 m_buffer[CHUNK_SIZE];
+public:
+
+  WriterCoroutine(const std::shared_ptr<oatpp::network::tcp::Connection>& connection, const std::shared_ptr<Result>& result)
+    : m_connection(connection)
+    , m_result(result)
+    , m_position(0)
+  {}
+
+  Action act() override {
+
+    if(m_position == DATA_SIZE) {
+      m_result->written = m_position;
+      ::shutdown(m_connection->getHandle(), SHUT_WR);
+      return finish();
+    }
+
+    auto size = std::min(CHUNK_SIZE, DATA_SIZE - m_position);
+    for(v_buff_size i = 0; i < size; i ++) {
+      m_buffer[i] = patternAt(m_position + i);
+    }
+
+    Action action;
+    auto res = m_connection->write(m_buffer, size, action);
+    if(!action.isNone()) {
+      return action;
+    }
+    if(res > 0) {
+      m_position += res;
+      return repeat();
+    }
+    if(res == oatpp::IOError::RETRY_WRITE) {
+      return repeat();
+    }
+
+    return error<oatpp::async::Error>("[WriterCoroutine::act()]: Error. Write failed.");
+
+  }
+
+};
+
+class ReaderCoroutine : public oatpp::async::Coroutine<ReaderCoroutine> {
+private:
+  std::shared_ptr<oatpp::network::tcp::Connection> m_connection;
+  std::shared_ptr<Result> m_result;
+  v_buff_size m_position;
+  v_char8 m_buffer[CHUNK_SIZE];
+public:
+
+  ReaderCoroutine(const std::shared_ptr<oatpp::network::tcp::Connection>& connection, const std::shared_ptr<Result>& result)
+    : m_connection(connection)
+    , m_result(result)
+    , m_position(0)
+  {}
+
+  Action act() override {
+
+    Action action;
+    auto res = m_connection->read(m_buffer, CHUNK_SIZE, action);
+    if(!action.isNone()) {
+      return action;
+    }
+
+    if(res > 0) {
+      for(v_buff_size i = 0; i < res; i ++) {
+        if(m_buffer[i] != patternAt(m_position + i)) {
+          m_result->mismatches ++;
+        }
+      }
+      m_position += res;
+      return repeat();
+    }
+
+    if(res == oatpp::IOError::RETRY_READ) {
+      return repeat();
+    }
+
+    m_result->read = m_position;
+    return finish();
+
+  }
+
+};
+
+void runTransfer(v_int32 ioWorkerType) {
+
+  int fds[2];
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0)
+
+  auto writerConnection = std::make_shared<oatpp::network::tcp::Connection>(fds[0]);
+  auto readerConnection = std::make_shared<oatpp::network::tcp::Connection>(fds[1]);
+  writerConnection->setOutputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+  readerConnection->setInputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+
+  auto result = std::make_shared<Result>();
+
+  oatpp::async::Executor executor(1, 1, 1, ioWorkerType);
+
+  executor.execute<ReaderCoroutine>(readerConnection, result);
+  executor.execute<WriterCoroutine>(writerConnection, result);
+
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  OATPP_ASSERT(result->written == DATA_SIZE)
+  OATPP_ASSERT(result->read == DATA_SIZE)
+  OATPP_ASSERT(result->mismatches == 0)
+
+}
+
+}
+
+void IOUringWorkerTest::onRun() {
+
+  OATPP_LOGd(TAG, "io_uring supported={}", IOUringWorker::isSupported())
+
+  /* Executor falls back to event worker if io_uring is not supported */
+  runTransfer(oatpp::async::Executor::IO_WORKER_TYPE_URING);
+
+  if(IOUringWorker::isSupported()) {
+    IOUringWorker worker;
+    worker.stop();
+    worker.join();
+  }
+
+}
+
+#else
+
+void IOUringWorkerTest::onRun() {
+  OATPP_ASSERT(!IOUringWorker::isSupported())
+}
+
+#endif
+
+}}}
@@ -0,0 +1,180 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "LocalRunTest.hpp"
+
+#include "oatpp/async/Executor.hpp"
+#include "oatpp/network/tcp/Connection.hpp"
+
+#if !defined(WIN32) && !defined(_WIN32)
+  #include <sys/socket.h>
+  #include <unistd.h>
+#endif
+
+namespace oatpp { namespace async { namespace worker {
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+namespace {
+
+constexpr v_int32 BYTES_COUNT = 50;
+
+struct Result {
+  std::atomic<v_int32> bytesRead{0};
+  std::atomic<v_int32> stepsOnProcessor{0};
+  std::atomic<v_int32> stepsElsewhere{0};
+};
+
+/**
+ * Reads bytes one by one. After each byte goes through a chain of non-I/O steps.
+ */
+class ReaderCoroutine : public oatpp::async::Coroutine<ReaderCoroutine> {
+private:
+  std::shared_ptr<oatpp::network::tcp::Connection> m_connection;
+  std::shared_ptr<Result> m_result;
+  std::thread::id m_processorThread;
+  v_int32 m_count;
+public:
+
+  ReaderCoroutine(const std::shared_ptr<oatpp::network::tcp::Connection>& connection, const std::shared_ptr<Result>& result)
+    : m_connection(connection)
+    , m_result(result)
+    , m_count(0)
+  {}
+
+  Action act() override {
+    m_processorThread = std::this_thread::get_id();
+    return yieldTo(&ReaderCoroutine::read);
+  }
+
+  Action read() {
+
+    if(m_count == BYTES_COUNT) {
+      return finish();
+    }
+
+    v_char8 byte;
+    Action action;
+    auto res = m_connection->read(&byte, 1, action);
+    if(!action.isNone()) {
+      return action;
+    }
+
+    if(res == 1) {
+      m_count ++;
+      m_result->bytesRead ++;
+      return yieldTo(&ReaderCoroutine::onByte);
+    }
+
+    if(res == oatpp::IOError::RETRY_READ) {
+      return repeat();
+    }
+
+    return error<oatpp::async::Error>("[ReaderCoroutine::read()]: Error. Read failed.");
+
+  }
+
+  Action onByte() {
+    if(std::this_thread::get_id() == m_processorThread) {
+      m_result->stepsOnProcessor ++;
+    } else {
+      m_result->stepsElsewhere ++;
+    }
+    return yieldTo(&ReaderCoroutine::read);
+  }
+
+};
+
+std::shared_ptr<Result> runReader(v_int32 ioWorkerType, const Worker::LocalRunBudget& budget) {
+
+  int fds[2];
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0)
+
+  auto connection = std::make_shared<oatpp::network::tcp::Connection>(fds[1]);
+  connection->setInputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+
+  auto result = std::make_shared<Result>();
+
+  oatpp::async::Executor executor(1, 1, 1, ioWorkerType, budget);
+  executor.execute<ReaderCoroutine>(connection, result);
+
+  /* Feed bytes slowly so that the reader waits for I/O before each byte */
+  for(v_int32 i = 0; i < BYTES_COUNT; i ++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    v_char8 byte = 'x';
+    OATPP_ASSERT(::write(fds[0], &byte, 1) == 1)
+  }
+
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  ::close(fds[0]);
+
+  OATPP_ASSERT(result->bytesRead == BYTES_COUNT)
+  OATPP_ASSERT(result->stepsOnProcessor + result->stepsElsewhere == BYTES_COUNT)
+
+  return result;
+
+}
+
+}
+
+void LocalRunTest::onRun() {
+
+  Worker::LocalRunBudget disabled;
+
+  Worker::LocalRunBudget enabled;
+  enabled.maxSteps = 16;
+  enabled.maxTime = std::chrono::milliseconds(10);
+
+  for(v_int32 ioWorkerType : {oatpp::async::Executor::IO_WORKER_TYPE_EVENT, oatpp::async::Executor::IO_WORKER_TYPE_URING}) {
+
+    {
+      auto result = runReader(ioWorkerType, disabled);
+      OATPP_LOGd(TAG, "type={}, budget disabled: steps on processor={}, on I/O worker={}",
+                 ioWorkerType, result->stepsOnProcessor.load(), result->stepsElsewhere.load())
+      OATPP_ASSERT(result->stepsElsewhere == 0)
+    }
+
+    {
+      auto result = runReader(ioWorkerType, enabled);
+      OATPP_LOGd(TAG, "type={}, budget enabled: steps on processor={}, on I/O worker={}",
+                 ioWorkerType, result->stepsOnProcessor.load(), result->stepsElsewhere.load())
+      OATPP_ASSERT(result->stepsElsewhere > 0)
+    }
+
+  }
+
+}
+
+#else
+
+void LocalRunTest::onRun() {
+  // DO NOTHING
+}
+
+#endif
+
+}}}
@@ -0,0 +1,298 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "WritevTest.hpp"
+
+#include "oatpp/data/stream/BufferStream.hpp"
+#include "oatpp/network/tcp/Connection.hpp"
+#include "oatpp/web/protocol/http/encoding/Chunked.hpp"
+#include "oatpp/async/Executor.hpp"
+
+#include <vector>
+#include <string>
+
+#if !defined(WIN32) && !defined(_WIN32)
+  #include <unistd.h>
+  #include <sys/socket.h>
+#endif
+
+namespace oatpp { namespace data { namespace stream {
+
+namespace {
+
+/*
+ * Output stream which records every write call.
+ * It may accept only part of the data per call, and it may implement writev natively (one call for all segments).
+ * Once `capacity` bytes are written (if set) every further write fails with BROKEN_PIPE.
+ */
+class RecordingStream : public OutputStream {
+private:
+  static DefaultInitializedContext DEFAULT_CONTEXT;
+private:
+  v_buff_size m_maxWriteSize;
+  bool m_nativeWritev;
+public:
+
+  std::string output;
+  std::vector<std::string> writes;
+  v_buff_size capacity;
+
+  RecordingStream(v_buff_size maxWriteSize, bool nativeWritev)
+    : m_maxWriteSize(maxWriteSize)
+    , m_nativeWritev(nativeWritev)
+    , capacity(-1)
+  {}
+
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override {
+    (void) action;
+    if(count > m_maxWriteSize) {
+      count = m_maxWriteSize;
+    }
+    if(capacity >= 0) {
+      auto available = capacity - static_cast<v_buff_size>(output.size());
+      if(available <= 0) {
+        return IOError::BROKEN_PIPE;
+      }
+      if(count > available) {
+        count = available;
+      }
+    }
+    output.append(reinterpret_cast<const char*>(data), static_cast<size_t>(count));
+    writes.emplace_back(reinterpret_cast<const char*>(data), static_cast<size_t>(count));
+    return count;
+  }
+
+  v_io_size writev(const WriteSegment* segments, v_int32 count, async::Action& action) override {
+    if(!m_nativeWritev || capacity >= 0) {
+      return OutputStream::writev(segments, count, action);
+    }
+    std::string data;
+    for(v_int32 i = 0; i < count; i ++) {
+      data.append(reinterpret_cast<const char*>(segments[i].data), static_cast<size_t>(segments[i].size));
+    }
+    output.append(data);
+    writes.push_back(data);
+    return static_cast<v_io_size>(data.size());
+  }
+
+  void setOutputStreamIOMode(IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  IOMode getOutputStreamIOMode() override {
+    return IOMode::ASYNCHRONOUS;
+  }
+
+  Context& getOutputStreamContext() override {
+    return DEFAULT_CONTEXT;
+  }
+
+};
+
+DefaultInitializedContext RecordingStream::DEFAULT_CONTEXT(StreamType::STREAM_FINITE);
+
+class TransferCoroutine : public oatpp::async::Coroutine<TransferCoroutine> {
+private:
+  std::shared_ptr<InputStream> m_inStream;
+  std::shared_ptr<OutputStream> m_outStream;
+  std::shared_ptr<data::buffer::Processor> m_processor;
+public:
+
+  TransferCoroutine(const std::shared_ptr<InputStream>& inStream,
+                    const std::shared_ptr<OutputStream>& outStream,
+                    const std::shared_ptr<data::buffer::Processor>& processor)
+    : m_inStream(inStream)
+    , m_outStream(outStream)
+    , m_processor(processor)
+  {}
+
+  Action act() override {
+    return data::stream::transferAsync(m_inStream, m_outStream, 0, data::buffer::IOBuffer::createShared(), m_processor)
+      .next(finish());
+  }
+
+};
+
+const std::vector<std::string> CHUNKED_WRITES = {"5\r\nHello", "\r\n5\r\n Worl", "\r\n4\r\nd!!!", "\r\n0\r\n\r\n"};
+
+}
+
+void WritevTest::onRun() {
+
+  {
+    OATPP_LOGd(TAG, "emulated writev")
+
+    RecordingStream stream(3, false);
+
+    WriteSegment segments[4] = {{"Hello", 5}, {nullptr, 0}, {" ", 1}, {"World", 5}};
+    auto res = stream.writevExactSizeDataSimple(segments, 4);
+
+    OATPP_ASSERT(res == 11)
+    OATPP_ASSERT(stream.output == "Hello World")
+    OATPP_ASSERT(stream.writes.size() == 5) // "Hel", "lo", " ", "Wor", "ld"
+    OATPP_ASSERT(WriteCallback::advanceSegments(segments, 4, 0) == 0)
+  }
+
+  {
+    OATPP_LOGd(TAG, "advanceSegments")
+
+    WriteSegment segments[3] = {{"abc", 3}, {"de", 2}, {"fgh", 3}};
+
+    OATPP_ASSERT(WriteCallback::advanceSegments(segments, 3, 4) == 4)
+    OATPP_ASSERT(segments[0].size == 0)
+    OATPP_ASSERT(segments[1].size == 1)
+    OATPP_ASSERT(*reinterpret_cast<const char*>(segments[1].data) == 'e')
+    OATPP_ASSERT(segments[2].size == 3)
+  }
+
+  {
+    OATPP_LOGd(TAG, "BufferOutputStream::writev")
+
+    BufferOutputStream stream(4);
+    stream << "<";
+
+    WriteSegment segments[3] = {{"Hello", 5}, {" ", 1}, {"World", 5}};
+    async::Action action;
+    auto res = stream.writev(segments, 3, action);
+
+    OATPP_ASSERT(res == 11)
+    OATPP_ASSERT(stream.toString() == "<Hello World")
+  }
+
+#if !defined(WIN32) && !defined(_WIN32)
+  {
+    OATPP_LOGd(TAG, "tcp::Connection::writev")
+
+    int fds[2];
+    OATPP_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0)
+
+    {
+      oatpp::network::tcp::Connection connection(fds[0]);
+
+      WriteSegment segments[3] = {{"Hello", 5}, {" ", 1}, {"World", 5}};
+      auto res = connection.writevExactSizeDataSimple(segments, 3);
+      OATPP_ASSERT(res == 11)
+    }
+
+    std::string received;
+    char buffer[64];
+    ssize_t res;
+    while((res = ::read(fds[1], buffer, sizeof(buffer))) > 0) {
+      received.append(buffer, static_cast<size_t>(res));
+    }
+    ::close(fds[1]);
+
+    OATPP_ASSERT(received == "Hello World")
+  }
+#endif
+
+  {
+    OATPP_LOGd(TAG, "transfer - chunk header and chunk data in one write")
+
+    BufferInputStream inStream(oatpp::String("Hello World!!!"));
+    RecordingStream outStream(1024, true);
+
+    oatpp::web::protocol::http::encoding::EncoderChunked encoder;
+
+    v_char8 buffer[5];
+    data::stream::transfer(&inStream, &outStream, 0, buffer, 5, &encoder);
+
+    OATPP_ASSERT(outStream.writes == CHUNKED_WRITES)
+  }
+
+  {
+    OATPP_LOGd(TAG, "transferAsync - chunk header and chunk data in one write")
+
+    auto inStream = std::make_shared<BufferInputStream>(oatpp::String("Hello World!!!"));
+    auto outStream = std::make_shared<RecordingStream>(1024, true);
+    auto encoder = std::make_shared<oatpp::web::protocol::http::encoding::EncoderChunked>();
+
+    oatpp::async::Executor executor(1, 1, 1);
+    executor.execute<TransferCoroutine>(inStream, outStream, encoder);
+    executor.waitTasksFinished();
+    executor.stop();
+    executor.join();
+
+    OATPP_LOGd(TAG, "writes={}", outStream->writes.size())
+    OATPP_ASSERT(outStream->output == "E\r\nHello World!!!\r\n0\r\n\r\n")
+    OATPP_ASSERT(outStream->writes.size() == 2)
+  }
+
+  {
+    OATPP_LOGd(TAG, "transfer - partial writes")
+
+    BufferInputStream inStream(oatpp::String("Hello World!!!"));
+    RecordingStream outStream(2, false);
+
+    oatpp::web::protocol::http::encoding::EncoderChunked encoder;
+
+    v_char8 buffer[5];
+    data::stream::transfer(&inStream, &outStream, 0, buffer, 5, &encoder);
+
+    std::string expected;
+    for(auto& write : CHUNKED_WRITES) {
+      expected += write;
+    }
+    OATPP_ASSERT(outStream.output == expected)
+  }
+
+  {
+    OATPP_LOGd(TAG, "transfer - failed writes")
+
+    std::string expected;
+    for(auto& write : CHUNKED_WRITES) {
+      expected += write;
+    }
+
+    auto lastChunkSize = static_cast<v_buff_size>(CHUNKED_WRITES.back().size());
+
+    /* -1 - no failure; next two - the final carry flush is short or fails outright; 10 - fails mid-transfer */
+    for(v_buff_size capacity : {static_cast<v_buff_size>(-1),
+                                static_cast<v_buff_size>(expected.size()) - 1,
+                                static_cast<v_buff_size>(expected.size()) - lastChunkSize,
+                                static_cast<v_buff_size>(10)})
+    {
+      BufferInputStream inStream(oatpp::String("Hello World!!!"));
+      RecordingStream outStream(1024, true);
+      outStream.capacity = capacity;
+
+      oatpp::web::protocol::http::encoding::EncoderChunked encoder;
+
+      v_char8 buffer[5];
+      auto res = data::stream::transfer(&inStream, &outStream, 0, buffer, 5, &encoder);
+
+      OATPP_LOGd(TAG, "capacity={}, res={}", capacity, res)
+      if(capacity < 0) {
+        OATPP_ASSERT(res == 14)
+        OATPP_ASSERT(outStream.output == expected)
+      } else {
+        OATPP_ASSERT(res == IOError::BROKEN_PIPE)
+        OATPP_ASSERT(static_cast<v_buff_size>(outStream.output.size()) == capacity)
+      }
+    }
+  }
+
+}
+
+}}}
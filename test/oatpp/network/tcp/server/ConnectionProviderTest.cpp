@@ -0,0 +1,118 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ConnectionProviderTest.hpp"
+
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/network/tcp/client/ConnectionProvider.hpp"
+
+#include "oatpp/utils/Conversion.hpp"
+
+#include <cstring>
+#include <thread>
+#include <list>
+
+namespace oatpp { namespace test { namespace network { namespace tcp { namespace server {
+
+void ConnectionProviderTest::onRun() {
+
+  typedef oatpp::network::tcp::server::ConnectionProvider ServerProvider;
+  typedef oatpp::network::tcp::client::ConnectionProvider ClientProvider;
+
+  {
+    OATPP_LOGd(TAG, "Test stop() interrupts waiting get()...")
+
+    auto provider = ServerProvider::createShared({"localhost", 0});
+
+    std::atomic<bool> done(false);
+    std::thread acceptor([provider, &done] {
+      auto connection = provider->get();
+      OATPP_ASSERT(connection.object == nullptr)
+      done = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto stopTime = std::chrono::steady_clock::now();
+    provider->stop();
+    acceptor.join();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - stopTime);
+
+    OATPP_LOGd(TAG, "get() returned in {}ms after stop()", elapsed.count())
+    OATPP_ASSERT(done)
+#if defined(__linux__)
+    OATPP_ASSERT(elapsed.count() < 500)
+#endif
+    OATPP_LOGd(TAG, "OK")
+  }
+
+  {
+    OATPP_LOGd(TAG, "Test batched accept...")
+
+    constexpr v_int32 CONNECTIONS = 5;
+
+    auto provider = ServerProvider::createShared({"localhost", 0});
+
+    bool success;
+    auto port = oatpp::utils::Conversion::strToInt32(provider->getProperty(ServerProvider::PROPERTY_PORT).toString(), success);
+    OATPP_ASSERT(success)
+
+    auto clientProvider = ClientProvider::createShared({"localhost", static_cast<v_uint16>(port)});
+
+    std::list<oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>> clientConnections;
+    for(v_int32 i = 0; i < CONNECTIONS; i ++) {
+      clientConnections.push_back(clientProvider->get());
+    }
+
+    std::list<oatpp::provider::ResourceHandle<oatpp::data::stream::IOStream>> serverConnections;
+    while(serverConnections.size() < CONNECTIONS) {
+      auto connection = provider->get();
+      if(connection) {
+        serverConnections.push_back(connection);
+      }
+    }
+
+    OATPP_ASSERT(provider->getStatistics().acceptedConnections == CONNECTIONS)
+    OATPP_ASSERT(provider->getStatistics().openConnections == CONNECTIONS)
+
+    /* connection handed out by a batch must be usable in both modes */
+    auto& connection = serverConnections.front().object;
+    connection->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+    OATPP_ASSERT(connection->getInputStreamIOMode() == oatpp::data::stream::IOMode::BLOCKING)
+
+    clientConnections.front().object->writeExactSizeDataSimple("ping", 4);
+    char buffer[4];
+    OATPP_ASSERT(connection->readExactSizeDataSimple(buffer, 4) == 4)
+    OATPP_ASSERT(std::memcmp(buffer, "ping", 4) == 0)
+
+    serverConnections.clear();
+    OATPP_ASSERT(provider->getStatistics().openConnections == 0)
+
+    provider->stop();
+    OATPP_LOGd(TAG, "OK")
+  }
+
+}
+
+}}}}}
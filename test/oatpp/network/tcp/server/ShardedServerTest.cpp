@@ -0,0 +1,109 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ShardedServerTest.hpp"
+
+#include "oatpp/network/tcp/server/ShardedServer.hpp"
+#include "oatpp/network/tcp/client/ConnectionProvider.hpp"
+
+#include "oatpp/web/client/HttpRequestExecutor.hpp"
+#include "oatpp/web/server/HttpConnectionHandler.hpp"
+
+namespace oatpp { namespace test { namespace network { namespace tcp { namespace server {
+
+namespace {
+
+class OkHandler : public oatpp::web::server::HttpRequestHandler {
+public:
+
+  std::shared_ptr<OutgoingResponse> handle(const std::shared_ptr<IncomingRequest> &request) override {
+    (void) request;
+    return OutgoingResponse::createShared(Status::CODE_200, nullptr);
+  }
+
+};
+
+}
+
+void ShardedServerTest::onRun() {
+
+#if defined(SO_REUSEPORT)
+
+  constexpr v_int32 SHARDS = 2;
+  constexpr v_int32 REQUESTS = 20;
+
+  auto router = oatpp::web::server::HttpRouter::createShared();
+  router->route("GET", "/", std::make_shared<OkHandler>());
+
+  auto server = oatpp::network::tcp::server::ShardedServer::createShared({"localhost", 0}, SHARDS, [router](v_int32 shardIndex) {
+    (void) shardIndex;
+    return oatpp::web::server::HttpConnectionHandler::createShared(router);
+  });
+
+  OATPP_ASSERT(server->getShardsCount() == SHARDS)
+  OATPP_ASSERT(server->getConnectionHandler(0) != server->getConnectionHandler(1))
+
+  server->start();
+
+  OATPP_LOGd(TAG, "Sharded server listening on port {}", server->getPort())
+
+  auto clientConnectionProvider = oatpp::network::tcp::client::ConnectionProvider::createShared({"localhost", server->getPort()});
+  oatpp::web::client::HttpRequestExecutor executor(clientConnectionProvider);
+
+  for(v_int32 i = 0; i < REQUESTS; i ++) {
+    auto response = executor.execute("GET", "/", oatpp::web::protocol::http::Headers({}), nullptr, nullptr);
+    OATPP_ASSERT(response->getStatusCode() == 200)
+  }
+
+  server->stop();
+
+  /* Connection objects may be released shortly after the handler is stopped */
+  for(v_int32 attempt = 0; attempt < 100; attempt ++) {
+    v_int64 open = 0;
+    for(v_int32 i = 0; i < SHARDS; i ++) {
+      open += server->getShardStats(i).openConnections;
+    }
+    if(open == 0) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+
+  v_uint64 accepted = 0;
+  for(v_int32 i = 0; i < SHARDS; i ++) {
+    auto stats = server->getShardStats(i);
+    OATPP_LOGd(TAG, "shard {}: accepted={}, open={}", i, stats.acceptedConnections, stats.openConnections)
+    OATPP_ASSERT(stats.openConnections == 0)
+    accepted += stats.acceptedConnections;
+  }
+
+  OATPP_ASSERT(accepted == REQUESTS)
+
+#else
+  OATPP_LOGd(TAG, "SO_REUSEPORT is not supported on this platform. Skipping.")
+#endif
+
+}
+
+}}}}}
@@ -0,0 +1,216 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "AsyncAllocationPerfTest.hpp"
+
+#include "oatpp/web/app/Client.hpp"
+
+#include "oatpp/web/app/ControllerAsync.hpp"
+
+#include "oatpp/web/client/HttpRequestExecutor.hpp"
+
+#include "oatpp/web/server/AsyncHttpConnectionHandler.hpp"
+#include "oatpp/web/server/HttpRouter.hpp"
+
+#include "oatpp/json/ObjectMapper.hpp"
+
+#include "oatpp/network/virtual_/client/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/server/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/Interface.hpp"
+
+#include "oatpp/network/ConnectionPool.hpp"
+
+#include "oatpp/async/utils/SlabAllocator.hpp"
+
+#include "oatpp/macro/component.hpp"
+
+#include "oatpp-test/web/ClientServerTestRunner.hpp"
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace web {
+
+namespace {
+
+typedef oatpp::web::protocol::http::incoming::Response IncomingResponse;
+
+class TestComponent {
+public:
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::async::Executor>, executor)([] {
+    return std::make_shared<oatpp::async::Executor>(1, 1, 1);
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([] {
+    return oatpp::network::virtual_::Interface::obtainShared("virtualhost");
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ServerConnectionProvider>, serverConnectionProvider)([] {
+    OATPP_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, _interface);
+    return std::static_pointer_cast<oatpp::network::ServerConnectionProvider>(
+      oatpp::network::virtual_::server::ConnectionProvider::createShared(_interface)
+    );
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, httpRouter)([] {
+    return oatpp::web::server::HttpRouter::createShared();
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, serverConnectionHandler)([] {
+    OATPP_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, router);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::async::Executor>, executr);
+    return oatpp::web::server::AsyncHttpConnectionHandler::createShared(router, executr);
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::data::mapping::ObjectMapper>, objectMapper)([] {
+    return std::make_shared<oatpp::json::ObjectMapper>();
+  }());
+
+  /*
+   * One keep-alive connection is reused by all cycles - connection setup is not part of the measured cycle.
+   */
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ClientConnectionPool>, clientConnectionPool)([] {
+    OATPP_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, _interface);
+    return oatpp::network::ClientConnectionPool::createShared(
+      oatpp::network::virtual_::client::ConnectionProvider::createShared(_interface),
+      1,
+      std::chrono::seconds(10)
+    );
+  }());
+
+  OATPP_CREATE_COMPONENT(std::shared_ptr<app::Client>, appClient)([] {
+    OATPP_COMPONENT(std::shared_ptr<oatpp::network::ClientConnectionPool>, connectionPool);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::data::mapping::ObjectMapper>, objMapper);
+    auto requestExecutor = oatpp::web::client::HttpRequestExecutor::createShared(connectionPool);
+    return app::Client::createShared(requestExecutor, objMapper);
+  }());
+
+};
+
+/*
+ * Runs request/response cycles one after another so that allocations can be attributed to a single cycle.
+ */
+class ClientCoroutine : public oatpp::async::Coroutine<ClientCoroutine> {
+public:
+  static std::atomic<bool> DONE;
+private:
+  OATPP_COMPONENT(std::shared_ptr<app::Client>, appClient);
+  v_int32 m_iterations;
+  v_int32 m_counter;
+public:
+
+  ClientCoroutine(v_int32 iterations)
+    : m_iterations(iterations)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter == m_iterations) {
+      DONE = true;
+      return finish();
+    }
+    return appClient->getRootAsync().callbackTo(&ClientCoroutine::onResponse);
+  }
+
+  Action onResponse(const std::shared_ptr<IncomingResponse>& response) {
+    OATPP_ASSERT(response->getStatusCode() == 200)
+    return response->readBodyToStringAsync().callbackTo(&ClientCoroutine::onBodyRead);
+  }
+
+  Action onBodyRead(const oatpp::String& body) {
+    OATPP_ASSERT(body == "Hello World Async!!!")
+    m_counter ++;
+    return yieldTo(&ClientCoroutine::act);
+  }
+
+  Action handleError(Error* error) override {
+    OATPP_LOGe("[AsyncAllocationPerfTest::ClientCoroutine::handleError()]", "Error. {}", error->what())
+    OATPP_ASSERT(!"Error")
+    return error;
+  }
+
+};
+
+std::atomic<bool> ClientCoroutine::DONE(false);
+
+}
+
+void AsyncAllocationPerfTest::onRun() {
+
+  TestComponent component;
+
+  oatpp::test::web::ClientServerTestRunner runner;
+
+  runner.addController(app::ControllerAsync::createShared());
+
+  runner.run([this] {
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::async::Executor>, executor);
+
+    auto before = oatpp::async::utils::SlabAllocator::getStats();
+    v_int64 ticks;
+
+    {
+      oatpp::test::PerformanceChecker checker("Request/response cycles");
+
+      ClientCoroutine::DONE = false;
+      executor->execute<ClientCoroutine>(m_iterations);
+
+      while(!ClientCoroutine::DONE) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+
+      ticks = checker.getElapsedTicks();
+    }
+
+    executor->waitTasksFinished();
+
+    auto after = oatpp::async::utils::SlabAllocator::getStats();
+
+    auto poolAllocations = after.poolAllocations - before.poolAllocations;
+    auto heapAllocations = after.heapAllocations - before.heapAllocations;
+    auto remoteFrees = after.remoteFrees - before.remoteFrees;
+
+    OATPP_LOGi(TAG, "cycles={}, time={}(micro), {}(micro) per cycle", m_iterations, ticks, ticks / m_iterations)
+    OATPP_LOGi(TAG, "coroutine allocations per cycle: pool={}, heap={}, remote frees={}",
+               static_cast<v_float64>(poolAllocations) / m_iterations,
+               static_cast<v_float64>(heapAllocations) / m_iterations,
+               static_cast<v_float64>(remoteFrees) / m_iterations)
+
+    // client and server coroutines are created on the processor thread and must come from its pool
+    OATPP_ASSERT(poolAllocations > 0)
+    OATPP_ASSERT(poolAllocations > heapAllocations)
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::network::ClientConnectionPool>, connectionPool);
+    connectionPool->stop();
+
+    executor->stop();
+
+  }, std::chrono::minutes(10));
+
+  OATPP_COMPONENT(std::shared_ptr<oatpp::async::Executor>, executor);
+  executor->join();
+
+}
+
+}}}
@@ -0,0 +1,133 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HeadersMapPerfTest.hpp"
+
+#include "oatpp/web/protocol/http/Http.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http {
+
+namespace {
+
+typedef oatpp::web::protocol::http::Header Header;
+typedef oatpp::web::protocol::http::HeaderId HeaderId;
+typedef oatpp::web::protocol::http::Headers Headers;
+typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+typedef oatpp::data::share::StringKeyLabelCI StringKeyLabelCI;
+
+/**
+ * unordered_multimap-based headers - the way headers were stored before HeadersMap.
+ */
+typedef oatpp::data::share::LazyStringMultimap<StringKeyLabelCI> MultimapHeaders;
+
+const char* const BROWSER_HEADERS =
+  "Host: app.example.com\r\n"
+  "Connection: keep-alive\r\n"
+  "Cache-Control: max-age=0\r\n"
+  "sec-ch-ua-mobile: ?0\r\n"
+  "sec-ch-ua-platform: \"macOS\"\r\n"
+  "Upgrade-Insecure-Requests: 1\r\n"
+  "User-Agent: Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/537.36 (KHTML, like Gecko)\r\n"
+  "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+  "Sec-Fetch-Site: same-origin\r\n"
+  "Sec-Fetch-Mode: navigate\r\n"
+  "Referer: https://app.example.com/dashboard/projects/oatpp\r\n"
+  "Accept-Encoding: gzip, deflate, br\r\n"
+  "Accept-Language: en-US,en;q=0.9,uk;q=0.8\r\n"
+  "Content-Length: 0\r\n"
+  "\r\n";
+
+/*
+ * Split headers the same way the http parser does, so both containers get identical labels.
+ */
+std::vector<std::pair<StringKeyLabelCI, StringKeyLabel>> splitHeaders(const std::shared_ptr<std::string>& text) {
+  Headers headers;
+  oatpp::utils::parser::Caret caret(text->data(), static_cast<v_buff_size>(text->size()));
+  oatpp::web::protocol::http::Status status;
+  oatpp::web::protocol::http::Parser::parseHeaders(headers, text, caret, status);
+  OATPP_ASSERT(status.code == 0)
+  std::vector<std::pair<StringKeyLabelCI, StringKeyLabel>> result;
+  for(const auto& pair : headers.getAll_Unsafe()) {
+    result.emplace_back(pair.first, pair.second);
+  }
+  return result;
+}
+
+/*
+ * Lookups done for every request: body decoding, encoder selection and connection state.
+ */
+template<class Map, class Key>
+v_buff_size lookup(const Map& map,
+                   const Key& transferEncoding, const Key& contentLength, const Key& acceptEncoding, const Key& connection)
+{
+  return map.template getAsMemoryLabel_Unsafe<StringKeyLabelCI>(transferEncoding).getSize()
+       + map.template getAsMemoryLabel_Unsafe<StringKeyLabelCI>(contentLength).getSize()
+       + map.template getAsMemoryLabel_Unsafe<StringKeyLabelCI>(acceptEncoding).getSize()
+       + map.template getAsMemoryLabel_Unsafe<StringKeyLabelCI>(connection).getSize();
+}
+
+}
+
+void HeadersMapPerfTest::onRun() {
+
+  v_int32 numIterations = 200000;
+
+  auto entries = splitHeaders(std::make_shared<std::string>(BROWSER_HEADERS));
+  OATPP_LOGd(TAG, "headers count={}", entries.size())
+
+  v_buff_size check = 0;
+
+  {
+    oatpp::test::PerformanceChecker checker("unordered_multimap: put + 4 lookups");
+    StringKeyLabelCI transferEncoding(Header::TRANSFER_ENCODING);
+    StringKeyLabelCI contentLength(Header::CONTENT_LENGTH);
+    StringKeyLabelCI acceptEncoding(Header::ACCEPT_ENCODING);
+    StringKeyLabelCI connection(Header::CONNECTION);
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      MultimapHeaders headers;
+      for(const auto& pair : entries) {
+        headers.put_LockFree(pair.first, pair.second);
+      }
+      check += lookup(headers, transferEncoding, contentLength, acceptEncoding, connection);
+    }
+  }
+
+  {
+    oatpp::test::PerformanceChecker checker("HeadersMap: put + 4 lookups by id");
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      Headers headers;
+      for(const auto& pair : entries) {
+        headers.put_LockFree(pair.first, pair.second);
+      }
+      check -= lookup(headers, HeaderId::TRANSFER_ENCODING, HeaderId::CONTENT_LENGTH, HeaderId::ACCEPT_ENCODING, HeaderId::CONNECTION);
+    }
+  }
+
+  OATPP_ASSERT(check == 0)
+
+}
+
+}}}}}
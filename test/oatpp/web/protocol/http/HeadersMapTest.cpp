@@ -0,0 +1,154 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HeadersMapTest.hpp"
+
+#include "oatpp/web/protocol/http/Http.hpp"
+#include "oatpp/utils/Conversion.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http {
+
+namespace {
+
+typedef oatpp::web::protocol::http::Header Header;
+typedef oatpp::web::protocol::http::HeaderId HeaderId;
+typedef oatpp::web::protocol::http::HeadersMap HeadersMap;
+typedef oatpp::web::protocol::http::Headers Headers;
+typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+typedef oatpp::data::share::StringKeyLabelCI StringKeyLabelCI;
+
+}
+
+void HeadersMapTest::onRun() {
+
+  { // tokenizing
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::HOST) == HeaderId::HOST)
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::CONNECTION) == HeaderId::CONNECTION)
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::CONTENT_LENGTH) == HeaderId::CONTENT_LENGTH)
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::CONTENT_TYPE) == HeaderId::CONTENT_TYPE)
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::CONTENT_ENCODING) == HeaderId::CONTENT_ENCODING)
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::TRANSFER_ENCODING) == HeaderId::TRANSFER_ENCODING)
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::ACCEPT) == HeaderId::ACCEPT)
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::ACCEPT_ENCODING) == HeaderId::ACCEPT_ENCODING)
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::AUTHORIZATION) == HeaderId::AUTHORIZATION)
+    OATPP_ASSERT(HeadersMap::getHeaderId(Header::EXPECT) == HeaderId::EXPECT)
+
+    OATPP_ASSERT(HeadersMap::getHeaderId("content-LENGTH") == HeaderId::CONTENT_LENGTH)
+    OATPP_ASSERT(HeadersMap::getHeaderId("Content-Lengtx") == HeaderId::UNKNOWN)
+    OATPP_ASSERT(HeadersMap::getHeaderId("X-Custom") == HeaderId::UNKNOWN)
+    OATPP_ASSERT(HeadersMap::getHeaderId("") == HeaderId::UNKNOWN)
+  }
+
+  { // order, lookup, multiple values
+    Headers headers;
+    headers.put("X-First", "1");
+    headers.put("host", "localhost");
+    headers.put("Accept", "text/html");
+    headers.put("X-Last", "2");
+    headers.put("ACCEPT", "application/json");
+
+    OATPP_ASSERT(headers.getSize() == 5)
+
+    const char* expectedOrder[] = {"X-First", "host", "Accept", "X-Last", "ACCEPT"};
+    v_int32 i = 0;
+    for(const auto& pair : headers.getAll_Unsafe()) {
+      OATPP_ASSERT(pair.first.equals(expectedOrder[i]))
+      i ++;
+    }
+    OATPP_ASSERT(i == 5)
+
+    OATPP_ASSERT(headers.get(HeaderId::HOST) == "localhost")
+    OATPP_ASSERT(headers.get("HOST") == "localhost")
+    OATPP_ASSERT(headers.getAsMemoryLabel<StringKeyLabel>(HeaderId::ACCEPT) == "text/html")
+    OATPP_ASSERT(headers.getAsMemoryLabel<StringKeyLabel>("accept") == "text/html")
+    OATPP_ASSERT(headers.get("x-last") == "2")
+    OATPP_ASSERT(headers.get(HeaderId::CONNECTION) == nullptr)
+    OATPP_ASSERT(headers.get("X-None") == nullptr)
+    OATPP_ASSERT(!headers.getAsMemoryLabel_Unsafe<StringKeyLabel>(HeaderId::CONTENT_TYPE))
+
+    OATPP_ASSERT(!headers.putIfNotExists("Host", "other"))
+    OATPP_ASSERT(headers.putIfNotExists("Connection", "close"))
+    OATPP_ASSERT(headers.get(HeaderId::CONNECTION) == "close")
+
+    OATPP_ASSERT(headers.putOrReplace("accept", "*/*"))
+    OATPP_ASSERT(headers.getSize() == 5)
+    OATPP_ASSERT(headers.get(HeaderId::ACCEPT) == "*/*")
+    OATPP_ASSERT(headers.get(HeaderId::HOST) == "localhost")
+    OATPP_ASSERT(headers.get(HeaderId::CONNECTION) == "close")
+    OATPP_ASSERT(headers.get("X-Last") == "2")
+  }
+
+  { // copy and move
+    Headers headers;
+    headers.put("Content-Type", "text/plain");
+    headers.put("X-Value", "value");
+
+    Headers copy(headers);
+    OATPP_ASSERT(copy.get(HeaderId::CONTENT_TYPE) == "text/plain")
+    OATPP_ASSERT(copy.get("X-Value") == "value")
+
+    Headers moved(std::move(headers));
+    OATPP_ASSERT(moved.get(HeaderId::CONTENT_TYPE) == "text/plain")
+    OATPP_ASSERT(headers.getSize() == 0)
+    OATPP_ASSERT(headers.get(HeaderId::CONTENT_TYPE) == nullptr)
+
+    headers = std::move(moved);
+    OATPP_ASSERT(headers.get(HeaderId::CONTENT_TYPE) == "text/plain")
+    OATPP_ASSERT(moved.get(HeaderId::CONTENT_TYPE) == nullptr)
+  }
+
+  { // parsed headers share the head buffer
+    auto text = std::make_shared<std::string>(
+      "Host: localhost\r\n"
+      "content-length: 10\r\n"
+      "Transfer-Encoding: chunked\r\n"
+      "\r\n"
+    );
+
+    Headers headers;
+    oatpp::utils::parser::Caret caret(text->data(), static_cast<v_buff_size>(text->size()));
+    oatpp::web::protocol::http::Status status;
+    oatpp::web::protocol::http::Parser::parseHeaders(headers, text, caret, status);
+    OATPP_ASSERT(status.code == 0)
+
+    auto contentLength = headers.getAsMemoryLabel<StringKeyLabel>(HeaderId::CONTENT_LENGTH);
+    OATPP_ASSERT(contentLength == "10")
+    OATPP_ASSERT(contentLength.getMemoryHandle() == text)
+    OATPP_ASSERT(headers.getAsMemoryLabel<StringKeyLabelCI>(HeaderId::TRANSFER_ENCODING) == "CHUNKED")
+  }
+
+  { // more entries than the initial capacity
+    Headers headers;
+    for(v_int32 i = 0; i < 40; i ++) {
+      headers.put("X-Header-" + oatpp::utils::Conversion::int32ToStr(i), oatpp::utils::Conversion::int32ToStr(i));
+    }
+    headers.put("Authorization", "Basic xyz");
+    OATPP_ASSERT(headers.getSize() == 41)
+    OATPP_ASSERT(headers.get("x-header-39") == "39")
+    OATPP_ASSERT(headers.get(HeaderId::AUTHORIZATION) == "Basic xyz")
+  }
+
+}
+
+}}}}}
@@ -119,6 +119,45 @@ void ChunkedTest::onRun() {
     OATPP_ASSERT(result == data)
   }
 
+  { // aggregate small input portions into bigger chunks
+    oatpp::data::stream::BufferInputStream inStream(data);
+    oatpp::data::stream::BufferOutputStream outStream;
+
+    oatpp::web::protocol::http::encoding::EncoderChunked encoder(8);
+
+    const v_int32 bufferSize = 5;
+    v_char8 buffer[bufferSize];
+
+    auto count = oatpp::data::stream::transfer(&inStream, &outStream, 0, buffer, bufferSize, &encoder);
+    auto result = outStream.toString();
+
+    OATPP_ASSERT(count == static_cast<v_io_size>(data->size()))
+    OATPP_LOGd(TAG, "aggregated='{}'", result)
+    OATPP_ASSERT(result == "8\r\nHello Wo\r\n6\r\nrld!!!\r\n0\r\n\r\n")
+  }
+
+  { // hex chunk size
+    oatpp::String bigData(std::string(300, 'a'));
+
+    oatpp::data::stream::BufferInputStream inStream(bigData);
+    oatpp::data::stream::BufferOutputStream outStream;
+
+    oatpp::web::protocol::http::encoding::EncoderChunked encoder;
+    oatpp::web::protocol::http::encoding::DecoderChunked decoder;
+
+    const v_int32 bufferSize = 1024;
+    v_char8 buffer[bufferSize];
+
+    oatpp::data::stream::transfer(&inStream, &outStream, 0, buffer, bufferSize, &encoder);
+    auto result = outStream.toString();
+    OATPP_ASSERT(result == "12C\r\n" + bigData + "\r\n0\r\n\r\n")
+
+    oatpp::data::stream::BufferInputStream decodeInStream(result);
+    oatpp::data::stream::BufferOutputStream decodeOutStream;
+    oatpp::data::stream::transfer(&decodeInStream, &decodeOutStream, 0, buffer, bufferSize, &decoder);
+    OATPP_ASSERT(decodeOutStream.toString() == bigData)
+  }
+
 
 }
 
@@ -0,0 +1,137 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "RequestHeadersReaderTest.hpp"
+
+#include "oatpp/web/protocol/http/incoming/RequestHeadersReader.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
+#include "oatpp/async/Executor.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace incoming {
+
+namespace {
+
+typedef oatpp::web::protocol::http::incoming::RequestHeadersReader RequestHeadersReader;
+
+const char* const REQUEST =
+  "GET /users/123?q=1 HTTP/1.1\r\n"
+  "Host: localhost:8000\r\n"
+  "User-Agent: test\r\n"
+  "Accept: */*\r\n"
+  "Content-Length: 5\r\n"
+  "\r\n"
+  "Hello";
+
+std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy> createStream(v_buff_size bufferSize) {
+  auto inStream = std::make_shared<oatpp::data::stream::BufferInputStream>(oatpp::String(REQUEST));
+  auto buffer = std::make_shared<std::string>(static_cast<size_t>(bufferSize), '\0');
+  return oatpp::data::stream::InputStreamBufferedProxy::createShared(inStream, buffer);
+}
+
+void checkResult(const RequestHeadersReader::Result& result) {
+
+  auto handle = result.startingLine.method.getMemoryHandle();
+  OATPP_ASSERT(handle)
+
+  OATPP_ASSERT(result.startingLine.method == "GET")
+  OATPP_ASSERT(result.startingLine.path == "/users/123?q=1")
+  OATPP_ASSERT(result.startingLine.protocol == "HTTP/1.1")
+  OATPP_ASSERT(result.startingLine.path.getMemoryHandle() == handle)
+  OATPP_ASSERT(result.startingLine.protocol.getMemoryHandle() == handle)
+
+  const auto& all = result.headers.getAll_Unsafe();
+  OATPP_ASSERT(all.size() == 4)
+  for(const auto& pair : all) {
+    OATPP_ASSERT(pair.first.getMemoryHandle() == handle)
+    OATPP_ASSERT(pair.second.getMemoryHandle() == handle)
+  }
+
+  /* labels taken out of the map keep pointing to the same buffer */
+  auto host = result.headers.getAsMemoryLabel<oatpp::data::share::StringKeyLabel>("host");
+  OATPP_ASSERT(host == "localhost:8000")
+  OATPP_ASSERT(host.getMemoryHandle() == handle)
+
+  /* the head is copied out of the connection buffer - body is not part of it */
+  OATPP_ASSERT(handle->find("Hello") == std::string::npos)
+
+}
+
+class ReaderCoroutine : public oatpp::async::Coroutine<ReaderCoroutine> {
+private:
+  std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy> m_stream;
+  oatpp::data::stream::BufferOutputStream m_bufferStream;
+  RequestHeadersReader m_reader;
+  std::atomic<bool>* m_done;
+public:
+
+  ReaderCoroutine(std::atomic<bool>* done)
+    : m_stream(createStream(16))
+    , m_reader(&m_bufferStream, 16, 4096)
+    , m_done(done)
+  {}
+
+  Action act() override {
+    return m_reader.readHeadersAsync(m_stream).callbackTo(&ReaderCoroutine::onHeaders);
+  }
+
+  Action onHeaders(const RequestHeadersReader::Result& result) {
+    checkResult(result);
+    *m_done = true;
+    return finish();
+  }
+
+};
+
+}
+
+void RequestHeadersReaderTest::onRun() {
+
+  { // sync
+    auto stream = createStream(16);
+    oatpp::data::stream::BufferOutputStream bufferStream;
+    RequestHeadersReader reader(&bufferStream, 16, 4096);
+    oatpp::web::protocol::http::HttpError::Info error;
+    auto result = reader.readHeaders(stream.get(), error);
+    OATPP_ASSERT(error.ioStatus > 0)
+    checkResult(result);
+
+    /* reusing the reader buffer for the next request must not affect previously parsed labels */
+    bufferStream.setCurrentPosition(0);
+    bufferStream.writeSimple("XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX");
+    checkResult(result);
+  }
+
+  { // async
+    std::atomic<bool> done(false);
+    oatpp::async::Executor executor(1, 1, 1);
+    executor.execute<ReaderCoroutine>(&done);
+    executor.waitTasksFinished();
+    executor.stop();
+    executor.join();
+    OATPP_ASSERT(done)
+  }
+
+}
+
+}}}}}}
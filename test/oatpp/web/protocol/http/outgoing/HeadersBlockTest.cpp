@@ -0,0 +1,158 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HeadersBlockTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/Response.hpp"
+#include "oatpp/web/protocol/http/utils/HttpDate.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::Headers Headers;
+typedef oatpp::web::protocol::http::Status Status;
+typedef oatpp::web::protocol::http::outgoing::HeadersBlock HeadersBlock;
+typedef oatpp::web::protocol::http::outgoing::Response Response;
+
+std::string sendResponse(const std::shared_ptr<Response>& response) {
+  oatpp::data::stream::BufferOutputStream stream;
+  oatpp::data::stream::BufferOutputStream headersBuffer;
+  response->send(&stream, &headersBuffer, nullptr);
+  return stream.toStdString();
+}
+
+}
+
+void HeadersBlockTest::onRun() {
+
+  {
+    OATPP_LOGd(TAG, "Case 1 - block text and lookup")
+
+    Headers headers;
+    headers.put_LockFree("Server", "test-server");
+    headers.put_LockFree("Connection", "keep-alive");
+    auto block = HeadersBlock::createShared(headers);
+
+    OATPP_ASSERT(block->getText() == "Server: test-server\r\nConnection: keep-alive\r\n")
+    OATPP_ASSERT(block->has("server"))
+    OATPP_ASSERT(block->get("CONNECTION") == "keep-alive")
+    OATPP_ASSERT(!block->has("Date"))
+    OATPP_ASSERT(block->get("Date") == nullptr)
+  }
+
+  {
+    OATPP_LOGd(TAG, "Case 2 - response headers take precedence over block")
+
+    Headers headers;
+    headers.put_LockFree("Server", "test-server");
+    headers.put_LockFree("Connection", "keep-alive");
+    auto block = HeadersBlock::createShared(headers);
+
+    auto response = Response::createShared(Status::CODE_200, nullptr);
+    response->putHeader("Connection", "close");
+    response->addHeadersBlock(block);
+    response->addHeadersBlock(block); // same block is attached only once
+
+    OATPP_ASSERT(response->getHeader("Server") == "test-server")
+    OATPP_ASSERT(response->getHeader("Connection") == "close")
+
+    auto text = sendResponse(response);
+    OATPP_LOGd(TAG, "response='{}'", text)
+    OATPP_ASSERT(text.find("HTTP/1.1 200 OK\r\n") == 0)
+    OATPP_ASSERT(text.find("Connection: close\r\n") != std::string::npos)
+    OATPP_ASSERT(text.find("Connection: keep-alive") == std::string::npos)
+    OATPP_ASSERT(text.find("Server: test-server\r\n") == text.rfind("Server: test-server\r\n"))
+  }
+
+  {
+    OATPP_LOGd(TAG, "Case 3 - first attached block wins")
+
+    Headers first;
+    first.put_LockFree("X-Header", "first");
+    Headers second;
+    second.put_LockFree("X-Header", "second");
+    second.put_LockFree("X-Other", "other");
+
+    auto response = Response::createShared(Status::CODE_204, nullptr);
+    response->addHeadersBlock(HeadersBlock::createShared(first));
+    response->addHeadersBlock(HeadersBlock::createShared(second));
+
+    OATPP_ASSERT(response->getHeader("X-Header") == "first")
+
+    auto text = sendResponse(response);
+    OATPP_ASSERT(text.find("HTTP/1.1 204 No Content\r\n") == 0)
+    OATPP_ASSERT(text.find("X-Header: first\r\n") != std::string::npos)
+    OATPP_ASSERT(text.find("X-Header: second") == std::string::npos)
+    OATPP_ASSERT(text.find("X-Other: other\r\n") != std::string::npos)
+  }
+
+  {
+    OATPP_LOGd(TAG, "Case 4 - custom status is rendered as before")
+
+    auto response = Response::createShared(Status(299, "Custom Status"), nullptr);
+    auto text = sendResponse(response);
+    OATPP_ASSERT(text.find("HTTP/1.1 299 Custom Status\r\n") == 0)
+  }
+
+  {
+    OATPP_LOGd(TAG, "Case 5 - headers of blocks over the limit are kept")
+
+    auto response = Response::createShared(Status::CODE_204, nullptr);
+    for(v_int32 i = 0; i < Response::MAX_HEADERS_BLOCKS; i ++) {
+      Headers headers;
+      headers.put(oatpp::String("X-Block-" + std::to_string(i)), "value");
+      response->addHeadersBlock(HeadersBlock::createShared(headers));
+    }
+
+    Headers overflow;
+    overflow.put_LockFree("Connection", "close");
+    overflow.put_LockFree("X-Block-0", "overflow");
+    response->addHeadersBlock(HeadersBlock::createShared(overflow));
+
+    OATPP_ASSERT(response->getHeader("Connection") == "close")
+    OATPP_ASSERT(response->getHeader("X-Block-0") == "value")
+
+    auto text = sendResponse(response);
+    OATPP_ASSERT(text.find("X-Block-0: value\r\n") != std::string::npos)
+    OATPP_ASSERT(text.find("X-Block-" + std::to_string(Response::MAX_HEADERS_BLOCKS - 1) + ": value\r\n") != std::string::npos)
+    OATPP_ASSERT(text.find("Connection: close\r\n") != std::string::npos)
+    OATPP_ASSERT(text.find("X-Block-0: overflow") == std::string::npos)
+  }
+
+  {
+    OATPP_LOGd(TAG, "Case 6 - http date")
+
+    OATPP_ASSERT(oatpp::web::protocol::http::utils::HttpDate::format(784111777) == "Sun, 06 Nov 1994 08:49:37 GMT")
+    OATPP_ASSERT(oatpp::web::protocol::http::utils::HttpDate::format(951782400) == "Tue, 29 Feb 2000 00:00:00 GMT")
+
+    auto current = oatpp::web::protocol::http::utils::HttpDate::getCurrent();
+    OATPP_ASSERT(current && current->size() == 29)
+    OATPP_ASSERT(current->substr(current->size() - 4) == " GMT")
+  }
+
+}
+
+}}}}}}
@@ -0,0 +1,148 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "HeadersEndScannerPerfTest.hpp"
+
+#include "oatpp/web/protocol/http/utils/HeadersEndScanner.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include <string>
+#include <vector>
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace utils {
+
+namespace {
+
+typedef oatpp::web::protocol::http::utils::HeadersEndScanner HeadersEndScanner;
+
+const char* const CURL_REQUEST =
+  "GET /api/v1/items?page=2 HTTP/1.1\r\n"
+  "Host: localhost:8000\r\n"
+  "User-Agent: curl/8.4.0\r\n"
+  "Accept: */*\r\n"
+  "\r\n";
+
+const char* const BROWSER_REQUEST =
+  "GET /dashboard/projects/oatpp/settings?tab=general HTTP/1.1\r\n"
+  "Host: app.example.com\r\n"
+  "Connection: keep-alive\r\n"
+  "Cache-Control: max-age=0\r\n"
+  "sec-ch-ua: \"Chromium\";v=\"118\", \"Google Chrome\";v=\"118\", \"Not=A?Brand\";v=\"99\"\r\n"
+  "sec-ch-ua-mobile: ?0\r\n"
+  "sec-ch-ua-platform: \"macOS\"\r\n"
+  "Upgrade-Insecure-Requests: 1\r\n"
+  "User-Agent: Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/118.0.0.0 Safari/537.36\r\n"
+  "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,image/apng,*/*;q=0.8,application/signed-exchange;v=b3;q=0.7\r\n"
+  "Sec-Fetch-Site: same-origin\r\n"
+  "Sec-Fetch-Mode: navigate\r\n"
+  "Sec-Fetch-User: ?1\r\n"
+  "Sec-Fetch-Dest: document\r\n"
+  "Referer: https://app.example.com/dashboard/projects/oatpp\r\n"
+  "Accept-Encoding: gzip, deflate, br\r\n"
+  "Accept-Language: en-US,en;q=0.9,uk;q=0.8\r\n"
+  "Cookie: _ga=GA1.1.1234567890.1697000000; _ga_ABCDEF=GS1.1.1697000000.1.1.1697000001.0.0.0; "
+  "session=eyJhbGciOiJIUzI1NiIsInR5cCI6IkpXVCJ9.eyJzdWIiOiIxMjM0NTY3ODkwIiwibmFtZSI6IkpvaG4gRG9lIiwiaWF0IjoxNTE2MjM5MDIyfQ."
+  "SflKxwRJSMeKKF2QT4fwpMeJf36POk6yJV_adQssw5c; theme=dark; locale=en-US; csrftoken=a8f5f167f44f4964e6c998dee827110c\r\n"
+  "If-None-Match: W/\"5e15153d-120f\"\r\n"
+  "If-Modified-Since: Tue, 17 Oct 2023 10:00:00 GMT\r\n"
+  "\r\n";
+
+const char* const API_RESPONSE =
+  "HTTP/1.1 200 OK\r\n"
+  "Server: nginx/1.25.2\r\n"
+  "Date: Tue, 17 Oct 2023 10:00:00 GMT\r\n"
+  "Content-Type: application/json; charset=utf-8\r\n"
+  "Content-Length: 1532\r\n"
+  "Connection: keep-alive\r\n"
+  "Vary: Accept-Encoding, Origin\r\n"
+  "Cache-Control: private, no-cache, no-store, must-revalidate\r\n"
+  "Strict-Transport-Security: max-age=31536000; includeSubDomains\r\n"
+  "X-Request-Id: 4b6f3f2e-6c2a-4e3b-9a8f-8d1f0c2b7e11\r\n"
+  "Access-Control-Allow-Origin: https://app.example.com\r\n"
+  "Access-Control-Allow-Credentials: true\r\n"
+  "\r\n";
+
+/**
+ * Per-byte accumulator scan - the way the end of headers was found before HeadersEndScanner.
+ */
+v_buff_size scanPerByte(v_uint32& accumulator, const v_char8* data, v_buff_size size) {
+  for(v_buff_size i = 0; i < size; i ++) {
+    accumulator <<= 8;
+    accumulator |= data[i];
+    if(accumulator == HeadersEndScanner::SECTION_END) {
+      return i + 1;
+    }
+  }
+  return -1;
+}
+
+}
+
+void HeadersEndScannerPerfTest::onRun() {
+
+  v_int32 numIterations = 200000;
+
+  OATPP_LOGd(TAG, "kernel='{}'", HeadersEndScanner::getKernelName())
+
+  std::vector<std::string> corpus = {CURL_REQUEST, BROWSER_REQUEST, API_RESPONSE};
+
+  for(auto& headers : corpus) {
+
+    auto data = reinterpret_cast<const v_char8*>(headers.data());
+    auto size = static_cast<v_buff_size>(headers.size());
+
+    v_uint32 a1 = 0;
+    v_uint32 a2 = 0;
+    OATPP_ASSERT(scanPerByte(a1, data, size) == size)
+    OATPP_ASSERT(HeadersEndScanner::scan(a2, data, size) == size)
+
+    OATPP_LOGd(TAG, "headers size={}", size)
+
+    v_buff_size check = 0;
+
+    {
+      oatpp::test::PerformanceChecker checker("Per-byte scan");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        v_uint32 accumulator = 0;
+        check += scanPerByte(accumulator, data, size);
+      }
+    }
+
+    {
+      oatpp::test::PerformanceChecker checker("HeadersEndScanner");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        v_uint32 accumulator = 0;
+        check -= HeadersEndScanner::scan(accumulator, data, size);
+      }
+    }
+
+    OATPP_ASSERT(check == 0)
+
+  }
+
+}
+
+}}}}}}
@@ -0,0 +1,121 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "HeadersEndScannerTest.hpp"
+
+#include "oatpp/web/protocol/http/utils/HeadersEndScanner.hpp"
+
+#include <string>
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace utils {
+
+namespace {
+
+typedef oatpp::web::protocol::http::utils::HeadersEndScanner HeadersEndScanner;
+
+/**
+ * Feed data to scanner by chunks of chunkSize.
+ * @return - position right after the terminator in the whole data, or -1.
+ */
+v_buff_size scanByChunks(const std::string& data, v_buff_size chunkSize) {
+  v_uint32 accumulator = 0;
+  auto bytes = reinterpret_cast<const v_char8*>(data.data());
+  auto size = static_cast<v_buff_size>(data.size());
+  for(v_buff_size pos = 0; pos < size; pos += chunkSize) {
+    auto chunk = std::min(chunkSize, size - pos);
+    auto res = HeadersEndScanner::scan(accumulator, bytes + pos, chunk);
+    if(res > 0) {
+      return pos + res;
+    }
+  }
+  return -1;
+}
+
+v_buff_size findReference(const std::string& data) {
+  auto pos = data.find("\r\n\r\n");
+  if(pos == std::string::npos) {
+    return -1;
+  }
+  return static_cast<v_buff_size>(pos + 4);
+}
+
+void checkAllChunkSizes(const std::string& data) {
+  auto expected = findReference(data);
+  for(v_buff_size chunkSize = 1; chunkSize <= static_cast<v_buff_size>(data.size()); chunkSize ++) {
+    OATPP_ASSERT(scanByChunks(data, chunkSize) == expected)
+  }
+}
+
+}
+
+void HeadersEndScannerTest::onRun() {
+
+  OATPP_LOGd(TAG, "kernel='{}'", HeadersEndScanner::getKernelName())
+
+  {
+    OATPP_LOGi(TAG, "Case 1 - terminator position")
+    std::string headers = "GET / HTTP/1.1\r\nHost: localhost\r\n";
+    for(v_int32 i = 0; i < 80; i ++) {
+      std::string data = headers + "\r\n" + std::string(static_cast<size_t>(i), 'x');
+      checkAllChunkSizes(data);
+      headers.insert(headers.size() - 2, "a");
+    }
+  }
+
+  {
+    OATPP_LOGi(TAG, "Case 2 - near misses")
+    checkAllChunkSizes("\r\n\n\r\n\r\r\n\r\r\n\r\n");
+    checkAllChunkSizes("\r\r\n\r\n");
+    checkAllChunkSizes("\n\r\n\r\n");
+    checkAllChunkSizes(std::string(100, '\r') + "\n\r\n" + std::string(100, '\n'));
+    checkAllChunkSizes(std::string(100, 'a') + "\r\n\r" + std::string(100, 'b'));
+    checkAllChunkSizes("\r\n\r\n");
+    checkAllChunkSizes("");
+  }
+
+  {
+    OATPP_LOGi(TAG, "Case 3 - terminator at every offset of long data")
+    for(v_int32 i = 0; i < 200; i ++) {
+      std::string data(static_cast<size_t>(i), 'h');
+      data += "\r\n\r\n";
+      data += std::string(64, 'b');
+      OATPP_ASSERT(scanByChunks(data, static_cast<v_buff_size>(data.size())) == i + 4)
+      OATPP_ASSERT(scanByChunks(data, 7) == i + 4)
+      OATPP_ASSERT(scanByChunks(data, 33) == i + 4)
+    }
+  }
+
+  {
+    OATPP_LOGi(TAG, "Case 4 - accumulator holds last bytes")
+    v_uint32 accumulator = 0;
+    auto text = reinterpret_cast<const v_char8*>("xxxxxx\r\n\r");
+    OATPP_ASSERT(HeadersEndScanner::scan(accumulator, text, 9) == -1)
+    OATPP_ASSERT(accumulator == ((static_cast<v_uint32>('x') << 24) | ('\r' << 16) | ('\n' << 8) | '\r'))
+    OATPP_ASSERT(HeadersEndScanner::scan(accumulator, reinterpret_cast<const v_char8*>("\nbody"), 5) == 1)
+  }
+
+}
+
+}}}}}}
@@ -0,0 +1,330 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HttpProcessorPipelineTest.hpp"
+
+#include "oatpp/web/server/HttpProcessor.hpp"
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+#include "oatpp/web/protocol/http/outgoing/StreamingBody.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
+#include "oatpp/utils/Conversion.hpp"
+#include "oatpp/async/Executor.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace oatpp { namespace test { namespace web { namespace server {
+
+namespace {
+
+typedef oatpp::web::server::HttpProcessor HttpProcessor;
+typedef oatpp::web::server::HttpRequestHandler HttpRequestHandler;
+typedef oatpp::web::protocol::http::Status Status;
+typedef oatpp::web::protocol::http::outgoing::Response OutgoingResponse;
+typedef oatpp::web::protocol::http::outgoing::ResponseFactory ResponseFactory;
+
+/*
+ * Connection which gives away all pipelined requests at once and records every write.
+ */
+class PipelineStream : public oatpp::data::stream::IOStream {
+private:
+  static oatpp::data::stream::DefaultInitializedContext DEFAULT_CONTEXT;
+private:
+  oatpp::String m_input;
+  v_buff_size m_inputPosition;
+public:
+
+  std::string output;
+  std::vector<std::string> writes;
+
+  PipelineStream(const oatpp::String& input)
+    : m_input(input)
+    , m_inputPosition(0)
+  {}
+
+  v_io_size write(const void *buff, v_buff_size count, async::Action& action) override {
+    (void) action;
+    output.append(reinterpret_cast<const char*>(buff), static_cast<size_t>(count));
+    writes.emplace_back(reinterpret_cast<const char*>(buff), static_cast<size_t>(count));
+    return count;
+  }
+
+  v_io_size writev(const oatpp::data::stream::WriteSegment* segments, v_int32 count, async::Action& action) override {
+    (void) action;
+    std::string data;
+    for(v_int32 i = 0; i < count; i ++) {
+      data.append(reinterpret_cast<const char*>(segments[i].data), static_cast<size_t>(segments[i].size));
+    }
+    output.append(data);
+    writes.push_back(data);
+    return static_cast<v_io_size>(data.size());
+  }
+
+  v_io_size read(void *buff, v_buff_size count, async::Action& action) override {
+    (void) action;
+    auto size = static_cast<v_buff_size>(m_input->size()) - m_inputPosition;
+    if(size > count) {
+      size = count;
+    }
+    std::memcpy(buff, m_input->data() + m_inputPosition, static_cast<size_t>(size));
+    m_inputPosition += size;
+    return size;
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::ASYNCHRONOUS;
+  }
+
+  oatpp::data::stream::Context& getOutputStreamContext() override {
+    return DEFAULT_CONTEXT;
+  }
+
+  void setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getInputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::ASYNCHRONOUS;
+  }
+
+  oatpp::data::stream::Context& getInputStreamContext() override {
+    return DEFAULT_CONTEXT;
+  }
+
+};
+
+oatpp::data::stream::DefaultInitializedContext PipelineStream::DEFAULT_CONTEXT(oatpp::data::stream::StreamType::STREAM_INFINITE);
+
+class Invalidator : public oatpp::provider::Invalidator<oatpp::data::stream::IOStream> {
+public:
+  void invalidate(const std::shared_ptr<oatpp::data::stream::IOStream>& connection) override {
+    (void) connection;
+  }
+};
+
+class Listener : public HttpProcessor::TaskProcessingListener {
+public:
+  void onTaskStart(const provider::ResourceHandle<data::stream::IOStream>& connection) override {
+    (void) connection;
+  }
+  void onTaskEnd(const provider::ResourceHandle<data::stream::IOStream>& connection) override {
+    (void) connection;
+  }
+};
+
+/*
+ * Responds with "<path>:<body>". Path "/stream/..." responds with a streaming body - it is never coalesced.
+ */
+class EchoHandler : public HttpRequestHandler {
+private:
+
+  static std::shared_ptr<OutgoingResponse> createResponse(const std::shared_ptr<IncomingRequest>& request, const oatpp::String& body) {
+    auto path = request->getStartingLine().path.toString();
+    oatpp::String text = path + ":" + (body ? body : oatpp::String(""));
+    if(path->find("/stream/") == 0) {
+      auto stream = std::make_shared<oatpp::data::stream::BufferInputStream>(text);
+      return OutgoingResponse::createShared(Status::CODE_200, std::make_shared<oatpp::web::protocol::http::outgoing::StreamingBody>(stream));
+    }
+    return ResponseFactory::createResponse(Status::CODE_200, text);
+  }
+
+public:
+
+  std::shared_ptr<OutgoingResponse> handle(const std::shared_ptr<IncomingRequest>& request) override {
+    return createResponse(request, request->readBodyToString());
+  }
+
+  oatpp::async::CoroutineStarterForResult<const std::shared_ptr<OutgoingResponse>&>
+  handleAsync(const std::shared_ptr<IncomingRequest>& request) override {
+
+    class HandlerCoroutine : public oatpp::async::CoroutineWithResult<HandlerCoroutine, const std::shared_ptr<OutgoingResponse>&> {
+    private:
+      std::shared_ptr<IncomingRequest> m_request;
+    public:
+
+      HandlerCoroutine(const std::shared_ptr<IncomingRequest>& request)
+        : m_request(request)
+      {}
+
+      Action act() override {
+        return m_request->readBodyToStringAsync().callbackTo(&HandlerCoroutine::onBody);
+      }
+
+      Action onBody(const oatpp::String& body) {
+        return _return(createResponse(m_request, body));
+      }
+
+    };
+
+    return HandlerCoroutine::startForResult(request);
+
+  }
+
+};
+
+std::shared_ptr<HttpProcessor::Components> createComponents(v_buff_size pipelinedResponsesBufferMaxSize) {
+  auto router = oatpp::web::server::HttpRouter::createShared();
+  auto handler = std::make_shared<EchoHandler>();
+  router->route("GET", "/item/{id}", handler);
+  router->route("GET", "/stream/{id}", handler);
+  router->route("POST", "/item/{id}", handler);
+  auto config = std::make_shared<HttpProcessor::Config>();
+  config->pipelinedResponsesBufferMaxSize = pipelinedResponsesBufferMaxSize;
+  return std::make_shared<HttpProcessor::Components>(router, config);
+}
+
+oatpp::String createPipeline(const std::vector<oatpp::String>& requests) {
+  oatpp::data::stream::BufferOutputStream stream;
+  for(auto& request : requests) {
+    stream << request;
+  }
+  return stream.toString();
+}
+
+oatpp::String get(const oatpp::String& path) {
+  return "GET " + path + " HTTP/1.1\r\nHost: localhost\r\nContent-Length: 0\r\n\r\n";
+}
+
+oatpp::String post(const oatpp::String& path, const oatpp::String& body) {
+  return "POST " + path + " HTTP/1.1\r\nHost: localhost\r\nContent-Length: " +
+         oatpp::utils::Conversion::int32ToStr(static_cast<v_int32>(body->size())) + "\r\n\r\n" + body;
+}
+
+size_t countResponses(const std::string& data) {
+  size_t count = 0;
+  for(auto pos = data.find("HTTP/1.1 200 OK"); pos != std::string::npos; pos = data.find("HTTP/1.1 200 OK", pos + 1)) {
+    count ++;
+  }
+  return count;
+}
+
+/*
+ * Check that every expected body is in the output, in order.
+ */
+void checkOrder(const std::string& output, const std::vector<const char*>& expected) {
+  size_t position = 0;
+  for(auto& text : expected) {
+    auto found = output.find(text, position);
+    OATPP_ASSERT(found != std::string::npos)
+    position = found + std::strlen(text);
+  }
+  OATPP_ASSERT(countResponses(output) == expected.size())
+}
+
+struct Result {
+  std::string output;
+  std::vector<std::string> writes;
+};
+
+Result runSync(const oatpp::String& input, v_buff_size pipelinedResponsesBufferMaxSize) {
+  auto stream = std::make_shared<PipelineStream>(input);
+  Listener listener;
+  {
+    HttpProcessor::Task task(createComponents(pipelinedResponsesBufferMaxSize),
+                             provider::ResourceHandle<data::stream::IOStream>(stream, std::make_shared<Invalidator>()),
+                             &listener);
+    task.run();
+  }
+  return {stream->output, stream->writes};
+}
+
+Result runAsync(const oatpp::String& input, v_buff_size pipelinedResponsesBufferMaxSize) {
+  auto stream = std::make_shared<PipelineStream>(input);
+  Listener listener;
+  {
+    oatpp::async::Executor executor(1, 1, 1);
+    executor.execute<HttpProcessor::Coroutine>(createComponents(pipelinedResponsesBufferMaxSize),
+                                               provider::ResourceHandle<data::stream::IOStream>(stream, std::make_shared<Invalidator>()),
+                                               &listener);
+    executor.waitTasksFinished();
+    executor.stop();
+    executor.join();
+  }
+  return {stream->output, stream->writes};
+}
+
+}
+
+void HttpProcessorPipelineTest::onRun() {
+
+  auto pipeline = createPipeline({get("/item/1"), get("/item/2"), post("/item/3", "body-3"), get("/item/4"), get("/item/5")});
+  std::vector<const char*> expected = {"/item/1:", "/item/2:", "/item/3:body-3", "/item/4:", "/item/5:"};
+
+  auto mixedPipeline = createPipeline({get("/item/1"), get("/item/2"), get("/stream/3"), get("/item/4"), get("/item/5")});
+  std::vector<const char*> mixedExpected = {"/item/1:", "/item/2:", "/stream/3:", "/item/4:", "/item/5:"};
+
+  {
+    OATPP_LOGd(TAG, "sync")
+
+    auto result = runSync(pipeline, 16384);
+    checkOrder(result.output, expected);
+    OATPP_LOGd(TAG, "coalesced: writes={}", result.writes.size())
+    OATPP_ASSERT(countResponses(result.writes[0]) == expected.size())
+
+    auto uncoalesced = runSync(pipeline, 0);
+    checkOrder(uncoalesced.output, expected);
+    OATPP_LOGd(TAG, "not coalesced: writes={}", uncoalesced.writes.size())
+    OATPP_ASSERT(countResponses(uncoalesced.writes[0]) == 1)
+    OATPP_ASSERT(uncoalesced.writes.size() >= expected.size())
+
+    auto mixed = runSync(mixedPipeline, 16384);
+    checkOrder(mixed.output, mixedExpected);
+    OATPP_LOGd(TAG, "mixed: writes={}", mixed.writes.size())
+    OATPP_ASSERT(countResponses(mixed.writes[0]) == 2)
+
+    /* small buffer - responses are flushed as soon as the buffer is full */
+    auto small = runSync(pipeline, 1);
+    checkOrder(small.output, expected);
+  }
+
+  {
+    OATPP_LOGd(TAG, "async")
+
+    auto result = runAsync(pipeline, 16384);
+    checkOrder(result.output, expected);
+    OATPP_LOGd(TAG, "coalesced: writes={}", result.writes.size())
+    OATPP_ASSERT(countResponses(result.writes[0]) == expected.size())
+
+    auto uncoalesced = runAsync(pipeline, 0);
+    checkOrder(uncoalesced.output, expected);
+    OATPP_LOGd(TAG, "not coalesced: writes={}", uncoalesced.writes.size())
+    OATPP_ASSERT(countResponses(uncoalesced.writes[0]) == 1)
+    OATPP_ASSERT(uncoalesced.writes.size() >= expected.size())
+
+    auto mixed = runAsync(mixedPipeline, 16384);
+    checkOrder(mixed.output, mixedExpected);
+    OATPP_LOGd(TAG, "mixed: writes={}", mixed.writes.size())
+    OATPP_ASSERT(countResponses(mixed.writes[0]) == 2)
+
+    auto small = runAsync(pipeline, 1);
+    checkOrder(small.output, expected);
+  }
+
+}
+
+}}}}
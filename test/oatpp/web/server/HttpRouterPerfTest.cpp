@@ -0,0 +1,159 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "HttpRouterPerfTest.hpp"
+
+#include "oatpp/web/server/HttpRouter.hpp"
+#include "oatpp/utils/Conversion.hpp"
+#include "oatpp/Types.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include <list>
+#include <vector>
+
+namespace oatpp { namespace test { namespace web { namespace server {
+
+namespace {
+
+typedef oatpp::web::server::HttpRouterTemplate<v_int32> NumRouter;
+typedef oatpp::web::url::mapping::Pattern Pattern;
+
+/**
+ * Sequential pattern scan - the way routes were resolved before the trie.
+ */
+class ListRouter {
+private:
+  std::list<std::pair<std::shared_ptr<Pattern>, v_int32>> m_patterns;
+public:
+
+  void route(const oatpp::String& pathPattern, v_int32 endpoint) {
+    m_patterns.push_back({Pattern::parse(pathPattern), endpoint});
+  }
+
+  v_int32 getRoute(const oatpp::data::share::StringKeyLabel& path, Pattern::MatchMap& matchMap) const {
+    for(auto& pair : m_patterns) {
+      Pattern::MatchMap map;
+      if(pair.first->match(path, map)) {
+        matchMap = std::move(map);
+        return pair.second;
+      }
+    }
+    return -1;
+  }
+
+};
+
+void runRoutesCount(v_int32 routesCount, v_int32 iterations) {
+
+  NumRouter router;
+  ListRouter listRouter;
+
+  std::vector<oatpp::String> paths;
+
+  for(v_int32 i = 0; i < routesCount; i ++) {
+
+    oatpp::String resource = "resource" + oatpp::utils::Conversion::int32ToStr(i);
+
+    switch(i % 4) {
+      case 0:
+        router.route("GET", "/api/v1/" + resource + "/list", i);
+        listRouter.route("/api/v1/" + resource + "/list", i);
+        paths.push_back("/api/v1/" + resource + "/list");
+        break;
+      case 1:
+        router.route("GET", "/api/v1/" + resource + "/{id}", i);
+        listRouter.route("/api/v1/" + resource + "/{id}", i);
+        paths.push_back("/api/v1/" + resource + "/100500?q=1");
+        break;
+      case 2:
+        router.route("GET", "/api/v1/" + resource + "/{id}/items/{item}", i);
+        listRouter.route("/api/v1/" + resource + "/{id}/items/{item}", i);
+        paths.push_back("/api/v1/" + resource + "/1/items/2");
+        break;
+      default:
+        router.route("GET", "/static/" + resource + "/*", i);
+        listRouter.route("/static/" + resource + "/*", i);
+        paths.push_back("/static/" + resource + "/css/style.css");
+        break;
+    }
+
+  }
+
+  paths.push_back("/api/v1/unknown/list");
+  paths.push_back("/not/found");
+
+  for(auto& path : paths) {
+    Pattern::MatchMap listMap;
+    auto expected = listRouter.getRoute(path, listMap);
+    auto route = router.getRoute("GET", path);
+    OATPP_ASSERT(route.isValid() == (expected >= 0))
+    if(route) {
+      OATPP_ASSERT(route.getEndpoint() == expected)
+      OATPP_ASSERT(route.getMatchMap().getVariables().size() == listMap.getVariables().size())
+      OATPP_ASSERT(route.getMatchMap().getTail() == listMap.getTail())
+    }
+  }
+
+  OATPP_LOGd("HttpRouterPerfTest", "routes={}, lookups={}", routesCount, iterations * static_cast<v_int32>(paths.size()))
+
+  v_int64 listTicks;
+  v_int64 trieTicks;
+
+  {
+    oatpp::test::PerformanceChecker checker("List Router");
+    for(v_int32 i = 0; i < iterations; i ++) {
+      for(auto& path : paths) {
+        Pattern::MatchMap matchMap;
+        listRouter.getRoute(path, matchMap);
+      }
+    }
+    listTicks = checker.getElapsedTicks();
+  }
+
+  {
+    oatpp::test::PerformanceChecker checker("Trie Router");
+    for(v_int32 i = 0; i < iterations; i ++) {
+      for(auto& path : paths) {
+        router.getRoute("GET", path);
+      }
+    }
+    trieTicks = checker.getElapsedTicks();
+  }
+
+  OATPP_LOGd("HttpRouterPerfTest", "routes={}, list/trie time ratio={}", routesCount,
+             static_cast<v_float64>(listTicks) / static_cast<v_float64>(trieTicks > 0 ? trieTicks : 1))
+
+}
+
+}
+
+void HttpRouterPerfTest::onRun() {
+  runRoutesCount(10, 10000);
+  runRoutesCount(100, 1000);
+  runRoutesCount(1000, 10);
+}
+
+}}}}
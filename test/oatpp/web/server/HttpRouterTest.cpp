@@ -186,6 +186,108 @@ void HttpRouterTest::onRun() {
     OATPP_ASSERT(r.getMatchMap().getTail() == "?q1=1&q2=2")
   }
 
+  {
+    OATPP_LOGi(TAG, "Case 17")
+    auto r = router.getRoute("PUT", "ints/1");
+    OATPP_ASSERT(r.isValid() == false)
+  }
+
+  {
+    OATPP_LOGi(TAG, "Case 18 - first routed wins")
+
+    NumRouter r2;
+    r2.route("GET", "items/{id}", 1);
+    r2.route("GET", "items/list", 2);
+    r2.route("GET", "items/{id}/parts/{part}", 3);
+    r2.route("GET", "items/{item}/parts/all", 4);
+    r2.route("GET", "/", 5);
+
+    auto r = r2.getRoute("GET", "items/list");
+    OATPP_ASSERT(r && r.getEndpoint() == 1)
+    OATPP_ASSERT(r.getMatchMap().getVariable("id") == "list")
+
+    r = r2.getRoute("GET", "items/10/parts/all");
+    OATPP_ASSERT(r && r.getEndpoint() == 3)
+    OATPP_ASSERT(r.getMatchMap().getVariable("id") == "10")
+    OATPP_ASSERT(r.getMatchMap().getVariable("part") == "all")
+    OATPP_ASSERT(r.getMatchMap().getVariablesCount() == 2)
+    OATPP_ASSERT(r.getMatchMap().getVariable(0) == "10")
+    OATPP_ASSERT(r.getMatchMap().getVariable(1) == "all")
+    OATPP_ASSERT(r.getMatchMap().getVariable(2) == nullptr)
+    OATPP_ASSERT(r.getMatchMap().getVariableName(1) == "part")
+
+    r = r2.getRoute("GET", "//");
+    OATPP_ASSERT(r && r.getEndpoint() == 5)
+
+    r = r2.getRoute("GET", "items");
+    OATPP_ASSERT(!r)
+  }
+
+  {
+    OATPP_LOGi(TAG, "Case 19 - variable before query string")
+
+    NumRouter r2;
+    r2.route("GET", "items/{id}/parts", 1);
+    r2.route("GET", "items/{id}/*", 2);
+
+    auto r = r2.getRoute("GET", "items/10?q=1");
+    OATPP_ASSERT(r && r.getEndpoint() == 2)
+    OATPP_ASSERT(r.getMatchMap().getVariable("id") == "10")
+    OATPP_ASSERT(r.getMatchMap().getTail() == "?q=1")
+
+    r = r2.getRoute("GET", "items/10/parts?q=1");
+    OATPP_ASSERT(r && r.getEndpoint() == 1)
+    OATPP_ASSERT(r.getMatchMap().getTail() == "?q=1")
+  }
+
+  {
+    OATPP_LOGi(TAG, "Case 20 - static routes")
+
+    NumRouter r2;
+    r2.route("GET", "/health", 1);
+    r2.route("GET", "/api/{version}/metrics", 2);
+    r2.route("GET", "/api/v1/metrics", 3);
+    r2.route("GET", "/api/items/list", 4);
+    r2.route("GET", "/api/items/list", 5);
+
+    auto r = r2.getRoute("GET", "health");
+    OATPP_ASSERT(r && r.getEndpoint() == 1)
+    OATPP_ASSERT(r.getMatchMap().getVariables().size() == 0)
+
+    r = r2.getRoute("GET", "//api///items/list//");
+    OATPP_ASSERT(r && r.getEndpoint() == 4)
+
+    r = r2.getRoute("GET", "/api/items/list?page=2");
+    OATPP_ASSERT(r && r.getEndpoint() == 4)
+    OATPP_ASSERT(r.getMatchMap().getTail() == "?page=2")
+
+    r = r2.getRoute("GET", "/api/v1/metrics");
+    OATPP_ASSERT(r && r.getEndpoint() == 2)
+    OATPP_ASSERT(r.getMatchMap().getVariable("version") == "v1")
+
+    r = r2.getRoute("GET", "/api/items/lis");
+    OATPP_ASSERT(!r)
+
+    r = r2.getRoute("GET", "/healthz");
+    OATPP_ASSERT(!r)
+  }
+
+  {
+    OATPP_LOGi(TAG, "Case 21 - more variables than inline capacity")
+
+    NumRouter r2;
+    r2.route("GET", "/{a}/{b}/{c}/{d}/{e}/{f}/{g}/{h}/{i}/{j}/*", 1);
+
+    auto r = r2.getRoute("GET", "/0/1/2/3/4/5/6/7/8/9/tail");
+    OATPP_ASSERT(r && r.getEndpoint() == 1)
+    OATPP_ASSERT(r.getMatchMap().getVariablesCount() == 10)
+    OATPP_ASSERT(r.getMatchMap().getVariable(7) == "7")
+    OATPP_ASSERT(r.getMatchMap().getVariable(9) == "9")
+    OATPP_ASSERT(r.getMatchMap().getVariable("i") == "8")
+    OATPP_ASSERT(r.getMatchMap().getVariables().size() == 10)
+    OATPP_ASSERT(r.getMatchMap().getTail() == "tail")
+  }
+
 }
 
 }}}}
@@ -0,0 +1,294 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HttpWorkerPoolTest.hpp"
+
+#include "oatpp/web/client/HttpRequestExecutor.hpp"
+#include "oatpp/web/server/HttpConnectionHandler.hpp"
+
+#include "oatpp/network/virtual_/server/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/client/ConnectionProvider.hpp"
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/network/tcp/client/ConnectionProvider.hpp"
+#include "oatpp/network/Server.hpp"
+
+#include "oatpp/utils/Conversion.hpp"
+
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace test { namespace web { namespace server {
+
+namespace {
+
+typedef oatpp::web::server::HttpWorkerPool HttpWorkerPool;
+
+/*
+ * Holds requests in the handler until the test opens it.
+ */
+class Gate {
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  v_int32 m_entered = 0;
+  bool m_open = false;
+public:
+
+  void pass() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_entered ++;
+    m_condition.notify_all();
+    m_condition.wait(lock, [this]{ return m_open; });
+  }
+
+  void waitEntered(v_int32 count) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this, count]{ return m_entered >= count; });
+  }
+
+  void open() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_open = true;
+    m_condition.notify_all();
+  }
+
+};
+
+class SleepHandler : public oatpp::web::server::HttpRequestHandler {
+private:
+  std::chrono::milliseconds m_sleep;
+  std::shared_ptr<Gate> m_gate;
+public:
+
+  SleepHandler(const std::chrono::milliseconds& sleep, const std::shared_ptr<Gate>& gate)
+    : m_sleep(sleep)
+    , m_gate(gate)
+  {}
+
+  std::shared_ptr<OutgoingResponse> handle(const std::shared_ptr<IncomingRequest> &request) override {
+    if(m_gate) {
+      m_gate->pass();
+    }
+    std::this_thread::sleep_for(m_sleep);
+    return OutgoingResponse::createShared(Status::CODE_200, nullptr);
+  }
+
+};
+
+class TestServer {
+private:
+  std::shared_ptr<oatpp::web::server::HttpConnectionHandler> m_handler;
+  std::shared_ptr<oatpp::network::Server> m_server;
+  std::thread m_thread;
+public:
+
+  TestServer(const std::shared_ptr<oatpp::network::ServerConnectionProvider>& connectionProvider,
+             const std::chrono::milliseconds& sleep,
+             const HttpWorkerPool::Config& poolConfig,
+             const std::shared_ptr<Gate>& gate = nullptr)
+  {
+    auto router = oatpp::web::server::HttpRouter::createShared();
+    router->route("GET", "/sleep", std::make_shared<SleepHandler>(sleep, gate));
+    m_handler = oatpp::web::server::HttpConnectionHandler::createShared(router, poolConfig);
+    m_server = std::make_shared<oatpp::network::Server>(connectionProvider, m_handler);
+    m_thread = std::thread([this]{
+      m_server->run();
+    });
+  }
+
+  ~TestServer() {
+    m_server->stop();
+    m_thread.join();
+    m_handler->stop();
+  }
+
+  std::shared_ptr<HttpWorkerPool> getPool() {
+    return m_handler->getWorkerPool();
+  }
+
+};
+
+bool runClient(const std::shared_ptr<oatpp::network::ClientConnectionProvider>& connectionProvider) {
+  try {
+    oatpp::web::client::HttpRequestExecutor executor(connectionProvider);
+    auto response = executor.execute("GET", "/sleep", oatpp::web::protocol::http::Headers({}), nullptr, nullptr);
+    return response->getStatusCode() == 200;
+  } catch (...) {
+    return false;
+  }
+}
+
+}
+
+void HttpWorkerPoolTest::onRun() {
+
+  auto _interface = oatpp::network::virtual_::Interface::obtainShared("virtualhost");
+  auto clientConnectionProvider = oatpp::network::virtual_::client::ConnectionProvider::createShared(_interface);
+
+  {
+    OATPP_LOGd(TAG, "Elastic pool")
+
+    HttpWorkerPool::Config config;
+    config.minThreads = 1;
+    config.maxThreads = 2;
+    config.backlog = 100;
+
+    TestServer server(oatpp::network::virtual_::server::ConnectionProvider::createShared(_interface), std::chrono::milliseconds(20), config);
+
+    std::atomic<v_int32> succeeded(0);
+    std::list<std::thread> clients;
+    for(v_int32 i = 0; i < 8; i ++) {
+      clients.emplace_back([clientConnectionProvider, &succeeded]{
+        if(runClient(clientConnectionProvider)) {
+          succeeded ++;
+        }
+      });
+    }
+    for(auto& t : clients) {
+      t.join();
+    }
+
+    OATPP_ASSERT(succeeded == 8)
+
+    auto stats = server.getPool()->getStats();
+    OATPP_LOGd(TAG, "threads={}, executed={}, rejected={}, avg wait={}us, max wait={}us",
+               stats.threads, stats.tasksExecuted, stats.tasksRejected,
+               stats.getAverageQueueWaitMicro(), stats.queueWaitMaxMicro)
+
+    OATPP_ASSERT(stats.threads >= 1 && stats.threads <= 2)
+    OATPP_ASSERT(stats.tasksExecuted == 8)
+    OATPP_ASSERT(stats.tasksRejected == 0)
+    OATPP_ASSERT(stats.getUtilization() >= 0 && stats.getUtilization() <= 1)
+  }
+
+  {
+    OATPP_LOGd(TAG, "Backlog overflow")
+
+    HttpWorkerPool::Config config;
+    config.minThreads = 1;
+    config.maxThreads = 1;
+    config.backlog = 1;
+    config.rejectionPolicy = HttpWorkerPool::RejectionPolicy::REJECT;
+
+    auto gate = std::make_shared<Gate>();
+    TestServer server(oatpp::network::virtual_::server::ConnectionProvider::createShared(_interface), std::chrono::milliseconds(0), config, gate);
+
+    std::atomic<v_int32> succeeded(0);
+    std::list<std::thread> clients;
+    auto startClient = [&clients, clientConnectionProvider, &succeeded]{
+      clients.emplace_back([clientConnectionProvider, &succeeded]{
+        if(runClient(clientConnectionProvider)) {
+          succeeded ++;
+        }
+      });
+    };
+
+    /* The only worker is held in the handler - one of the next two connections is queued, the other one is rejected */
+    startClient();
+    gate->waitEntered(1);
+    startClient();
+    startClient();
+
+    auto stats = server.getPool()->getStats();
+    for(v_int32 attempt = 0; attempt < 1000 && stats.tasksRejected < 1; attempt ++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      stats = server.getPool()->getStats();
+    }
+
+    gate->open();
+    for(auto& t : clients) {
+      t.join();
+    }
+
+    stats = server.getPool()->getStats();
+    OATPP_LOGd(TAG, "succeeded={}, executed={}, rejected={}", succeeded.load(), stats.tasksExecuted, stats.tasksRejected)
+
+    OATPP_ASSERT(succeeded == 2)
+    OATPP_ASSERT(stats.tasksExecuted == 2)
+    OATPP_ASSERT(stats.tasksRejected == 1)
+    OATPP_ASSERT(stats.queueWaitMaxMicro > 0)
+  }
+
+  /* Idle connections are parked only where HttpConnectionPoller is supported -
+   * elsewhere the single worker stays blocked on the first connection. */
+#if defined(__linux__)
+  {
+    OATPP_LOGd(TAG, "Park idle connections")
+
+    HttpWorkerPool::Config config;
+    config.minThreads = 1;
+    config.maxThreads = 1;
+    config.parkIdleConnections = true;
+
+    auto tcpServerProvider = oatpp::network::tcp::server::ConnectionProvider::createShared({"localhost", 0});
+
+    bool success;
+    auto port = oatpp::utils::Conversion::strToInt32(
+      tcpServerProvider->getProperty(oatpp::network::ServerConnectionProvider::PROPERTY_PORT).toString(), success
+    );
+    OATPP_ASSERT(success)
+
+    TestServer server(tcpServerProvider, std::chrono::milliseconds(0), config);
+
+    auto tcpClientProvider = oatpp::network::tcp::client::ConnectionProvider::createShared({"localhost", static_cast<v_uint16>(port)});
+    oatpp::web::client::HttpRequestExecutor executor(tcpClientProvider);
+
+    /* Single worker serves several keep-alive connections - only possible if idle connections release the worker */
+    std::vector<std::shared_ptr<oatpp::web::client::RequestExecutor::ConnectionHandle>> connections;
+    for(v_int32 i = 0; i < 3; i ++) {
+      connections.push_back(executor.getConnection());
+    }
+
+    for(v_int32 round = 0; round < 3; round ++) {
+      for(auto& connection : connections) {
+        auto response = executor.execute("GET", "/sleep", oatpp::web::protocol::http::Headers({}), nullptr, connection);
+        OATPP_ASSERT(response->getStatusCode() == 200)
+        response->readBodyToString();
+      }
+    }
+
+    /* Connection is parked right after the response is sent, and counted after it is parked - wait for the last one */
+    auto stats = server.getPool()->getStats();
+    for(v_int32 attempt = 0; attempt < 100 && (stats.parkedConnections < 3 || stats.parkCount < 9); attempt ++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      stats = server.getPool()->getStats();
+    }
+
+    OATPP_LOGd(TAG, "threads={}, executed={}, parked={}, park count={}",
+               stats.threads, stats.tasksExecuted, stats.parkedConnections, stats.parkCount)
+
+    OATPP_ASSERT(stats.threads == 1)
+    OATPP_ASSERT(stats.parkCount == 9)
+    OATPP_ASSERT(stats.tasksExecuted == 9)
+    OATPP_ASSERT(stats.parkedConnections == 3)
+
+    connections.clear();
+  }
+#endif
+
+}
+
+}}}}